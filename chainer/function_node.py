@@ -699,6 +699,7 @@ Use apply() method instead.\
                            retained_inputs, retained_outputs):
         # Backward wrapper that is called from C++ via a Python binding in case
         # self.apply was called with chainerx.ndarrays.
+        # All the arguments are tuples.
         assert self._is_chainex_fallback_mode
         assert len(target_input_indexes) > 0
         assert (
@@ -727,7 +728,7 @@ Use apply() method instead.\
             *(retained_inputs + retained_outputs + grad_outputs))
         with chainer.using_device(device):
             gxs = self._backward_target_inputs(
-                tuple(target_input_indexes),
+                target_input_indexes,
                 tuple([
                     None
                     if gy is None
@@ -14,6 +14,7 @@ def set_docs():
     _docs_connection()
     _docs_normalization()
     _docs_pooling()
+    _docs_batch()
 
 
 def _docs_creation():
@@ -417,6 +418,47 @@ Note:
 .. seealso:: :func:`numpy.diagflat`
 """)
 
+    _docs.set_doc(
+        chainerx.from_dlpack,
+        """from_dlpack(capsule)
+Creates an array from a DLPack tensor without copying.
+
+The returned array shares the buffer with the producer of the tensor,
+including strided views. The buffer is released when it is no longer used by
+any array.
+
+Args:
+    capsule (PyCapsule): DLPack tensor, e.g. returned by
+        :func:`chainerx.to_dlpack` or ``cupy.ndarray.toDlpack``. It can be
+        consumed only once.
+
+Returns:
+    ~chainerx.ndarray: An array on the native device for a CPU tensor, or on
+    the CUDA device of the same index for a GPU tensor.
+
+.. seealso:: :func:`chainerx.to_dlpack`
+""")
+
+    _docs.set_doc(
+        chainerx.to_dlpack,
+        """to_dlpack(array)
+Exports an array as a DLPack tensor without copying.
+
+The tensor shares the buffer with the array and keeps it alive until the
+consumer releases the tensor. The computational graph of the array is not
+exported.
+
+Args:
+    array (~chainerx.ndarray): Array on a native or CUDA device. Boolean
+        arrays are not supported.
+
+Returns:
+    PyCapsule: DLPack tensor, which can be consumed by
+    :func:`chainerx.from_dlpack` or ``cupy.fromDlpack``.
+
+.. seealso:: :func:`chainerx.from_dlpack`
+""")
+
 
 def _docs_indexing():
     _docs.set_doc(
@@ -1550,3 +1592,48 @@ Note:
    In ``cuda`` backend, only 2 and 3 dim arrays are supported as ``x``
    because cuDNN pooling supports 2 and 3 spatial dimensions.
 """)
+
+
+def _docs_batch():
+    _docs.set_doc(
+        chainerx.execute_batch,
+        """execute_batch(ops, inputs)
+Executes a list of operations in a single call.
+
+This reduces the Python overhead of dispatching many small operations, e.g.
+a whole layer or an optimizer step.
+
+Each operation is a tuple ``(routine, args)`` or ``(routine, args, attrs)``.
+``routine`` is the name of a routine such as ``'add'`` or ``'linear'``.
+``args`` is a sequence of handles of the input arrays. ``attrs`` is a dict
+of the other arguments of the routine, named as in the corresponding
+function, e.g. ``{'axis': 1}`` for :func:`~chainerx.sum`.
+
+Handles are indices of the values in the batch. The given inputs come first,
+followed by the outputs of each operation in order.
+
+Binary routines (``add``, ``subtract``, ``multiply``, ``divide`` and
+``maximum``) also accept one input and a scalar given as the attribute
+``x1`` or ``x2``. ``iadd``, ``isubtract``, ``imultiply`` and ``idivide``
+update their first input in-place and output it.
+
+All operations are validated before any of them is executed. Computational
+graphs are recorded as if the routines were called one by one.
+
+Args:
+    ops (sequence of tuples): Operations to execute.
+    inputs (sequence of :class:`~chainerx.ndarray`): Input arrays.
+
+Returns:
+    list of :class:`~chainerx.ndarray`: Outputs of all the operations, i.e.
+    the values of the handles following the inputs.
+
+.. admonition:: Example
+
+    >>> x = chainerx.array([[-1., 2.]])
+    >>> w = chainerx.array([[1., 1.], [2., 0.]])
+    >>> h, y = chainerx.execute_batch(
+    ...     [('linear', (0, 1)), ('relu', (2,))], [x, w])
+    >>> y
+    array([[1., 0.]], shape=(1, 2), dtype=float64, device='native:0')
+""")
@@ -0,0 +1,106 @@
+#include "chainerx/arena.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+
+#include <gsl/gsl>
+
+#include "chainerx/device.h"
+#include "chainerx/error.h"
+#include "chainerx/macro.h"
+
+namespace chainerx {
+namespace {
+
+// The arena is not stored in InternalThreadLocalState since it is not thread safe and must never be propagated to other threads.
+thread_local Arena* t_default_arena{nullptr};
+
+size_t AlignUp(size_t value, size_t alignment) { return (value + alignment - 1) / alignment * alignment; }
+
+}  // namespace
+
+constexpr size_t Arena::kDefaultChunkBytesize;
+constexpr size_t Arena::kAlignment;
+
+Arena::Arena(Device& device, size_t chunk_bytesize) : device_{device}, chunk_bytesize_{AlignUp(chunk_bytesize, kAlignment)} {
+    if (chunk_bytesize == 0) {
+        throw ChainerxError{"Arena chunk size must be positive."};
+    }
+}
+
+std::shared_ptr<void> Arena::Allocate(size_t bytesize) {
+    CHAINERX_ASSERT(bytesize > 0);
+    size_t aligned_bytesize = AlignUp(bytesize, kAlignment);
+    if (aligned_bytesize > chunk_bytesize_) {
+        return nullptr;
+    }
+
+    Chunk& chunk = GetChunkWithSpace(aligned_bytesize);
+    void* ptr = static_cast<uint8_t*>(chunk.buffer.get()) + chunk.offset;
+    chunk.offset += aligned_bytesize;
+    ++allocation_count_;
+
+    // The buffer shares the ownership of the chunk without any additional allocation of a control block.
+    return std::shared_ptr<void>{chunk.buffer, ptr};
+}
+
+void Arena::Reset() {
+    // Some buffers are still alive in a chunk if it is referenced from anywhere else. Leave such chunks to the buffers.
+    auto promoted_begin = std::remove_if(chunks_.begin(), chunks_.end(), [](const Chunk& chunk) { return chunk.buffer.use_count() > 1; });
+    promoted_chunk_count_ += std::distance(promoted_begin, chunks_.end());
+    chunks_.erase(promoted_begin, chunks_.end());
+
+    for (Chunk& chunk : chunks_) {
+        chunk.offset = 0;
+    }
+    current_chunk_index_ = 0;
+}
+
+Arena::Chunk& Arena::GetChunkWithSpace(size_t bytesize) {
+    for (; current_chunk_index_ < chunks_.size(); ++current_chunk_index_) {
+        Chunk& chunk = chunks_[current_chunk_index_];
+        if (chunk.offset + bytesize <= chunk_bytesize_) {
+            return chunk;
+        }
+    }
+
+    std::shared_ptr<void> buffer{};
+    {
+        // Deactivate the arena while allocating the chunk itself so that the device uses its general allocator.
+        Arena* orig = internal::GetDefaultArenaNoExcept();
+        internal::SetDefaultArena(nullptr);
+        auto restore = gsl::finally([orig] { internal::SetDefaultArena(orig); });
+
+        // Over-allocate so that the chunk can be aligned regardless of the alignment of the underlying allocator.
+        buffer = device_.Allocate(chunk_bytesize_ + kAlignment);
+    }
+
+    // Align the head of the chunk, keeping the ownership of the original allocation.
+    auto address = reinterpret_cast<uintptr_t>(buffer.get());  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    size_t padding = AlignUp(address, kAlignment) - address;
+    void* head = static_cast<uint8_t*>(buffer.get()) + padding;
+
+    chunks_.emplace_back(Chunk{std::shared_ptr<void>{buffer, head}, 0});
+    current_chunk_index_ = chunks_.size() - 1;
+    return chunks_.back();
+}
+
+namespace internal {
+
+Arena* GetDefaultArenaNoExcept() noexcept { return t_default_arena; }
+
+void SetDefaultArena(Arena* arena) { t_default_arena = arena; }
+
+std::shared_ptr<void> AllocateFromDefaultArena(Device& device, size_t bytesize) {
+    Arena* arena = t_default_arena;
+    if (arena == nullptr || &arena->device() != &device) {
+        return nullptr;
+    }
+    return arena->Allocate(bytesize);
+}
+
+}  // namespace internal
+}  // namespace chainerx
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "chainerx/device.h"
+
+namespace chainerx {
+
+// Bump allocator for short-lived buffers such as the temporaries of a single forward/backward iteration.
+//
+// An arena holds memory chunks allocated from its device. While an ArenaScope for the arena is active in the current thread,
+// Device::Allocate on the same device carves buffers out of the chunks instead of going through the general allocator.
+//
+// Reset() rewinds the arena so that the chunks are reused from the beginning. A chunk that is still referenced by any of its buffers at
+// that point is not rewound. Instead the arena gives up its ownership of the chunk, so that the chunk behaves as an ordinary allocation
+// which is freed together with the last buffer referring to it (we call this "promotion"). It is therefore always safe to keep arrays
+// allocated under an arena scope alive after the scope exits; it only costs the memory of the whole chunk.
+//
+// This class is not thread safe, but buffers allocated from an arena can be released from any thread.
+class Arena {
+public:
+    // Chunk size used when not specified.
+    static constexpr size_t kDefaultChunkBytesize = size_t{16} << 20;  // 16 MiB
+
+    // Alignment of buffers returned by the arena, in bytes.
+    static constexpr size_t kAlignment = 256;
+
+    explicit Arena(Device& device, size_t chunk_bytesize = kDefaultChunkBytesize);
+
+    Arena(const Arena&) = delete;
+    Arena(Arena&&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    Arena& operator=(Arena&&) = delete;
+
+    // Allocates a buffer from the arena.
+    // Returns nullptr if the request cannot be served by the arena, i.e. it is larger than the chunk size, in which case the caller should
+    // fall back to the general allocator.
+    std::shared_ptr<void> Allocate(size_t bytesize);
+
+    // Rewinds the arena.
+    // Chunks that are still referenced by buffers are promoted to ordinary allocations and replaced with new chunks on demand.
+    void Reset();
+
+    Device& device() const { return device_; }
+
+    size_t chunk_bytesize() const { return chunk_bytesize_; }
+
+    // Returns the number of buffers served by the arena since construction.
+    int64_t allocation_count() const { return allocation_count_; }
+
+    // Returns the number of chunks promoted to ordinary allocations since construction.
+    int64_t promoted_chunk_count() const { return promoted_chunk_count_; }
+
+    // Returns the number of chunks currently owned by the arena.
+    size_t chunk_count() const { return chunks_.size(); }
+
+private:
+    struct Chunk {
+        std::shared_ptr<void> buffer;
+        size_t offset;
+    };
+
+    Chunk& GetChunkWithSpace(size_t bytesize);
+
+    Device& device_;
+    size_t chunk_bytesize_;
+
+    // Chunks owned by the arena. Chunks before current_chunk_index_ are (nearly) full.
+    std::vector<Chunk> chunks_;
+    size_t current_chunk_index_{0};
+
+    int64_t allocation_count_{0};
+    int64_t promoted_chunk_count_{0};
+};
+
+namespace internal {
+
+// Returns the arena which is active in the current thread, or nullptr if none.
+Arena* GetDefaultArenaNoExcept() noexcept;
+
+// Sets the arena which is active in the current thread.
+void SetDefaultArena(Arena* arena);
+
+// Allocates a buffer from the arena active in the current thread, if the arena belongs to the given device.
+// Returns nullptr if there is no such arena or the arena cannot serve the request.
+// Device implementations call this function at the beginning of Device::Allocate.
+std::shared_ptr<void> AllocateFromDefaultArena(Device& device, size_t bytesize);
+
+}  // namespace internal
+
+// Scope object that activates an arena by RAII.
+// The arena is reset when the scope exits.
+class ArenaScope {
+public:
+    explicit ArenaScope(Arena& arena) : orig_{internal::GetDefaultArenaNoExcept()}, arena_{arena}, exited_{false} {
+        internal::SetDefaultArena(&arena_);
+    }
+
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope(ArenaScope&&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+    ArenaScope& operator=(ArenaScope&&) = delete;
+
+    ~ArenaScope() { Exit(); }
+
+    // Explicitly deactivates and resets the arena, and recovers the original arena. It will invalidate the scope object so that dtor will
+    // do nothing.
+    void Exit() {
+        if (!exited_) {
+            internal::SetDefaultArena(orig_);
+            arena_.Reset();
+            exited_ = true;
+        }
+    }
+
+private:
+    Arena* orig_;
+    Arena& arena_;
+    bool exited_;
+};
+
+}  // namespace chainerx
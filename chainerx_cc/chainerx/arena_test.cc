@@ -0,0 +1,167 @@
+#include "chainerx/arena.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/context.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/shape.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/context_session.h"
+
+namespace chainerx {
+namespace {
+
+bool IsAligned(const void* ptr) {
+    return reinterpret_cast<uintptr_t>(ptr) % Arena::kAlignment == 0;  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+TEST(ArenaTest, Ctor) {
+    testing::ContextSession context_session;
+    Device& device = context_session.context().GetDevice({"native", 0});
+
+    Arena arena{device, 1000};
+    EXPECT_EQ(&device, &arena.device());
+    EXPECT_EQ(size_t{1024}, arena.chunk_bytesize());
+    EXPECT_EQ(0, arena.allocation_count());
+    EXPECT_EQ(0, arena.promoted_chunk_count());
+    EXPECT_EQ(size_t{0}, arena.chunk_count());
+
+    EXPECT_THROW(Arena(device, 0), ChainerxError);
+}
+
+TEST(ArenaTest, Allocate) {
+    testing::ContextSession context_session;
+    Device& device = context_session.context().GetDevice({"native", 0});
+    Arena arena{device, 1024};
+
+    std::shared_ptr<void> ptr1 = arena.Allocate(3);
+    std::shared_ptr<void> ptr2 = arena.Allocate(300);
+    ASSERT_NE(nullptr, ptr1);
+    ASSERT_NE(nullptr, ptr2);
+    EXPECT_TRUE(IsAligned(ptr1.get()));
+    EXPECT_TRUE(IsAligned(ptr2.get()));
+    EXPECT_EQ(static_cast<uint8_t*>(ptr1.get()) + Arena::kAlignment, ptr2.get());
+    EXPECT_EQ(size_t{1}, arena.chunk_count());
+
+    // Does not fit in the rest of the chunk.
+    std::shared_ptr<void> ptr3 = arena.Allocate(512);
+    ASSERT_NE(nullptr, ptr3);
+    EXPECT_EQ(size_t{2}, arena.chunk_count());
+    EXPECT_EQ(3, arena.allocation_count());
+
+    // Larger than a chunk.
+    EXPECT_EQ(nullptr, arena.Allocate(1025));
+    EXPECT_EQ(3, arena.allocation_count());
+}
+
+TEST(ArenaTest, ResetReusesChunks) {
+    testing::ContextSession context_session;
+    Device& device = context_session.context().GetDevice({"native", 0});
+    Arena arena{device, 1024};
+
+    void* raw_ptr = arena.Allocate(100).get();
+    arena.Reset();
+    EXPECT_EQ(0, arena.promoted_chunk_count());
+    EXPECT_EQ(size_t{1}, arena.chunk_count());
+
+    EXPECT_EQ(raw_ptr, arena.Allocate(100).get());
+}
+
+TEST(ArenaTest, ResetPromotesReferencedChunks) {
+    testing::ContextSession context_session;
+    Device& device = context_session.context().GetDevice({"native", 0});
+    Arena arena{device, 1024};
+
+    std::shared_ptr<void> ptr = arena.Allocate(sizeof(int64_t));
+    *static_cast<int64_t*>(ptr.get()) = 42;
+
+    arena.Reset();
+    EXPECT_EQ(1, arena.promoted_chunk_count());
+    EXPECT_EQ(size_t{0}, arena.chunk_count());
+
+    // New allocations must not overwrite the promoted buffer.
+    std::shared_ptr<void> ptr2 = arena.Allocate(sizeof(int64_t));
+    *static_cast<int64_t*>(ptr2.get()) = 0;
+    EXPECT_NE(ptr.get(), ptr2.get());
+    EXPECT_EQ(42, *static_cast<int64_t*>(ptr.get()));
+}
+
+TEST(ArenaTest, ArenaScope) {
+    testing::ContextSession context_session;
+    Device& device = context_session.context().GetDevice({"native", 0});
+    Device& other_device = context_session.context().GetDevice({"native", 1});
+    Arena arena{device, 1024};
+
+    ASSERT_EQ(nullptr, internal::GetDefaultArenaNoExcept());
+    {
+        ArenaScope scope{arena};
+        EXPECT_EQ(&arena, internal::GetDefaultArenaNoExcept());
+
+        std::shared_ptr<void> ptr = device.Allocate(100);
+        EXPECT_EQ(1, arena.allocation_count());
+        EXPECT_TRUE(IsAligned(ptr.get()));
+
+        // Other devices do not use the arena.
+        std::shared_ptr<void> other_ptr = other_device.Allocate(100);
+        EXPECT_EQ(1, arena.allocation_count());
+
+        // Zero-sized allocation.
+        EXPECT_EQ(nullptr, device.Allocate(0));
+        EXPECT_EQ(1, arena.allocation_count());
+    }
+    EXPECT_EQ(nullptr, internal::GetDefaultArenaNoExcept());
+    EXPECT_EQ(0, arena.promoted_chunk_count());
+
+    {
+        // Outside of the scope.
+        std::shared_ptr<void> ptr = device.Allocate(100);
+        EXPECT_EQ(1, arena.allocation_count());
+    }
+}
+
+TEST(ArenaTest, ArenaScopeNested) {
+    testing::ContextSession context_session;
+    Device& device = context_session.context().GetDevice({"native", 0});
+    Arena arena1{device, 1024};
+    Arena arena2{device, 1024};
+
+    ArenaScope scope1{arena1};
+    {
+        ArenaScope scope2{arena2};
+        EXPECT_EQ(&arena2, internal::GetDefaultArenaNoExcept());
+        device.Allocate(1);
+    }
+    EXPECT_EQ(&arena1, internal::GetDefaultArenaNoExcept());
+    scope1.Exit();
+    EXPECT_EQ(nullptr, internal::GetDefaultArenaNoExcept());
+    EXPECT_EQ(0, arena1.allocation_count());
+    EXPECT_EQ(1, arena2.allocation_count());
+}
+
+TEST(ArenaTest, ArraysSurviveScope) {
+    testing::ContextSession context_session;
+    Device& device = context_session.context().GetDevice({"native", 0});
+    Arena arena{device, 1024};
+
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>().WithPadding(1);
+    Array kept{};
+    for (int i = 0; i < 3; ++i) {
+        ArenaScope scope{arena};
+        Array tmp = a + a;
+        kept = tmp * a;
+    }
+    EXPECT_LE(1, arena.promoted_chunk_count());
+    EXPECT_ARRAY_EQ(testing::BuildArray({2, 3}).WithData<float>({0.f, 2.f, 8.f, 18.f, 32.f, 50.f}), kept);
+}
+
+}  // namespace
+}  // namespace chainerx
@@ -33,6 +33,7 @@
 #include "chainerx/macro.h"
 #include "chainerx/native/native_backend.h"
 #include "chainerx/op_node.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/indexing.h"
 #include "chainerx/routines/linalg.h"
@@ -200,6 +201,7 @@ Array Array::Take(const Array& indices, int8_t axis) const { return chainerx::Ta
 Array Array::Copy() const { return chainerx::Copy(*this); }
 
 Array Array::MakeView() const {
+    ProfileRange profile_range{"routine", "view", {*this}};
     Array out{shape(), strides(), dtype(), device(), data(), offset()};
 
     BackwardBuilder bb{"view", *this, out};
@@ -212,6 +214,7 @@ Array Array::MakeView() const {
 }
 
 Array Array::ToDevice(Device& dst_device) const {
+    ProfileRange profile_range{"routine", "transfer", {*this}};
     Device& src_device = body_->device();
     Array out;
 
@@ -222,6 +225,8 @@ Array Array::ToDevice(Device& dst_device) const {
     } else {
         // Make a contiguous copy to transfer it to the destination device.
         Array src_contig = internal::AsContiguous(AsGradStopped(CopyKind::kView));
+        // Kernels writing to the source may still be running on an asynchronous device.
+        src_device.Synchronize();
 
         std::shared_ptr<void> dst_data;
         if (src_device.backend().SupportsTransfer(src_device, dst_device)) {
@@ -255,7 +260,10 @@ Array Array::ToDevice(Device& dst_device) const {
 Array Array::ToNative() const {
     Context& context = device().backend().context();
     Device& native_device = context.GetNativeBackend().GetDevice(0);
-    return ToDevice(native_device);
+    Array out = ToDevice(native_device);
+    // The caller reads the data in the host.
+    native_device.Synchronize();
+    return out;
 }
 
 namespace {
@@ -284,6 +292,7 @@ Array Array::AsGradStopped(gsl::span<const BackpropId> backprop_ids, CopyKind ki
 }
 
 Array Array::AsType(Dtype dtype, bool copy) const {
+    ProfileRange profile_range{"routine", "astype", {*this}};
     Dtype src_dtype = this->dtype();
     if (!copy && dtype == src_dtype) {
         return *this;
@@ -159,6 +159,7 @@ public:
     // Transfer the array to the native device. It will be connected to all the graphs.
     //
     // This is a wrapper function which calls Array::ToDevice with the native:0 device.
+    // The native:0 device is synchronized so that the returned data can be read in the host.
     // See also: Array::ToDevice();
     Array ToNative() const;
 
@@ -4,11 +4,14 @@
 #include <mutex>
 #include <ostream>
 #include <sstream>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "chainerx/array.h"
 #include "chainerx/array_body.h"
 #include "chainerx/array_node.h"
+#include "chainerx/device.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
 #include "chainerx/macro.h"
@@ -16,6 +19,21 @@
 namespace chainerx {
 namespace internal {
 
+namespace {
+
+void SynchronizeDevices(std::vector<std::shared_ptr<ArrayBody>> array_bodies) {
+    std::unordered_set<Device*> devices{};
+    for (const std::shared_ptr<ArrayBody>& array_body : array_bodies) {
+        devices.emplace(&array_body->device());
+    }
+    array_bodies.clear();
+    for (Device* device : devices) {
+        device->Synchronize();
+    }
+}
+
+}  // namespace
+
 ArrayBodyLeakTracker* ArrayBodyLeakDetectionScope::array_body_leak_tracker_ = nullptr;
 
 void ArrayBodyLeakTracker::operator()(const std::shared_ptr<ArrayBody>& array_body) {
@@ -25,6 +43,16 @@ void ArrayBodyLeakTracker::operator()(const std::shared_ptr<ArrayBody>& array_bo
 }
 
 std::vector<std::shared_ptr<ArrayBody>> ArrayBodyLeakTracker::GetAliveArrayBodies() const {
+    std::vector<std::shared_ptr<ArrayBody>> alive_ptrs = CollectAliveArrayBodies();
+    if (!alive_ptrs.empty()) {
+        // Array bodies may still be held by kernels which are not finished yet on asynchronous devices.
+        SynchronizeDevices(std::move(alive_ptrs));
+        alive_ptrs = CollectAliveArrayBodies();
+    }
+    return alive_ptrs;
+}
+
+std::vector<std::shared_ptr<ArrayBody>> ArrayBodyLeakTracker::CollectAliveArrayBodies() const {
     std::lock_guard<std::mutex> lock{mutex_};
     std::vector<std::shared_ptr<ArrayBody>> alive_ptrs;
     for (const std::weak_ptr<ArrayBody>& weak_ptr : weak_ptrs_) {
@@ -19,12 +19,15 @@ public:
 
     // Returns the array bodies which are still alive.
     // It is useful to detect unreleased array bodies, leaking from the scope of ArrayBodyLeakDetectionScope.
+    // If any, their devices are synchronized first, since kernels which are not finished yet may hold them.
     std::vector<std::shared_ptr<ArrayBody>> GetAliveArrayBodies() const;
 
     // Asserts all the array bodies are freed in the leak tracker.
     bool IsAllArrayBodiesFreed(std::ostream& os) const;
 
 private:
+    std::vector<std::shared_ptr<ArrayBody>> CollectAliveArrayBodies() const;
+
     std::vector<std::weak_ptr<ArrayBody>> weak_ptrs_;
     mutable std::mutex mutex_;
 };
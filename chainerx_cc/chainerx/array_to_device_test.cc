@@ -139,6 +139,8 @@ private:
 void ExpectArraysEqual(const Array& expected, const Array& actual) {
     EXPECT_EQ(expected.dtype(), actual.dtype());
     EXPECT_EQ(expected.shape(), actual.shape());
+    expected.device().Synchronize();
+    actual.device().Synchronize();
     VisitDtype(expected.dtype(), [&expected, &actual](auto pt) {
         using T = typename decltype(pt)::type;
         IndexableArray<const T> expected_iarray{expected};
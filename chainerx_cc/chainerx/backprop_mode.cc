@@ -23,21 +23,32 @@ using internal::BackpropModeStack;
 
 namespace backprop_mode_detail {
 
+// Backprop modes are irrelevant in inference mode, in which case scopes do not touch the stack.
+
 template <bool kModeFlag>
-BackpropModeScope<kModeFlag>::BackpropModeScope(Context& context) : n_{1} {
-    BackpropModeStack& backprop_mode_stack = internal::GetInternalThreadLocalState().backprop_mode_stack;
-    backprop_mode_stack.emplace_back(context, kModeFlag);
+BackpropModeScope<kModeFlag>::BackpropModeScope(Context& context) {
+    internal::InternalThreadLocalState& state = internal::GetInternalThreadLocalState();
+    if (state.inference_mode) {
+        return;
+    }
+    state.backprop_mode_stack.emplace_back(context, kModeFlag);
+    n_ = 1;
 }
 
 template <bool kModeFlag>
-BackpropModeScope<kModeFlag>::BackpropModeScope(const std::vector<BackpropId>& backprop_ids) : n_{backprop_ids.size()} {
+BackpropModeScope<kModeFlag>::BackpropModeScope(const std::vector<BackpropId>& backprop_ids) {
     // Need to throw before initializing because thowing error at ctor does not call the dtor.
     for (const BackpropId& backprop_id : backprop_ids) {
         if (&backprop_ids.front().context() != &backprop_id.context()) {
             throw ContextError{"Cannot specify backprop ids with different contexts together."};
         }
     }
-    BackpropModeStack& backprop_mode_stack = internal::GetInternalThreadLocalState().backprop_mode_stack;
+    internal::InternalThreadLocalState& state = internal::GetInternalThreadLocalState();
+    if (state.inference_mode) {
+        return;
+    }
+    n_ = backprop_ids.size();
+    BackpropModeStack& backprop_mode_stack = state.backprop_mode_stack;
     for (const BackpropId& backprop_id : backprop_ids) {
         backprop_mode_stack.emplace_back(backprop_id, kModeFlag);
     }
@@ -45,6 +56,9 @@ BackpropModeScope<kModeFlag>::BackpropModeScope(const std::vector<BackpropId>& b
 
 template <bool kModeFlag>
 BackpropModeScope<kModeFlag>::~BackpropModeScope() {
+    if (n_ == 0) {
+        return;
+    }
     BackpropModeStack& backprop_mode_stack = internal::GetInternalThreadLocalState().backprop_mode_stack;
     CHAINERX_ASSERT(backprop_mode_stack.size() >= n_);
 
@@ -56,13 +70,27 @@ template class BackpropModeScope<false>;
 
 }  // namespace backprop_mode_detail
 
+InferenceModeScope::InferenceModeScope() {
+    internal::InternalThreadLocalState& state = internal::GetInternalThreadLocalState();
+    orig_inference_mode_ = state.inference_mode;
+    state.inference_mode = true;
+}
+
+InferenceModeScope::~InferenceModeScope() { internal::GetInternalThreadLocalState().inference_mode = orig_inference_mode_; }
+
+bool IsInferenceMode() { return internal::GetInternalThreadLocalState().inference_mode; }
+
 bool IsBackpropRequired(Context& context) {
     BackpropId backprop_id = context.default_backprop_id();
     return IsBackpropRequired(backprop_id);
 }
 
 bool IsBackpropRequired(const BackpropId& backprop_id) {
-    BackpropModeStack& bms = internal::GetInternalThreadLocalState().backprop_mode_stack;
+    internal::InternalThreadLocalState& state = internal::GetInternalThreadLocalState();
+    if (state.inference_mode) {
+        return false;
+    }
+    BackpropModeStack& bms = state.backprop_mode_stack;
     auto it = std::find_if(bms.rbegin(), bms.rend(), [&backprop_id](const internal::BackpropMode& bm) {
         if (bm.backprop_id().has_value()) {
             return backprop_id == *bm.backprop_id();
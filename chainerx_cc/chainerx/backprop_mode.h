@@ -77,6 +77,27 @@ using NoBackpropModeScope = backprop_mode_detail::BackpropModeScope<false>;
 // Make a context which enables back-propagation.
 using ForceBackpropModeScope = backprop_mode_detail::BackpropModeScope<true>;
 
+// Make a context in which no computational graph is constructed at all, regardless of the backprop modes of individual graphs.
+//
+// This mode is meant for inference. Unlike NoBackpropModeScope, routines skip graph construction with a single flag check, without
+// inspecting the array nodes of their inputs. Backprop mode scopes entered within this scope have no effect.
+class InferenceModeScope {
+public:
+    InferenceModeScope();
+
+    InferenceModeScope(const InferenceModeScope&) = delete;
+    InferenceModeScope(InferenceModeScope&& other) = delete;
+    InferenceModeScope& operator=(const InferenceModeScope&) = delete;
+    InferenceModeScope& operator=(InferenceModeScope&& other) = delete;
+
+    ~InferenceModeScope();
+
+private:
+    bool orig_inference_mode_;
+};
+
+bool IsInferenceMode();
+
 bool IsBackpropRequired(Context& context = GetDefaultContext());
 bool IsBackpropRequired(const BackpropId& backprop_id);
 
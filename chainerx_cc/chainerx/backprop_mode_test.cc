@@ -438,5 +438,45 @@ TEST(BackpropModeScopeTest, BackpropModeScopeWithAnotherContext) {
     EXPECT_THROW(NoBackpropModeScope({backprop_id, another_backprop_id}), ContextError);
 }
 
+TEST(BackpropModeScopeTest, InferenceModeScope) {
+    testing::ContextSession context_session{};
+    BackpropScope backprop_scope{"bp1"};
+    BackpropId backprop_id = backprop_scope.backprop_id();
+
+    EXPECT_FALSE(IsInferenceMode());
+    {
+        InferenceModeScope scope1{};
+        EXPECT_TRUE(IsInferenceMode());
+        EXPECT_FALSE(IsBackpropRequired());
+        EXPECT_FALSE(IsBackpropRequired(backprop_id));
+        {
+            // Backprop modes have no effect in inference mode.
+            ForceBackpropModeScope scope2{};
+            ForceBackpropModeScope scope3{backprop_id};
+            EXPECT_FALSE(IsBackpropRequired());
+            EXPECT_FALSE(IsBackpropRequired(backprop_id));
+
+            InferenceModeScope scope4{};
+            EXPECT_TRUE(IsInferenceMode());
+        }
+        EXPECT_TRUE(IsInferenceMode());
+    }
+    EXPECT_FALSE(IsInferenceMode());
+    EXPECT_TRUE(IsBackpropRequired());
+    EXPECT_TRUE(IsBackpropRequired(backprop_id));
+
+    {
+        // Backprop modes entered outside of inference mode are restored on exit.
+        NoBackpropModeScope scope1{backprop_id};
+        {
+            InferenceModeScope scope2{};
+            EXPECT_FALSE(IsBackpropRequired(backprop_id));
+        }
+        EXPECT_TRUE(IsBackpropRequired());
+        EXPECT_FALSE(IsBackpropRequired(backprop_id));
+    }
+    EXPECT_TRUE(IsBackpropRequired(backprop_id));
+}
+
 }  // namespace
 }  // namespace chainerx
@@ -1,9 +1,18 @@
 #include "chainerx/backward.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <functional>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -23,8 +32,10 @@
 #include "chainerx/graph.h"
 #include "chainerx/macro.h"
 #include "chainerx/op_node.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/shape.h"
+#include "chainerx/thread_local_state.h"
 
 namespace chainerx {
 namespace {
@@ -51,15 +62,34 @@ void CheckGradCompatible(const Array& grad, const Shape& shape, Dtype dtype, Dev
     }
 }
 
+// Returns whether the partial gradient can be added in-place to the target gradient without affecting any other arrays.
+bool IsGradInplaceAccumulatable(const Array& target_grad, const Array& partial_grad) {
+    const std::shared_ptr<ArrayBody>& target_body = internal::GetArrayBody(target_grad);
+    // The target must not be referenced from anywhere else, e.g. from an output gradient or by the user, including through views sharing
+    // its data. Overlapping elements as in broadcast arrays are excluded by requiring contiguity.
+    if (target_body.use_count() != 1 || target_grad.device().GetDataUseCount(target_body->data()) != 1 || !target_grad.IsContiguous()) {
+        return false;
+    }
+    // The sum must not be connected to any graph, e.g. an outer graph in nested backprop.
+    return target_body->nodes().empty() && internal::GetArrayBody(partial_grad)->nodes().empty();
+}
+
 }  // namespace
 
-void AccumulateGrad(nonstd::optional<Array>& target_grad, Array partial_grad, const Shape& shape, Dtype dtype, Device& device) {
+bool AccumulateGrad(
+        nonstd::optional<Array>& target_grad, Array partial_grad, const Shape& shape, Dtype dtype, Device& device, bool allow_inplace) {
     CheckGradCompatible(partial_grad, shape, dtype, device);
-    if (target_grad.has_value()) {
-        target_grad = *target_grad + partial_grad;
-    } else {
+    if (!target_grad.has_value()) {
         target_grad = std::move(partial_grad);
+        return false;
     }
+    if (allow_inplace && IsGradInplaceAccumulatable(*target_grad, partial_grad)) {
+        NoBackpropModeScope scope{};
+        device.Add(*target_grad, partial_grad, *target_grad);
+        return true;
+    }
+    target_grad = *target_grad + partial_grad;
+    return false;
 }
 
 void SetGrad(nonstd::optional<Array>& target_grad, Array grad, const Shape& shape, Dtype dtype, Device& device) {
@@ -71,14 +101,128 @@ void SetGrad(nonstd::optional<Array>& target_grad, Array grad, const Shape& shap
 
 namespace {
 
+// Number of in-place gradient accumulations in this thread. See GetInplaceGradAccumulationCount().
+thread_local int64_t t_inplace_grad_accumulation_count{0};
+
+// Number of worker threads used by Backward() in this thread. See ParallelBackwardScope.
+thread_local size_t t_backward_thread_count{0};
+
+// Hook called by Backward() in this thread. See GradReadyHookScope.
+thread_local GradReadyHook t_grad_ready_hook{};
+
 struct OpNodeComparator {
     bool operator()(const std::shared_ptr<OpNode>& lhs, const std::shared_ptr<OpNode>& rhs) const { return lhs->rank() < rhs->rank(); }
 };
 
+// Pool of worker threads shared by all parallel backward computations in the process.
+class BackwardWorkerPool {
+public:
+    static BackwardWorkerPool& GetInstance() {
+        static BackwardWorkerPool pool{};
+        return pool;
+    }
+
+    BackwardWorkerPool(const BackwardWorkerPool&) = delete;
+    BackwardWorkerPool(BackwardWorkerPool&&) = delete;
+    BackwardWorkerPool& operator=(const BackwardWorkerPool&) = delete;
+    BackwardWorkerPool& operator=(BackwardWorkerPool&&) = delete;
+
+    ~BackwardWorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            stopped_ = true;
+        }
+        cv_.notify_all();
+        for (std::thread& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    // Spawns threads so that the pool has at least the given number of threads.
+    void Reserve(size_t thread_count) {
+        std::lock_guard<std::mutex> lock{mutex_};
+        while (threads_.size() < thread_count) {
+            threads_.emplace_back([this]() { WorkerLoop(); });
+        }
+    }
+
+    // Enqueues a task. The task must not throw.
+    void Submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            tasks_.emplace_back(std::move(task));
+        }
+        cv_.notify_one();
+    }
+
+private:
+    BackwardWorkerPool() = default;
+
+    void WorkerLoop() {
+        while (true) {
+            std::function<void()> task{};
+            {
+                std::unique_lock<std::mutex> lock{mutex_};
+                cv_.wait(lock, [this]() { return stopped_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::thread> threads_;
+    bool stopped_{false};
+};
+
+// Output array nodes of an op node and the gradients of them, which are passed to the backward functions of the op node.
+struct OutputGradients {
+    // Output array nodes. May be nullptr if the node is gone.
+    std::vector<std::shared_ptr<ArrayNode>> array_nodes;
+
+    // `temp_grads` is a set of temporary GradRefs of the output array nodes.
+    // This is used for output array nodes which are either dead at the moment or alive but have not been involved in the preceding
+    // backpropagation.
+    // This vector is just a keeper and not used in any other way. `grads` holds the pointer to it.
+    // These GradRefs are only valid in the backward functions of this op node.
+    // Be careful not to cause reallocation in this vector. Otherwise the pointers would be invalidated.
+    std::vector<internal::GradRef> temp_grads;
+
+    std::vector<internal::GradRef*> grads;
+};
+
+// Op node whose backward functions are dispatched to a worker thread.
+struct OpNodeTask {
+    explicit OpNodeTask(std::shared_ptr<OpNode> op_node) : op_node{std::move(op_node)} {}
+
+    std::shared_ptr<OpNode> op_node;
+    OutputGradients output_grads;
+    std::vector<nonstd::optional<Array>> input_grads;
+    std::future<void> future;
+};
+
+// Dependencies of an op node on the other op nodes in the graph to be backpropped.
+struct OpNodeDependency {
+    // Position of the op node in the order of sequential execution.
+    size_t order{0};
+
+    // Number of remaining edges from the op nodes consuming the outputs of this op node.
+    size_t count{0};
+
+    // Op nodes creating the inputs of this op node, one for each edge.
+    std::vector<OpNode*> producers;
+};
+
 class BackwardImpl {
 public:
     BackwardImpl(const std::vector<ConstArrayRef>& outputs, const BackpropId& backprop_id, DoubleBackpropOption double_backprop)
-        : outputs_{outputs}, backprop_id_{backprop_id}, double_backprop_{double_backprop} {
+        : outputs_{outputs}, backprop_id_{backprop_id}, double_backprop_{double_backprop}, grad_ready_hook_{internal::GetGradReadyHook()} {
         for (const Array& output : outputs) {
             if (!output.IsBackpropRequired(backprop_id)) {
                 throw ChainerxError{"Cannot start backprop from an array whose gradient is not required (on graph '", backprop_id, "')"};
@@ -102,7 +246,10 @@ public:
     void Run() {
         Context& context = backprop_id_.context();
 
-        // Push initial output array nodes
+        // The hook is only for the leaves of this backward. Backward() nested in the backward functions, e.g. that of Checkpoint(), must
+        // not call it, as in the worker threads which do not inherit it.
+        GradReadyHookScope no_hook_scope{GradReadyHook{}};
+
         for (size_t i = 0; i < outputs_.size(); ++i) {
             const Array& output = outputs_[i];
             const std::shared_ptr<ArrayNode>& array_node = output_array_nodes_[i];
@@ -114,76 +261,168 @@ public:
             if (!emplace_result.first->second.get().has_value()) {
                 emplace_result.first->second.get() = OnesLike(output, output.device());
             }
+        }
+
+        // Dependencies must be collected before pushing op nodes, which detaches them from the array nodes.
+        size_t thread_count = internal::GetBackwardThreadCount();
+        is_parallel_ = thread_count > 0 && double_backprop_ == DoubleBackpropOption::kDisable && CollectOpNodeDependencies();
+        if (grad_ready_hook_) {
+            CollectLeafConsumerCounts();
+        }
 
+        // Push initial output array nodes
+        for (const std::shared_ptr<ArrayNode>& array_node : output_array_nodes_) {
             PushCreatorOpNode(array_node);
         }
 
         // Backpropagation
-        while (!candidate_op_nodes_.empty()) {
-            std::pop_heap(candidate_op_nodes_.begin(), candidate_op_nodes_.end(), OpNodeComparator{});
-            std::shared_ptr<OpNode> op_node = std::move(candidate_op_nodes_.back());
-            candidate_op_nodes_.pop_back();
+        if (is_parallel_) {
+            RunParallel(thread_count);
+        } else {
+            RunSequential();
+        }
 
-            // Add GradRef for input array nodes
-            for (const std::shared_ptr<ArrayNode>& input_array_node : op_node->input_array_nodes()) {
-                if (input_array_node != nullptr) {
-                    array_node_grad_map_.emplace(input_array_node.get(), internal::GradRef{*input_array_node});
-                }
-            }
+        // Register this graph as backpropped.
+        context.SetBackpropDone(backprop_id_);
+    }
+
+private:
+    void RunSequential() {
+        while (!candidate_op_nodes_.empty()) {
+            std::shared_ptr<OpNode> op_node = PopCandidateOpNode();
+            AddInputGradRefs(*op_node);
 
             // Backpropagate gradients from the output array nodes into the input array nodes.
-            {
-                std::vector<nonstd::optional<Array>> gxs = ComputeInputGradients(op_node);
-                AccumulateInputGradients(*op_node, std::move(gxs));
-            }
+            OutputGradients output_grads{};
+            PrepareOutputGradients(*op_node, output_grads);
+            std::vector<nonstd::optional<Array>> gxs = CallBackwardFunctions(op_node, output_grads);
 
-            // Push the creator op nodes into the queue
-            for (const auto& input_array_node : op_node->input_array_nodes()) {
-                if (input_array_node != nullptr) {
-                    PushCreatorOpNode(input_array_node);
+            CompleteOpNode(op_node, output_grads, std::move(gxs));
+        }
+    }
+
+    // Runs the backward functions of op nodes in worker threads as soon as all their consumers are completed, while the op nodes are
+    // completed, i.e. their gradients are accumulated, in exactly the same order as in sequential execution.
+    void RunParallel(size_t thread_count) {
+        BackwardWorkerPool& pool = BackwardWorkerPool::GetInstance();
+        pool.Reserve(thread_count);
+        ThreadLocalState thread_local_state = ThreadLocalState::Get();
+
+        // Dispatched op nodes which are not completed yet, keyed by their order.
+        std::map<size_t, OpNodeTask> tasks{};
+
+        // Never leave this function while the workers may still refer to the tasks, even on errors.
+        auto wait_tasks = gsl::finally([&tasks]() {
+            for (auto& pair : tasks) {
+                if (pair.second.future.valid()) {
+                    pair.second.future.wait();
                 }
             }
+        });
+
+        for (size_t next_order = 0; !ready_op_nodes_.empty() || !tasks.empty(); ++next_order) {
+            // Dispatch ready op nodes in order.
+            // The next op node to complete is always ready at this point, since all its consumers precede it. It is dispatched even if all
+            // the threads are busy.
+            while (!ready_op_nodes_.empty() && (tasks.size() < thread_count || ready_op_nodes_.begin()->first == next_order)) {
+                auto ready_it = ready_op_nodes_.begin();
+                OpNodeTask& task = tasks.emplace(ready_it->first, OpNodeTask{std::move(ready_it->second)}).first->second;
+                ready_op_nodes_.erase(ready_it);
+                AddInputGradRefs(*task.op_node);
+                PrepareOutputGradients(*task.op_node, task.output_grads);
+
+                auto packaged_task = std::make_shared<std::packaged_task<void()>>([this, &task, &thread_local_state]() {
+                    ThreadLocalState::Set(thread_local_state);
+                    auto reset = gsl::finally([]() { ThreadLocalState::Set(ThreadLocalState{}); });
+                    task.input_grads = CallBackwardFunctions(task.op_node, task.output_grads);
+                });
+                task.future = packaged_task->get_future();
+                pool.Submit([packaged_task]() { (*packaged_task)(); });
+            }
+
+            // Complete the next op node.
+            auto task_it = tasks.find(next_order);
+            CHAINERX_ASSERT(task_it != tasks.end());
+            OpNodeTask& task = task_it->second;
+            task.future.get();  // Rethrows the error in the backward functions, if any.
+            CompleteOpNode(task.op_node, task.output_grads, std::move(task.input_grads));
+            tasks.erase(task_it);
+        }
+
+        CHAINERX_ASSERT(pending_op_nodes_.empty());
+    }
+
+    std::shared_ptr<OpNode> PopCandidateOpNode() {
+        std::pop_heap(candidate_op_nodes_.begin(), candidate_op_nodes_.end(), OpNodeComparator{});
+        std::shared_ptr<OpNode> op_node = std::move(candidate_op_nodes_.back());
+        candidate_op_nodes_.pop_back();
+        return op_node;
+    }
 
-            if (double_backprop_ == DoubleBackpropOption::kDisable) {
-                op_node->Unchain();
+    // Adds GradRefs for input array nodes.
+    void AddInputGradRefs(const OpNode& op_node) {
+        for (const std::shared_ptr<ArrayNode>& input_array_node : op_node.input_array_nodes()) {
+            // Look up first, since constructing a GradRef accesses the array body of the node, which the backward functions running in
+            // parallel may be fabricating.
+            if (input_array_node != nullptr && array_node_grad_map_.find(input_array_node.get()) == array_node_grad_map_.end()) {
+                array_node_grad_map_.emplace(input_array_node.get(), internal::GradRef{*input_array_node});
             }
+        }
+    }
 
-            // Erase the array node's temporarily held grad
-            {
-                auto range = output_array_node_keeper_.equal_range(op_node.get());
-                for (auto it = range.first; it != range.second; ++it) {
-                    size_t n_removed = array_node_grad_map_.erase(it->second.get());
-                    CHAINERX_ASSERT(n_removed > 0);
+    // Accumulates the computed input gradients of an op node and moves on to its input array nodes.
+    void CompleteOpNode(const std::shared_ptr<OpNode>& op_node, const OutputGradients& output_grads, std::vector<nonstd::optional<Array>> gxs) {
+        FinalizeInputGradients(output_grads, gxs);
+
+        // Release the output gradients before accumulating the input gradients, which may allocate new arrays.
+        ReleaseOutputGradients(*op_node);
+        AccumulateInputGradients(*op_node, std::move(gxs));
+
+        // Notify the leaf array nodes of which this op node was the last consumer.
+        if (!leaf_consumer_counts_.empty()) {
+            for (const std::shared_ptr<ArrayNode>& input_array_node : op_node->input_array_nodes()) {
+                if (input_array_node == nullptr) {
+                    continue;
+                }
+                auto it = leaf_consumer_counts_.find(input_array_node.get());
+                if (it != leaf_consumer_counts_.end() && --it->second == 0) {
+                    NotifyGradReady(*input_array_node);
                 }
             }
         }
 
-        // Register this graph as backpropped.
-        context.SetBackpropDone(backprop_id_);
-    }
+        // Push the creator op nodes into the queue
+        for (const auto& input_array_node : op_node->input_array_nodes()) {
+            if (input_array_node != nullptr) {
+                PushCreatorOpNode(input_array_node);
+            }
+        }
+        if (is_parallel_) {
+            ReleaseDependencies(*op_node);
+        }
 
-private:
-    // Runs backward functions to compute gradients of input array nodes.
-    std::vector<nonstd::optional<Array>> ComputeInputGradients(const std::shared_ptr<OpNode>& op_node) {
-        // A single op node has multiple backward functions, each of which computes the gradients of a subset of the inputs.
-        // They are responsible for non-overlapping subsets of inputs.
-        // This function calls these backward functions, collects the gradients computed by them and returns the collected gradients.
-        CHAINERX_ASSERT(op_node != nullptr);
+        if (double_backprop_ == DoubleBackpropOption::kDisable) {
+            op_node->Unchain();
+        }
+    }
 
-        // Output array nodes. May be nullptr if the node is gone.
-        std::vector<std::shared_ptr<ArrayNode>> output_array_nodes;
+    // Erases the gradients of the output array nodes of an op node, which are held only during backprop unless the array bodies are alive,
+    // and stops keeping the output array nodes alive.
+    // The op node must be the last consumer of the gradients, which holds since all the op nodes consuming the outputs precede it.
+    void ReleaseOutputGradients(const OpNode& op_node) {
+        auto range = output_array_node_keeper_.equal_range(&op_node);
+        for (auto it = range.first; it != range.second; ++it) {
+            size_t n_removed = array_node_grad_map_.erase(it->second.get());
+            CHAINERX_ASSERT(n_removed > 0);
+        }
+        output_array_node_keeper_.erase(range.first, range.second);
+    }
 
-        // `temp_output_grads` is a set of temporary GradRefs of this op node's output array nodes.
-        // This is used for output array nodes which are either dead at the moment or alive but have not been involved in the preceding
-        // backpropagation.
-        // This vector is just a keeper and not used in any other way. output_grads holds the pointer to it.
-        // These GradRefs are only valid in the backward functions of this op node.
-        // Be careful not to cause reallocation in this vector. Otherwise the pointers would be invalidated.
-        std::vector<internal::GradRef> temp_output_grads;
-        temp_output_grads.reserve(op_node->output_array_nodes().size());
+    // Collects the output array nodes of an op node and the pointers to their gradients.
+    void PrepareOutputGradients(const OpNode& op_node, OutputGradients& output_grads) {
+        output_grads.temp_grads.reserve(op_node.output_array_nodes().size());
 
-        std::vector<internal::GradRef*> output_grads;
-        for (const nonstd::optional<std::weak_ptr<ArrayNode>>& maybe_output_array_node : op_node->output_array_nodes()) {
+        for (const nonstd::optional<std::weak_ptr<ArrayNode>>& maybe_output_array_node : op_node.output_array_nodes()) {
             std::shared_ptr<ArrayNode> output_array_node = maybe_output_array_node.has_value() ? maybe_output_array_node->lock() : nullptr;
 
             // Get the pointer to the output gradient.
@@ -193,21 +432,38 @@ private:
                 if (it != array_node_grad_map_.end()) {
                     // The grad mapping has the gradient for the array node.
                     // Keep a pointer to the gradient in the map.
-                    output_grads.emplace_back(&it->second);
+                    output_grads.grads.emplace_back(&it->second);
                 } else {
                     // The grad mapping has no entry for the array node.
                     // Create a new entry in temporary gradients and keep a pointer to it.
-                    temp_output_grads.emplace_back(*output_array_node);
-                    output_grads.emplace_back(&temp_output_grads.back());
+                    output_grads.temp_grads.emplace_back(*output_array_node);
+                    output_grads.grads.emplace_back(&output_grads.temp_grads.back());
                 }
             } else {
                 // Output array node is dead.
                 // Keep a pointer to the temporary gradient vector.
-                temp_output_grads.emplace_back(nonstd::nullopt);
-                output_grads.emplace_back(&temp_output_grads.back());
+                output_grads.temp_grads.emplace_back(nonstd::nullopt);
+                output_grads.grads.emplace_back(&output_grads.temp_grads.back());
             }
 
-            output_array_nodes.emplace_back(std::move(output_array_node));
+            output_grads.array_nodes.emplace_back(std::move(output_array_node));
+        }
+    }
+
+    // Runs backward functions to compute gradients of input array nodes.
+    // This function may be called from worker threads; it must not touch the state of this object other than the given op node.
+    std::vector<nonstd::optional<Array>> CallBackwardFunctions(const std::shared_ptr<OpNode>& op_node, OutputGradients& output_grads) {
+        // A single op node has multiple backward functions, each of which computes the gradients of a subset of the inputs.
+        // They are responsible for non-overlapping subsets of inputs.
+        // This function calls these backward functions, collects the gradients computed by them and returns the collected gradients.
+        CHAINERX_ASSERT(op_node != nullptr);
+
+        ProfileRange profile_range{"backward", op_node->name().c_str()};
+        if (profile_range.is_active()) {
+            // Inputs of backward functions are the output gradients.
+            for (size_t i = 0; i < op_node->output_array_node_count(); ++i) {
+                profile_range.AddInputShape(op_node->GetOutputArrayProps(i).shape);
+            }
         }
 
         // Call the backward functions and collects their gradients.
@@ -216,9 +472,22 @@ private:
 
         for (const internal::OpNodeBackwardEntry& backward_entry : op_node->backward_entries()) {
             // Compute and set gradients at the appropriate indices.
-            CallBackwardForSubsetOfInputGradients(op_node, backward_entry, output_array_nodes, input_grads, output_grads);
+            CallBackwardForSubsetOfInputGradients(op_node, backward_entry, output_grads.array_nodes, input_grads, output_grads.grads);
+        }
+
+        // Release the retained arrays as soon as possible, rather than when the op node is completed, which may be deferred in parallel
+        // execution.
+        if (double_backprop_ == DoubleBackpropOption::kDisable) {
+            op_node->ReleaseBackwardEntries();
         }
 
+        return input_grads;
+    }
+
+    // Cleans up the gradients after the backward functions of an op node are called.
+    void FinalizeInputGradients(const OutputGradients& output_grads, std::vector<nonstd::optional<Array>>& input_grads) {
+        const std::vector<std::shared_ptr<ArrayNode>>& output_array_nodes = output_grads.array_nodes;
+
         // Make a view if the input gradient whose array body is identical to one of other output or input gradients.
         // Otherwise modifying operations such as requiring grad on one gradient would be transferred to other gradients.
         // TODO(niboshi): View is needed to make new nodes. Come up with a solution to avoid extra backward insertion.
@@ -247,11 +516,6 @@ private:
                 }
             }
         }
-
-        // Erase processed OpNode from the map
-        output_array_node_keeper_.erase(op_node.get());
-
-        return input_grads;
     }
 
     // Calls a single backward function that computes a subset of the gradients and returns the result.
@@ -346,12 +610,16 @@ private:
                 // Retrieve the pointer to the input gradient.
                 internal::GradRef& input_grad = array_node_grad_map_.at(input_array_nodes[i].get());
                 try {
-                    internal::AccumulateGrad(
-                            input_grad.get(),
-                            std::move(*gx),
-                            input_array_node.shape(),
-                            input_array_node.dtype(),
-                            input_array_node.device());
+                    // Gradients must be kept intact if the backward computation itself is backpropped.
+                    if (internal::AccumulateGrad(
+                                input_grad.get(),
+                                std::move(*gx),
+                                input_array_node.shape(),
+                                input_array_node.dtype(),
+                                input_array_node.device(),
+                                double_backprop_ == DoubleBackpropOption::kDisable)) {
+                        ++t_inplace_grad_accumulation_count;
+                    }
                 } catch (const GradientError& e) {
                     // TODO(niboshi): Use std::nested_exception
                     throw GradientError{e.what(), " Op: ", op_node.name()};
@@ -375,16 +643,190 @@ private:
                 output_array_node_keeper_.emplace(creator_op_node.get(), array_node);  // Iterators are invalidated here.
                 if (is_first_visit) {
                     // First appearance of this op node. Push it to the queue.
-                    candidate_op_nodes_.push_back(std::move(creator_op_node));
-                    std::push_heap(candidate_op_nodes_.begin(), candidate_op_nodes_.end(), OpNodeComparator{});
+                    if (is_parallel_) {
+                        const OpNodeDependency& dependency = op_node_dependencies_.at(creator_op_node.get());
+                        if (dependency.count > 0) {
+                            // Wait for the rest of the consumers. See ReleaseDependencies().
+                            pending_op_nodes_.emplace(creator_op_node.get(), std::move(creator_op_node));
+                        } else {
+                            ready_op_nodes_.emplace(dependency.order, std::move(creator_op_node));
+                        }
+                    } else {
+                        candidate_op_nodes_.push_back(std::move(creator_op_node));
+                        std::push_heap(candidate_op_nodes_.begin(), candidate_op_nodes_.end(), OpNodeComparator{});
+                    }
+                }
+            }
+        }
+    }
+
+    // Collects the dependencies between the op nodes reachable from the output array nodes.
+    // Returns false if the graph cannot be backpropped in parallel.
+    bool CollectOpNodeDependencies() {
+        // Gradients connected to any graph would make the backward functions build graphs concurrently.
+        for (const std::shared_ptr<ArrayNode>& array_node : output_array_nodes_) {
+            const nonstd::optional<Array>& grad = array_node_grad_map_.at(array_node.get()).get();
+            if (!internal::GetArrayBody(*grad)->nodes().empty()) {
+                return false;
+            }
+        }
+
+        std::vector<OpNode*> stack{};
+        auto visit = [this, &stack](OpNode* op_node) {
+            if (op_node_dependencies_.emplace(op_node, OpNodeDependency{}).second) {
+                stack.emplace_back(op_node);
+            }
+        };
+
+        for (const std::shared_ptr<ArrayNode>& array_node : output_array_nodes_) {
+            if (const std::shared_ptr<OpNode>& creator_op_node = array_node->creator_op_node()) {
+                visit(creator_op_node.get());
+            }
+        }
+        while (!stack.empty()) {
+            OpNode* op_node = stack.back();
+            stack.pop_back();
+
+            // Op nodes connected to outer graphs would build the outer graphs in the backward functions.
+            if (!op_node->outer_graphs_input_array_nodes().empty() || !op_node->outer_graphs_output_array_nodes().empty()) {
+                op_node_dependencies_.clear();
+                return false;
+            }
+
+            for (const std::shared_ptr<ArrayNode>& input_array_node : op_node->input_array_nodes()) {
+                if (input_array_node == nullptr) {
+                    continue;
+                }
+                if (const std::shared_ptr<OpNode>& creator_op_node = input_array_node->creator_op_node()) {
+                    visit(creator_op_node.get());
+                    ++op_node_dependencies_[creator_op_node.get()].count;
+                    op_node_dependencies_[op_node].producers.emplace_back(creator_op_node.get());
                 }
             }
         }
+
+        AssignSequentialOrder();
+        return true;
     }
 
+    // Numbers the op nodes in the order in which RunSequential() would process them, by replaying the same heap operations.
+    void AssignSequentialOrder() {
+        struct RankComparator {
+            bool operator()(const OpNode* lhs, const OpNode* rhs) const { return lhs->rank() < rhs->rank(); }
+        };
+
+        std::vector<OpNode*> heap{};
+        std::unordered_set<const OpNode*> visited{};
+        auto push = [&heap, &visited](const std::shared_ptr<OpNode>& op_node) {
+            if (op_node != nullptr && visited.emplace(op_node.get()).second) {
+                heap.emplace_back(op_node.get());
+                std::push_heap(heap.begin(), heap.end(), RankComparator{});
+            }
+        };
+
+        for (const std::shared_ptr<ArrayNode>& array_node : output_array_nodes_) {
+            push(array_node->creator_op_node());
+        }
+        for (size_t order = 0; !heap.empty(); ++order) {
+            std::pop_heap(heap.begin(), heap.end(), RankComparator{});
+            OpNode* op_node = heap.back();
+            heap.pop_back();
+
+            op_node_dependencies_.at(op_node).order = order;
+            for (const std::shared_ptr<ArrayNode>& input_array_node : op_node->input_array_nodes()) {
+                if (input_array_node != nullptr) {
+                    push(input_array_node->creator_op_node());
+                }
+            }
+        }
+        CHAINERX_ASSERT(visited.size() == op_node_dependencies_.size());
+    }
+
+    // Counts the edges from the op nodes reachable from the output array nodes to each leaf array node.
+    // Output array nodes which are leaves and consumed by no op node are notified immediately.
+    void CollectLeafConsumerCounts() {
+        std::vector<const OpNode*> stack{};
+        std::unordered_set<const OpNode*> visited{};
+        auto visit = [&stack, &visited](const ArrayNode& array_node) {
+            std::shared_ptr<const OpNode> creator_op_node = array_node.creator_op_node();
+            if (creator_op_node != nullptr && visited.emplace(creator_op_node.get()).second) {
+                stack.emplace_back(creator_op_node.get());
+            }
+        };
+
+        for (const std::shared_ptr<ArrayNode>& array_node : output_array_nodes_) {
+            visit(*array_node);
+        }
+        while (!stack.empty()) {
+            const OpNode* op_node = stack.back();
+            stack.pop_back();
+            for (const std::shared_ptr<ArrayNode>& input_array_node : op_node->input_array_nodes()) {
+                if (input_array_node == nullptr) {
+                    continue;
+                }
+                if (input_array_node->creator_op_node() == nullptr) {
+                    ++leaf_consumer_counts_[input_array_node.get()];
+                } else {
+                    visit(*input_array_node);
+                }
+            }
+        }
+
+        for (const std::shared_ptr<ArrayNode>& array_node : output_array_nodes_) {
+            if (array_node->creator_op_node() == nullptr && leaf_consumer_counts_.count(array_node.get()) == 0) {
+                NotifyGradReady(*array_node);
+            }
+        }
+    }
+
+    // Calls the hook with the gradient of a leaf array node, which must be final.
+    void NotifyGradReady(ArrayNode& array_node) {
+        std::shared_ptr<ArrayBody> body = array_node.weak_body().lock();
+        if (body == nullptr) {
+            return;
+        }
+        const nonstd::optional<Array>& grad = array_node_grad_map_.at(&array_node).get();
+        if (!grad.has_value()) {
+            return;
+        }
+        grad_ready_hook_(Array{std::move(body)}, *grad);
+    }
+
+    // Makes the op nodes creating the inputs of the given op node ready if the given one was their last remaining consumer.
+    void ReleaseDependencies(const OpNode& op_node) {
+        auto it = op_node_dependencies_.find(&op_node);
+        CHAINERX_ASSERT(it != op_node_dependencies_.end());
+        for (OpNode* producer : it->second.producers) {
+            OpNodeDependency& dependency = op_node_dependencies_.at(producer);
+            CHAINERX_ASSERT(dependency.count > 0);
+            if (--dependency.count == 0) {
+                auto pending_it = pending_op_nodes_.find(producer);
+                CHAINERX_ASSERT(pending_it != pending_op_nodes_.end());
+                ready_op_nodes_.emplace(dependency.order, std::move(pending_it->second));
+                pending_op_nodes_.erase(pending_it);
+            }
+        }
+        op_node_dependencies_.erase(it);
+    }
+
+    // Number of remaining edges from the op nodes consuming each leaf array node. Only used if the hook is set.
+    std::unordered_map<ArrayNode*, size_t> leaf_consumer_counts_;
+
     // Op nodes to be visited. This is a max heap ordered by the rank of each op node (see OpNodeComparator).
     std::vector<std::shared_ptr<OpNode>> candidate_op_nodes_;
 
+    // Whether the op nodes are processed in parallel. See RunParallel().
+    bool is_parallel_{false};
+
+    // Dependencies of op nodes which are not completed yet. Only used in parallel execution.
+    std::unordered_map<const OpNode*, OpNodeDependency> op_node_dependencies_;
+
+    // Op nodes which have been visited but still wait for some of their consumers. Only used in parallel execution.
+    std::unordered_map<const OpNode*, std::shared_ptr<OpNode>> pending_op_nodes_;
+
+    // Op nodes whose consumers are all completed, keyed by their order. Only used in parallel execution.
+    std::map<size_t, std::shared_ptr<OpNode>> ready_op_nodes_;
+
     // This mapping is used to keep output array nodes alive (referenced from op nodes as weak pointers).
     std::unordered_multimap<const OpNode*, std::shared_ptr<ArrayNode>> output_array_node_keeper_;
 
@@ -399,11 +841,38 @@ private:
     const BackpropId& backprop_id_;
     DoubleBackpropOption double_backprop_;
 
+    GradReadyHook grad_ready_hook_;
+
     std::vector<BackpropId> backprop_ids_to_stop_gradient_;
 };
 
 }  // namespace
 
+namespace internal {
+
+size_t GetBackwardThreadCount() { return t_backward_thread_count; }
+
+void SetBackwardThreadCount(size_t thread_count) { t_backward_thread_count = thread_count; }
+
+const GradReadyHook& GetGradReadyHook() { return t_grad_ready_hook; }
+
+void SetGradReadyHook(GradReadyHook hook) { t_grad_ready_hook = std::move(hook); }
+
+}  // namespace internal
+
+ParallelBackwardScope::ParallelBackwardScope(size_t thread_count) : orig_{internal::GetBackwardThreadCount()} {
+    if (thread_count == 0) {
+        throw ChainerxError{"The number of threads for parallel backward must be positive."};
+    }
+    internal::SetBackwardThreadCount(thread_count);
+}
+
+GradReadyHookScope::GradReadyHookScope(GradReadyHook hook) : orig_{internal::GetGradReadyHook()} {
+    internal::SetGradReadyHook(std::move(hook));
+}
+
+int64_t GetInplaceGradAccumulationCount() { return t_inplace_grad_accumulation_count; }
+
 void Backward(const Array& output, const nonstd::optional<BackpropId>& backprop_id, DoubleBackpropOption double_backprop) {
     BackpropId actual_backprop_id = internal::GetArrayBackpropId(output, backprop_id);
     std::vector<ConstArrayRef> outputs{output};  // Do not inline it; we need to guarantee that the vector is alive until Run() finishes.
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
 #include <vector>
 
 #include <nonstd/optional.hpp>
@@ -15,19 +19,88 @@ namespace chainerx {
 
 class BackwardContext;
 
+// Function called by Backward() with a leaf array and its gradient. See GradReadyHookScope.
+using GradReadyHook = std::function<void(const Array& array, const Array& grad)>;
+
 namespace internal {
 
 class ArrayBody;
 class ArrayNode;
 
 // Throws GradientError in case of mismatch in gradient array props.
-void AccumulateGrad(nonstd::optional<Array>& target_grad, Array partial_grad, const Shape& shape, Dtype dtype, Device& device);
+//
+// If allow_inplace is true, the partial gradient is added in-place to the target gradient when it is safe to do so, i.e. the target
+// gradient exclusively owns its contiguous data and neither of the gradients is connected to any graph. Otherwise a new array is allocated
+// for the sum. Returns true if the gradient was accumulated in-place.
+bool AccumulateGrad(
+        nonstd::optional<Array>& target_grad, Array partial_grad, const Shape& shape, Dtype dtype, Device& device, bool allow_inplace = false);
 
 // Throws GradientError in case of mismatch in gradient array props.
 void SetGrad(nonstd::optional<Array>& target_grad, Array grad, const Shape& shape, Dtype dtype, Device& device);
 
+// Returns the number of worker threads used by Backward() in the current thread. 0 means sequential execution.
+size_t GetBackwardThreadCount();
+
+// Sets the number of worker threads used by Backward() in the current thread.
+void SetBackwardThreadCount(size_t thread_count);
+
+// Returns the hook called by Backward() in the current thread, which may be empty.
+const GradReadyHook& GetGradReadyHook();
+
+void SetGradReadyHook(GradReadyHook hook);
+
 }  // namespace internal
 
+// Returns the number of gradient accumulations done in-place by Backward() in the current thread so far.
+// Each of them corresponds to an allocation of a gradient array that has been saved.
+int64_t GetInplaceGradAccumulationCount();
+
+// Scope object that makes Backward() in the current thread run backward functions of independent op nodes in parallel by RAII.
+//
+// An op node is dispatched to a worker thread as soon as the backward functions of all op nodes consuming its outputs have finished.
+// Gradients are accumulated in the calling thread in a fixed order that does not depend on the timing of the workers, so the results are
+// deterministic and identical to those of sequential execution. Backward functions must therefore be safe to run concurrently with each
+// other.
+//
+// Backward() falls back to sequential execution if double backprop is enabled or the graph is connected to any other graph.
+class ParallelBackwardScope {
+public:
+    explicit ParallelBackwardScope(size_t thread_count);
+
+    ParallelBackwardScope(const ParallelBackwardScope&) = delete;
+    ParallelBackwardScope(ParallelBackwardScope&&) = delete;
+    ParallelBackwardScope& operator=(const ParallelBackwardScope&) = delete;
+    ParallelBackwardScope& operator=(ParallelBackwardScope&&) = delete;
+
+    ~ParallelBackwardScope() { internal::SetBackwardThreadCount(orig_); }
+
+private:
+    size_t orig_;
+};
+
+// Scope object that makes Backward() in the current thread call a hook as soon as the gradient of each leaf array is final by RAII.
+//
+// A leaf array is an array on the graph that is not created by any op being backpropped, e.g. a parameter. Its gradient is final once the
+// backward functions of all the op nodes consuming it have completed, which allows, for instance, all-reduce of the gradients of
+// parameters to start while the rest of the backward computation is running.
+// The hook is called in the thread calling Backward(), also in parallel backward. Leaf arrays which are no longer alive or have no
+// gradient are skipped. Errors thrown by the hook are propagated from Backward().
+// Backward() called in the backward functions, e.g. that of Checkpoint(), does not call the hook.
+class GradReadyHookScope {
+public:
+    explicit GradReadyHookScope(GradReadyHook hook);
+
+    GradReadyHookScope(const GradReadyHookScope&) = delete;
+    GradReadyHookScope(GradReadyHookScope&&) = delete;
+    GradReadyHookScope& operator=(const GradReadyHookScope&) = delete;
+    GradReadyHookScope& operator=(GradReadyHookScope&&) = delete;
+
+    ~GradReadyHookScope() { internal::SetGradReadyHook(std::move(orig_)); }
+
+private:
+    GradReadyHook orig_;
+};
+
 // Computes the gradients by back propagation.
 //
 // This functions is not thread safe.
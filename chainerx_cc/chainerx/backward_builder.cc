@@ -2,11 +2,10 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <iterator>
 #include <memory>
-#include <tuple>
-#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -58,14 +57,17 @@ void BackwardBuilder::Target::KeepGraphsAndArrayNodesThatRequireDefinition() {
             }
 
             // Add the array node to the mapping
-            auto insert_result = graph_to_input_array_nodes_.emplace(backprop_id, InputArrayNodes{});
-            auto& input_array_nodes = insert_result.first->second;
-            if (insert_result.second) {
+            auto it = std::find_if(
+                    graph_to_input_array_nodes_.begin(), graph_to_input_array_nodes_.end(), [&backprop_id](const auto& pair) {
+                        return pair.first == backprop_id;
+                    });
+            if (it == graph_to_input_array_nodes_.end()) {
                 // New array node for a graph. Fill all array nodes with nullptr.
-                input_array_nodes.resize(builder_.inputs_.size());
+                graph_to_input_array_nodes_.emplace_back(backprop_id, InputArrayNodes(builder_.inputs_.size()));
+                it = std::prev(graph_to_input_array_nodes_.end());
             }
             // Assign valid pointer to the array node.
-            input_array_nodes[input_index] = &input_array_node;
+            it->second[input_index] = &input_array_node;
         }
     }
 
@@ -81,41 +83,37 @@ void BackwardBuilder::Target::KeepGraphsAndArrayNodesThatRequireDefinition() {
     }
 }
 
-void BackwardBuilder::Target::Define(const BackwardFunction& backward_func) {
+void BackwardBuilder::Target::Define(BackwardFunction backward_func) {
     CHAINERX_ASSERT(is_definition_required());
 
     // Find/Create an op node for each graph and register the given backward function to each of them.
-    for (const auto& pair : graph_to_input_array_nodes_) {
-        const BackpropId& backprop_id = pair.first;
-        const InputArrayNodes& input_array_nodes = pair.second;
-
-        std::vector<std::tuple<size_t, std::shared_ptr<ArrayNode>>> temp_input_array_nodes;
-        temp_input_array_nodes.reserve(input_array_nodes.size());
-        std::transform(
-                input_indices_.begin(),
-                input_indices_.end(),
-                std::back_inserter(temp_input_array_nodes),
-                [&input_array_nodes](size_t input_index) {
-                    const std::shared_ptr<ArrayNode>* array_node = input_array_nodes[input_index];
-                    return std::make_tuple(input_index, array_node == nullptr ? nullptr : *array_node);
-                });
+    for (auto it = graph_to_input_array_nodes_.begin(); it != graph_to_input_array_nodes_.end(); ++it) {
+        const BackpropId& backprop_id = it->first;
+        const InputArrayNodes& input_array_nodes = it->second;
 
         std::shared_ptr<OpNode>& op_node = builder_.FindOrCreateOpNode(backprop_id);
-        op_node->RegisterBackwardFunction(std::move(temp_input_array_nodes), backward_func);
+        if (std::next(it) == graph_to_input_array_nodes_.end()) {
+            // The last graph takes over the indices and the function so that they are never copied in the most common case of a single
+            // graph.
+            op_node->RegisterBackwardFunction(std::move(input_indices_), input_array_nodes, std::move(backward_func));
+        } else {
+            op_node->RegisterBackwardFunction(input_indices_, input_array_nodes, backward_func);
+        }
     }
 }
 
 BackwardBuilder::BackwardBuilder(const char* op_name, std::vector<ConstArrayRef> inputs, std::vector<ConstArrayRef> outputs)
     : op_name_{op_name},
       context_{inputs.front().get().context()},
+      is_inference_mode_{IsInferenceMode()},
       inputs_{std::move(inputs)},
-      inputs_target_created_(inputs_.size()),
+      inputs_target_created_(is_inference_mode_ || !CHAINERX_DEBUG ? 0 : inputs_.size()),
       outputs_{std::move(outputs)},
       input_retention_record_{inputs_.size()},
       output_retention_record_{outputs_.size()} {
     CHAINERX_ASSERT(!inputs_.empty());
     CHAINERX_ASSERT(!outputs_.empty());
-    CHAINERX_ASSERT(inputs_.size() == inputs_target_created_.size());
+    CHAINERX_ASSERT(is_inference_mode_ || inputs_.size() == inputs_target_created_.size());
     // Outputs requiring grad (e.g. in-place ops.) must have been detected and reported before reaching here.
     CHAINERX_ASSERT(std::all_of(
             outputs_.begin(), outputs_.end(), [](const Array& output) { return internal::GetArrayBody(output)->nodes().empty(); }));
@@ -126,21 +124,31 @@ BackwardBuilder::BackwardBuilder(const char* op_name, std::vector<ConstArrayRef>
     CHAINERX_ASSERT(std::all_of(
             inputs_.begin(), inputs_.end(), [this](const Array& input) { return &inputs_.begin()->get().device() == &input.device(); }));
 
-    has_any_applicable_outputs_ =
-            std::any_of(outputs_.begin(), outputs_.end(), [](const Array& output) { return GetKind(output.dtype()) == DtypeKind::kFloat; });
+    has_any_applicable_outputs_ = !is_inference_mode_ && std::any_of(outputs_.begin(), outputs_.end(), [](const Array& output) {
+        return GetKind(output.dtype()) == DtypeKind::kFloat;
+    });
 }
 
 std::shared_ptr<OpNode>& BackwardBuilder::FindOrCreateOpNode(const BackpropId& backprop_id) {
     // Try to find an existing op node for the given graph.
-    auto insert_result = op_node_map_.emplace(backprop_id, nullptr);
+    auto it = std::find_if(
+            op_node_map_.begin(), op_node_map_.end(), [&backprop_id](const auto& pair) { return pair.first == backprop_id; });
 
     // If not found, create a new one.
-    if (insert_result.second) {
-        insert_result.first->second = OpNode::CreateWithOutputArrayNodes(op_name_, backprop_id, inputs_.size(), outputs_);
+    if (it == op_node_map_.end()) {
+        op_node_map_.emplace_back(backprop_id, OpNode::CreateWithOutputArrayNodes(op_name_, backprop_id, inputs_.size(), outputs_));
+        it = std::prev(op_node_map_.end());
     }
 
     CHAINERX_ASSERT(!op_node_map_.empty());
-    return insert_result.first->second;
+    return it->second;
+}
+
+OpNode& BackwardBuilder::GetOpNode(const BackpropId& backprop_id) {
+    auto it = std::find_if(
+            op_node_map_.begin(), op_node_map_.end(), [&backprop_id](const auto& pair) { return pair.first == backprop_id; });
+    CHAINERX_ASSERT(it != op_node_map_.end());
+    return *it->second;
 }
 
 RetainedInputToken BackwardBuilder::RetainInput(size_t input_index) {
@@ -162,6 +170,10 @@ void BackwardBuilder::Finalize() {
 
     AddEdgesFromOpNodeToArrayNodeOfOuterGraphsForRetention();
 
+    if (input_retention_record_.IsAnyRecorded() || output_retention_record_.IsAnyRecorded()) {
+        SetRetentionFlags();
+    }
+
     // Connect each pair of backprop IDs concerned in this op.
     // If two backprop IDs are connected, backpropping on the one with lower ordinal will prohibit future backprop on the other.
     ConnectBackpropIds();
@@ -230,10 +242,10 @@ void BackwardBuilder::AddEdgesFromOpNodeToArrayNodeOfOuterGraphsForRetention() {
 
         // Add edges to the input array nodes belonging to the collected graphs.
         for (const BackpropId& backprop_id : retained_graphs) {
-            const OpNode& op_node = *op_node_map_.at(backprop_id);
+            const OpNode& op_node = GetOpNode(backprop_id);
             for (const BackpropId& other_backprop_id : retained_graphs) {
                 if (backprop_id < other_backprop_id) {
-                    OpNode& other_op_node = *op_node_map_.at(other_backprop_id);
+                    OpNode& other_op_node = GetOpNode(other_backprop_id);
                     AddEdgesFromOpNodeToInputArrayNodesOfOuterGraph(op_node, other_op_node, input_retention_record_);
                 }
             }
@@ -256,6 +268,24 @@ void BackwardBuilder::AddEdgesFromOpNodeToArrayNodeOfOuterGraphsForRetention() {
     }
 }
 
+void BackwardBuilder::SetRetentionFlags() {
+    std::vector<int8_t> input_flags = input_retention_record_.TakeFlags();
+    std::vector<int8_t> output_flags = output_retention_record_.TakeFlags();
+    std::vector<internal::RetainedBuffer> input_buffers{};
+    for (size_t i = 0; i < input_flags.size(); ++i) {
+        if (input_flags[i] != 0) {
+            input_buffers.emplace_back(*internal::GetArrayBody(gsl::at(inputs_, i)));
+        }
+    }
+    for (auto it = op_node_map_.begin(); it != op_node_map_.end(); ++it) {
+        if (std::next(it) == op_node_map_.end()) {
+            it->second->SetRetentionFlags(std::move(input_flags), std::move(output_flags), std::move(input_buffers));
+        } else {
+            it->second->SetRetentionFlags(input_flags, output_flags, input_buffers);
+        }
+    }
+}
+
 void BackwardBuilder::ConnectBackpropIds() {
     for (auto it1 = op_node_map_.begin(); it1 != op_node_map_.end(); ++it1) {
         const BackpropId& backprop_id1 = it1->first;
@@ -7,7 +7,7 @@
 #include <memory>
 #include <numeric>
 #include <set>
-#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <gsl/gsl>
@@ -45,6 +45,9 @@ public:
 
     bool IsRecorded(size_t index) const { return static_cast<bool>(flags_[index]); }
 
+    // Moves out the flags, which are empty if nothing is recorded.
+    std::vector<int8_t> TakeFlags() { return std::move(flags_); }
+
 private:
     size_t size_{};
     std::vector<int8_t> flags_{};  // binary flags
@@ -97,7 +100,7 @@ public:
         explicit operator bool() const { return is_definition_required(); }
 
         // Defines a backward function with respect to specified input arrays (target).
-        void Define(const BackwardFunction& backward_func);
+        void Define(BackwardFunction backward_func);
 
         bool is_definition_required() const { return !graph_to_input_array_nodes_.empty(); }
 
@@ -115,8 +118,9 @@ public:
         BackwardBuilder& builder_;
         std::vector<size_t> input_indices_;
 
-        // TODO(hvy): Consider using linear search since elements are usually few.
-        std::unordered_map<BackpropId, InputArrayNodes> graph_to_input_array_nodes_;
+        // Input array nodes grouped by graph.
+        // Graphs are searched linearly since there are usually only a few of them, most often only one.
+        std::vector<std::pair<BackpropId, InputArrayNodes>> graph_to_input_array_nodes_;
     };
 
     // TODO(niboshi): Add an overload to accept `const std::vector<Array>&` as `inputs` and `outputs`
@@ -133,22 +137,38 @@ public:
 
     // Creates a backward target for the specified inputs.
     Target CreateTarget(std::vector<size_t> input_indices) {
+        if (is_inference_mode_) {
+            return Target{*this, {}};
+        }
+
         // input_indices shouldn't have duplicates.
         CHAINERX_ASSERT((std::set<size_t>{input_indices.begin(), input_indices.end()}.size() == input_indices.size()));
 
         for (size_t input_index : input_indices) {
-            CHAINERX_ASSERT(input_index < inputs_target_created_.size());
-            CHAINERX_ASSERT(!inputs_target_created_[input_index]);
-            inputs_target_created_[input_index] = true;
+            MarkTargetCreated(input_index);
         }
         return Target{*this, std::move(input_indices)};
     }
 
     // Creates a backward target for the specified input.
-    Target CreateTarget(size_t input_index) { return CreateTarget(std::vector<size_t>{input_index}); }
+    Target CreateTarget(size_t input_index) {
+        if (is_inference_mode_) {
+            return Target{*this, {}};
+        }
+        if (!has_any_applicable_outputs_ || internal::GetArrayBody(gsl::at(inputs_, input_index))->nodes().empty()) {
+            // No definition is required. Avoid allocating the indices, since this is the most common case when no graph is constructed.
+            MarkTargetCreated(input_index);
+            return Target{*this, {}};
+        }
+        return CreateTarget(std::vector<size_t>{input_index});
+    }
 
     // Creates a backward target for all the inputs.
     Target CreateTarget() {
+        if (is_inference_mode_) {
+            return Target{*this, {}};
+        }
+
         std::vector<size_t> input_indices;
         input_indices.resize(inputs_.size());
         std::iota(input_indices.begin(), input_indices.end(), size_t{0});
@@ -186,6 +206,9 @@ private:
     // Edges from output nodes to the op node are connected.
     std::shared_ptr<internal::OpNode>& FindOrCreateOpNode(const BackpropId& backprop_id);
 
+    // Returns the op node for a specific graph, which must have been created.
+    internal::OpNode& GetOpNode(const BackpropId& backprop_id);
+
     // Add shared ptrs between op nodes and array nodes belonging to outer graphs.
     // This functions is called once when the builder is finalized.
     // These references are required to restore retained inputs/outputs.
@@ -193,16 +216,31 @@ private:
 
     void ConnectBackpropIds();
 
+    // Records that a target has been created for the input, which is checked in Finalize() in debug builds.
+    void MarkTargetCreated(size_t input_index) {
+        if (CHAINERX_DEBUG) {
+            CHAINERX_ASSERT(input_index < inputs_target_created_.size());
+            CHAINERX_ASSERT(!inputs_target_created_[input_index]);
+            inputs_target_created_[input_index] = true;
+        }
+    }
+
+    // Passes the retention flags to all op nodes, so that the memory held by graphs can be inspected.
+    void SetRetentionFlags();
+
     const char* op_name_;
 
     Context& context_;
 
+    // Whether the builder was created in inference mode, in which case no graph is constructed and all targets are empty.
+    bool is_inference_mode_;
+
     // Input arrays of the op.
     std::vector<ConstArrayRef> inputs_;
 
     // Flags indicating whether CreateTarget has been called for each of the input arrays.
     // All of these flags must be true after all the backwards have been defined for a BackwardBuilder.
-    // This can be checked by calling is_complete();
+    // They are only used for assertions, so they are left empty in release builds to save an allocation per op.
     std::vector<bool> inputs_target_created_;
 
     // Output arrays of the op.
@@ -210,7 +248,8 @@ private:
 
     // A collection of op nodes, each of which corresponds to a graph.
     // This record is increasingly populated as new graphs are encountered in multiple Define() calls.
-    std::unordered_map<BackpropId, std::shared_ptr<internal::OpNode>> op_node_map_;
+    // Graphs are searched linearly as in Target.
+    std::vector<std::pair<BackpropId, std::shared_ptr<internal::OpNode>>> op_node_map_;
 
     backward_builder_detail::RetentionRecord input_retention_record_;
     backward_builder_detail::RetentionRecord output_retention_record_;
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include "chainerx/array.h"
+#include "chainerx/backprop_mode.h"
 #include "chainerx/backward.h"
 #include "chainerx/backward_context.h"
 #include "chainerx/dtype.h"
@@ -67,6 +68,24 @@ TEST(BackwardBuilderTest, FloatToInt_PartiallyBackproppable) {
     Backward(y2);
 }
 
+TEST(BackwardBuilderTest, InferenceMode) {
+    testing::ContextSession context_session;
+
+    Array x = Ones({2, 3}, Dtype::kFloat32).RequireGrad();
+    Array y = Ones({2, 3}, Dtype::kFloat32);
+    {
+        InferenceModeScope scope{};
+        BackwardBuilder bb{"forward", x, y};
+        EXPECT_FALSE(static_cast<bool>(bb.CreateTarget(0)));
+        bb.Finalize();
+
+        Array z = x * x;
+        EXPECT_FALSE(z.IsBackpropRequired());
+    }
+    EXPECT_FALSE(y.IsBackpropRequired());
+    EXPECT_TRUE((x * x).IsBackpropRequired());
+}
+
 TEST(BackwardBuilderTest, FloatToInt_GetIntRetainOutputFirstParam) {
     testing::ContextSession context_session;
     Shape shape{2, 3};
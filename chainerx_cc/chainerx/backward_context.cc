@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -114,6 +115,10 @@ Array& BackwardContext::input_grad(size_t index) { return gsl::at(input_grads_,
 
 namespace {
 
+// Serializes the fabrication of retained input array bodies.
+// An input array node may be shared by op nodes whose backward functions run in parallel (see ParallelBackwardScope).
+std::mutex g_retained_input_mutex;
+
 // Returns the pointers to array nodes for all graphs in the input array corresponding to the input_index.
 // The raw pointers (not std::shared_ptr) are never null.
 // TODO(hvy): Consider implementing this an OpNode member function.
@@ -144,6 +149,8 @@ Array BackwardContext::GetRetainedInput(const RetainedInputToken& token) {
     std::shared_ptr<ArrayBody>& kept_body = gsl::at(retained_input_array_bodies_, input_index);
 
     if (kept_body == nullptr) {
+        std::lock_guard<std::mutex> lock{g_retained_input_mutex};
+
         // Array nodes corresponding to the input_index for all graphs.
         std::vector<const std::shared_ptr<ArrayNode>*> input_array_nodes = GetInputArrayNodesForIndex(*op_node_, input_index);
 
@@ -1,9 +1,13 @@
 #include "chainerx/backward.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -18,12 +22,15 @@
 #include "chainerx/backward_context.h"
 #include "chainerx/check_backward.h"
 #include "chainerx/context.h"
+#include "chainerx/device.h"
 #include "chainerx/device_id.h"
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
 #include "chainerx/native/native_backend.h"
+#include "chainerx/native/native_device.h"
 #include "chainerx/op_node.h"
+#include "chainerx/routines/connection.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/math.h"
 #include "chainerx/shape.h"
@@ -129,6 +136,8 @@ public:
 
     template <typename T>
     void ExpectDataEqual(const Array& expected, const Array& actual) const {
+        expected.device().Synchronize();
+        actual.device().Synchronize();
         auto total_size = expected.shape().GetTotalSize();
         auto expected_data = static_cast<const T*>(expected.data().get());
         auto actual_data = static_cast<const T*>(actual.data().get());
@@ -553,6 +562,308 @@ TEST_F(BackpropTest, BackwardGivenOutputGrad) {
     CheckBackpropSingleElementExtraInputs({2.0f}, {3.0f}, {6.0f}, fprop);
 }
 
+TEST_F(BackpropTest, BackwardInplaceGradAccumulation) {
+    Array x = (*testing::BuildArray({2}).WithData<float>({1.f, 2.f})).RequireGrad();
+    Array a = x * x;  // a is consumed by two ops.
+    Array y = a * a + a;
+
+    int64_t count = GetInplaceGradAccumulationCount();
+    Backward(y);
+    EXPECT_LT(count, GetInplaceGradAccumulationCount());
+    // dy/dx = (2a + 1) * 2x
+    EXPECT_ARRAY_EQ(testing::BuildArray({2}).WithData<float>({6.f, 36.f}), *x.GetGrad());
+}
+
+TEST_F(BackpropTest, BackwardInplaceGradAccumulationUserHeldGrad) {
+    Array x = (*testing::BuildArray({2}).WithData<float>({1.f, 2.f})).RequireGrad();
+    Array gx = testing::BuildArray({2}).WithData<float>({1.f, 1.f});
+    x.SetGrad(gx);
+    Array y = x * 3;
+
+    int64_t count = GetInplaceGradAccumulationCount();
+    Backward(y);
+    EXPECT_EQ(count, GetInplaceGradAccumulationCount());
+    EXPECT_ARRAY_EQ(testing::BuildArray({2}).WithData<float>({4.f, 4.f}), *x.GetGrad());
+    // The gradient held by the user is not modified.
+    EXPECT_ARRAY_EQ(testing::BuildArray({2}).WithData<float>({1.f, 1.f}), gx);
+}
+
+TEST_F(BackpropTest, BackwardInplaceGradAccumulationDoubleBackprop) {
+    Array x = (*testing::BuildArray({2}).WithData<float>({1.f, 2.f})).RequireGrad();
+    Array a = x * x;
+    Array y = a * a + a;
+
+    int64_t count = GetInplaceGradAccumulationCount();
+    Backward(y, nonstd::nullopt, DoubleBackpropOption::kEnable);
+    EXPECT_EQ(count, GetInplaceGradAccumulationCount());
+    EXPECT_ARRAY_EQ(testing::BuildArray({2}).WithData<float>({6.f, 36.f}), *x.GetGrad());
+}
+
+// Builds a graph with many independent branches sharing the input, some of which retain dead intermediate arrays.
+Array ForwardBranches(const Array& x) {
+    Array y = ZerosLike(x);
+    for (int i = 0; i < 8; ++i) {
+        Array a = x * (i + 1);
+        y = y + a * a + Log(a) + Exp(x * 0.1f * i);
+    }
+    return Sum(y);
+}
+
+TEST_F(BackpropTest, ParallelBackward) {
+    Array x1 = (*testing::BuildArray({2, 3}).WithLinearData<float>(1.f)).RequireGrad();
+    Backward(ForwardBranches(x1));
+
+    for (size_t thread_count : {1, 2, 4}) {
+        Array x2 = (*testing::BuildArray({2, 3}).WithLinearData<float>(1.f)).RequireGrad();
+        {
+            ParallelBackwardScope scope{thread_count};
+            Backward(ForwardBranches(x2));
+        }
+        // Parallel execution gives exactly the same result as sequential execution.
+        EXPECT_ARRAY_EQ(*x1.GetGrad(), *x2.GetGrad());
+    }
+}
+
+TEST_F(BackpropTest, ParallelBackwardMultipleOutputs) {
+    Array x1 = (*testing::BuildArray({2}).WithData<float>({1.f, 2.f})).RequireGrad();
+    Array x2 = (*testing::BuildArray({2}).WithData<float>({3.f, 4.f})).RequireGrad();
+    Array y1 = x1 * x2;
+    Array y2 = y1 * x1;  // y1 is both an output and an intermediate array.
+
+    ParallelBackwardScope scope{4};
+    Backward({y1, y2});
+    // gx1 = x2 + 2 * x1 * x2, gx2 = x1 + x1 * x1
+    EXPECT_ARRAY_EQ(testing::BuildArray({2}).WithData<float>({9.f, 20.f}), *x1.GetGrad());
+    EXPECT_ARRAY_EQ(testing::BuildArray({2}).WithData<float>({2.f, 6.f}), *x2.GetGrad());
+}
+
+TEST_F(BackpropTest, ParallelBackwardError) {
+    Array x = (*testing::BuildArray({2}).WithData<float>({1.f, 2.f})).RequireGrad();
+    Array y = EmptyLike(x);
+    {
+        BackwardBuilder bb{"throwing", x, y};
+        bb.CreateTarget(0).Define([](BackwardContext& /*bctx*/) { throw ChainerxError{"foo"}; });
+        bb.Finalize();
+    }
+
+    ParallelBackwardScope scope{2};
+    EXPECT_THROW(Backward(y * x + Exp(x)), ChainerxError);
+}
+
+TEST_F(BackpropTest, ParallelBackwardDoubleBackprop) {
+    Array x = (*testing::BuildArray({2}).WithData<float>({1.f, 2.f})).RequireGrad();
+    Array y = x * x * x;
+
+    // Double backprop falls back to sequential execution.
+    ParallelBackwardScope scope{2};
+    Backward(y, nonstd::nullopt, DoubleBackpropOption::kEnable);
+    Array gx = *x.GetGrad();
+    x.ClearGrad();
+    Backward(gx);
+    EXPECT_ARRAY_EQ(testing::BuildArray({2}).WithData<float>({6.f, 12.f}), *x.GetGrad());
+}
+
+TEST_F(BackpropTest, ParallelBackwardScope) {
+    EXPECT_EQ(size_t{0}, internal::GetBackwardThreadCount());
+    {
+        ParallelBackwardScope scope1{2};
+        EXPECT_EQ(size_t{2}, internal::GetBackwardThreadCount());
+        {
+            ParallelBackwardScope scope2{3};
+            EXPECT_EQ(size_t{3}, internal::GetBackwardThreadCount());
+        }
+        EXPECT_EQ(size_t{2}, internal::GetBackwardThreadCount());
+    }
+    EXPECT_EQ(size_t{0}, internal::GetBackwardThreadCount());
+    EXPECT_THROW(ParallelBackwardScope{0}, ChainerxError);
+}
+
+TEST_F(BackpropTest, GradReadyHook) {
+    Array x1 = (*testing::BuildArray({2}).WithData<float>({1.f, 2.f})).RequireGrad();
+    Array x2 = (*testing::BuildArray({2}).WithData<float>({3.f, 4.f})).RequireGrad();
+    Array x3 = (*testing::BuildArray({2}).WithData<float>({5.f, 6.f})).RequireGrad();
+    // x3 is consumed only by the last op, whereas x1 is consumed by the first and the last ones.
+    Array y = (x1 * x2 + x1) * x3;
+
+    std::vector<std::string> events{};
+    std::vector<Array> grads{};
+    auto hook = [&events, &grads, &x1, &x2, &x3](const Array& array, const Array& grad) {
+        EXPECT_TRUE(array.IsGradRequired());
+        for (const auto& pair : {std::make_pair("x1", &x1), std::make_pair("x2", &x2), std::make_pair("x3", &x3)}) {
+            if (internal::GetArrayBody(array) == internal::GetArrayBody(*pair.second)) {
+                events.emplace_back(pair.first);
+            }
+        }
+        grads.emplace_back(grad.Copy());
+    };
+    {
+        GradReadyHookScope scope{hook};
+        Backward(y);
+    }
+
+    // The gradient of x3 is final before the backward of the first ops.
+    ASSERT_EQ((std::vector<std::string>{"x3", "x1", "x2"}), events);
+    EXPECT_ARRAY_EQ(*x3.GetGrad(), grads[0]);
+    EXPECT_ARRAY_EQ(*x1.GetGrad(), grads[1]);
+    EXPECT_ARRAY_EQ(*x2.GetGrad(), grads[2]);
+    EXPECT_FALSE(static_cast<bool>(internal::GetGradReadyHook()));
+}
+
+TEST_F(BackpropTest, GradReadyHookParallel) {
+    Array x1 = (*testing::BuildArray({2, 3}).WithLinearData<float>(1.f)).RequireGrad();
+    Array x2 = (*testing::BuildArray({2, 3}).WithLinearData<float>(1.f)).RequireGrad();
+    Array y = ForwardBranches(x1) + Sum(x2);
+
+    int count = 0;
+    GradReadyHookScope scope{[&count, &x1](const Array& array, const Array& grad) {
+        // The hook is called once per leaf array, also for an array consumed by many ops.
+        ++count;
+        if (internal::GetArrayBody(array) == internal::GetArrayBody(x1)) {
+            EXPECT_EQ(internal::GetArrayBody(grad), internal::GetArrayBody(*x1.GetGrad()));
+        }
+    }};
+    ParallelBackwardScope parallel_scope{2};
+    Backward(y);
+    EXPECT_EQ(2, count);
+}
+
+TEST_F(BackpropTest, GradReadyHookOutputIsLeaf) {
+    Array x = (*testing::BuildArray({2}).WithData<float>({1.f, 2.f})).RequireGrad();
+
+    int count = 0;
+    GradReadyHookScope scope{[&count](const Array& /*array*/, const Array& grad) {
+        ++count;
+        EXPECT_ARRAY_EQ(testing::BuildArray({2}).WithData<float>({1.f, 1.f}), grad);
+    }};
+    Backward(x);
+    EXPECT_EQ(1, count);
+}
+
+// Native device which tracks the bytes of the live buffers allocated by itself.
+class MemoryTrackingDevice : public native::NativeDevice {
+public:
+    // Kernels are always run synchronously, since pending kernels keep their operands alive and the device is destroyed before the base.
+    MemoryTrackingDevice(native::NativeBackend& backend, int index) : native::NativeDevice{backend, index} { SetAsync(false); }
+
+    std::shared_ptr<void> Allocate(size_t bytesize) override {
+        std::shared_ptr<void> ptr = native::NativeDevice::Allocate(bytesize);
+        if (ptr == nullptr) {
+            return ptr;
+        }
+        {
+            std::lock_guard<std::mutex> lock{mutex_};
+            live_bytes_ += bytesize;
+            peak_bytes_ = std::max(peak_bytes_, live_bytes_);
+        }
+        return std::shared_ptr<void>{ptr.get(), [this, ptr, bytesize](void* /*ptr*/) {
+                                         std::lock_guard<std::mutex> lock{mutex_};
+                                         live_bytes_ -= bytesize;
+                                     }};
+    }
+
+    int64_t live_bytes() {
+        std::lock_guard<std::mutex> lock{mutex_};
+        return live_bytes_;
+    }
+
+    int64_t peak_bytes() {
+        std::lock_guard<std::mutex> lock{mutex_};
+        return peak_bytes_;
+    }
+
+    void ResetPeakBytes() {
+        std::lock_guard<std::mutex> lock{mutex_};
+        peak_bytes_ = live_bytes_;
+    }
+
+private:
+    std::mutex mutex_;
+    int64_t live_bytes_{0};
+    int64_t peak_bytes_{0};
+};
+
+class MemoryTrackingBackend : public native::NativeBackend {
+public:
+    using native::NativeBackend::NativeBackend;
+
+    std::string GetName() const override { return "memory_tracking"; }
+
+private:
+    std::unique_ptr<Device> CreateDevice(int index) override { return std::make_unique<MemoryTrackingDevice>(*this, index); }
+};
+
+class BackpropPeakMemoryTest : public ::testing::TestWithParam<size_t> {};
+
+TEST_P(BackpropPeakMemoryTest, DeepMlp) {
+    constexpr int64_t kBatchSize = 256;
+    constexpr int64_t kWidth = 32;
+    constexpr int64_t kDepth = 16;
+    constexpr int64_t kActivationBytes = kBatchSize * kWidth * sizeof(float);
+    constexpr int64_t kWeightBytes = kWidth * kWidth * sizeof(float);
+
+    Context context{};
+    ContextScope context_scope{context};
+    MemoryTrackingBackend backend{context};
+    auto& device = dynamic_cast<MemoryTrackingDevice&>(backend.GetDevice(0));
+    DeviceScope device_scope{device};
+
+    std::vector<Array> ws{};
+    for (int64_t i = 0; i < kDepth; ++i) {
+        ws.emplace_back(Full({kWidth, kWidth}, 1.f / kWidth).RequireGrad());
+    }
+    Array loss{};
+    {
+        Array h = Ones({kBatchSize, kWidth}, Dtype::kFloat32);
+        for (const Array& w : ws) {
+            h = Maximum(Linear(h, w), 0.f) * 0.5f;
+        }
+        loss = Sum(h);
+    }
+
+    // The forward pass leaves the arrays retained for backward, i.e. the inputs of Linear and Maximum.
+    int64_t retained_bytes = device.live_bytes() - kDepth * kWeightBytes;
+    device.ResetPeakBytes();
+
+    // Pairs of a layer and the live bytes sampled when the gradient of its weight is ready, i.e. after the backward of the layer.
+    std::vector<std::pair<int64_t, int64_t>> samples{};
+    {
+        GradReadyHookScope hook_scope{[&ws, &device, &samples](const Array& array, const Array& /*grad*/) {
+            for (size_t i = 0; i < ws.size(); ++i) {
+                if (internal::GetArrayBody(array) == internal::GetArrayBody(ws[i])) {
+                    samples.emplace_back(static_cast<int64_t>(i), device.live_bytes());
+                }
+            }
+        }};
+        nonstd::optional<ParallelBackwardScope> parallel_scope{};
+        if (GetParam() > 0) {
+            parallel_scope.emplace(GetParam());
+        }
+        Backward(loss);
+    }
+
+    // The two arrays retained by each layer are released once the backward of the layer has run, so the live bytes drop as the backward
+    // proceeds towards the first layer. Besides the weights and the gradients of the processed ones, only the arrays retained by the
+    // remaining layers and the gradients of a few layers may be alive.
+    ASSERT_EQ(static_cast<size_t>(kDepth), samples.size());
+    for (const std::pair<int64_t, int64_t>& sample : samples) {
+        int64_t layer = sample.first;
+        EXPECT_LE(sample.second, kDepth * kWeightBytes + (kDepth - layer) * kWeightBytes + (2 * layer + 6) * kActivationBytes)
+                << "layer: " << layer;
+    }
+    EXPECT_LT(samples.back().second, kDepth * kWeightBytes + retained_bytes / 2);
+
+    // Each op produces more gradients than it retains arrays, so the peak grows with the depth unless the retained arrays and the
+    // intermediate gradients are released as soon as their consumers have run. Only the gradients of a few layers may be alive at a
+    // time, in addition to those of the weights.
+    EXPECT_GE(retained_bytes, 2 * kDepth * kActivationBytes);
+    EXPECT_LE(device.peak_bytes(), kDepth * kWeightBytes + retained_bytes + kDepth * kWeightBytes + 4 * kActivationBytes);
+
+    // Only the weights, the loss and their gradients are left.
+    EXPECT_EQ(2 * kDepth * kWeightBytes + 2 * int64_t{sizeof(float)}, device.live_bytes());
+}
+
+INSTANTIATE_TEST_CASE_P(ThreadCounts, BackpropPeakMemoryTest, ::testing::Values(size_t{0}, size_t{2}));
+
 TEST_F(BackpropTest, MultipleGraphsBasic) {
     Array x1 = Full({1}, 2.0f);
     Array x2 = Full({1}, 5.0f);
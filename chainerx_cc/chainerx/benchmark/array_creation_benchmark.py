@@ -0,0 +1,53 @@
+# Measures the per-call latency of creating small ChainerX arrays from Python
+# objects with chainerx.array and chainerx.asarray.
+#
+# Usage: python array_creation_benchmark.py [iterations]
+
+import array
+import sys
+import timeit
+
+import numpy
+
+import chainerx
+
+
+def run(name, iterations, func):
+    timer = timeit.Timer(func)
+    timer.timeit(iterations // 10)
+    total_ns = timer.timeit(iterations) * 1e9
+    print('{:<32}{:>12.1f} ns/call'.format(name, total_ns / iterations))
+
+
+def run_all(iterations):
+    chainerx.set_default_device('native:0')
+
+    scalar_int = 3
+    scalar_float = 2.5
+    list_1d = [float(i) for i in range(16)]
+    list_2d = [[i * 4 + j for j in range(4)] for i in range(4)]
+    tuple_bool = (True, False) * 8
+    buffer_float = array.array('f', list_1d)
+    numpy_float = numpy.arange(16, dtype=numpy.float32)
+
+    run('array(int)', iterations, lambda: chainerx.array(scalar_int))
+    run('array(float, float32)', iterations,
+        lambda: chainerx.array(scalar_float, 'float32'))
+    run('array(list 16)', iterations, lambda: chainerx.array(list_1d))
+    run('array(list 4x4)', iterations, lambda: chainerx.array(list_2d))
+    run('array(tuple bool 16)', iterations,
+        lambda: chainerx.array(tuple_bool))
+    run('array(array.array 16)', iterations,
+        lambda: chainerx.array(buffer_float))
+    run('asarray(array.array 16)', iterations,
+        lambda: chainerx.asarray(buffer_float))
+    run('array(numpy 16)', iterations, lambda: chainerx.array(numpy_float))
+    run('asarray(numpy 16)', iterations,
+        lambda: chainerx.asarray(numpy_float))
+
+    # Reference: the cost of the NumPy conversion alone.
+    run('numpy.array(list 16)', iterations, lambda: numpy.array(list_1d))
+
+
+if __name__ == '__main__':
+    run_all(int(sys.argv[1]) if len(sys.argv) > 1 else 100000)
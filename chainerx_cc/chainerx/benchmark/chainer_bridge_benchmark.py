@@ -0,0 +1,64 @@
+# Measures the time per training iteration of a small Chainer model on
+# ChainerX arrays, which mixes functions implemented natively in ChainerX and
+# functions bridged to Chainer's FunctionNode implementation.
+#
+# Usage: python chainer_bridge_benchmark.py [iterations]
+
+import sys
+import time
+
+import numpy
+
+import chainer
+import chainer.functions as F
+import chainer.links as L
+
+
+class MLP(chainer.Chain):
+
+    def __init__(self, n_units, n_layers):
+        super(MLP, self).__init__()
+        with self.init_scope():
+            self.layers = chainer.ChainList(
+                *[L.Linear(n_units, n_units) for _ in range(n_layers)])
+
+    def forward(self, x, bridged):
+        h = x
+        for layer in self.layers:
+            h = layer(h)  # native
+            if bridged:
+                # Neither has a ChainerX implementation.
+                h = F.leaky_relu(F.sigmoid(h))
+            else:
+                h = F.tanh(F.relu(h))
+        return F.sum(h)  # native
+
+
+def run(name, iterations, model, x, bridged):
+    def step():
+        model.cleargrads()
+        loss = model(x, bridged)
+        loss.backward()
+
+    for _ in range(iterations // 10):
+        step()
+
+    start = time.perf_counter()
+    for _ in range(iterations):
+        step()
+    total = time.perf_counter() - start
+    print('{:<32}{:>12.1f} us/iter'.format(name, total / iterations * 1e6))
+
+
+def run_all(iterations):
+    model = MLP(8, 4)
+    model.to_chainerx()
+    x = chainer.backend.to_chainerx(
+        numpy.ones((2, 8), dtype=numpy.float32))
+
+    run('native only', iterations, model, x, False)
+    run('native and bridged', iterations, model, x, True)
+
+
+if __name__ == '__main__':
+    run_all(int(sys.argv[1]) if len(sys.argv) > 1 else 1000)
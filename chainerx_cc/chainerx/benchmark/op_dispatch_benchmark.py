@@ -0,0 +1,52 @@
+# Measures the throughput of ndarray operators called from Python on scalars
+# and small arrays, where the cost is dominated by the binding layer.
+#
+# Usage: python op_dispatch_benchmark.py [iterations]
+
+import sys
+import timeit
+
+import chainerx
+
+
+def run(name, iterations, func):
+    timer = timeit.Timer(func)
+    timer.timeit(iterations // 10)
+    total = timer.timeit(iterations)
+    print('{:<32}{:>12.0f} ops/s'.format(name, iterations / total))
+
+
+def run_all(iterations):
+    chainerx.set_default_device('native:0')
+
+    a = chainerx.ones((1,), 'float32')
+    b = chainerx.ones((1,), 'float32')
+    m = chainerx.ones((4, 4), 'float32')
+
+    run('a + b', iterations, lambda: a + b)
+    run('a * b', iterations, lambda: a * b)
+    run('a + 1', iterations, lambda: a + 1)
+    run('a * 0.5', iterations, lambda: a * 0.5)
+    run('1 - a', iterations, lambda: 1 - a)
+    run('a < b', iterations, lambda: a < b)
+    run('a == 0', iterations, lambda: a == 0)
+    run('-a', iterations, lambda: -a)
+    run('m + m (4x4)', iterations, lambda: m + m)
+    run('m * 2 (4x4)', iterations, lambda: m * 2)
+
+    c = chainerx.ones((1,), 'float32')
+
+    def iadd():
+        nonlocal c
+        c += b
+
+    run('c += b', iterations, iadd)
+    run('a.dtype', iterations, lambda: a.dtype)
+
+    with chainerx.backprop_scope('bench') as backprop_id:
+        x = chainerx.ones((1,), 'float32').require_grad(backprop_id)
+        run('x * x (graph)', iterations, lambda: x * x)
+
+
+if __name__ == '__main__':
+    run_all(int(sys.argv[1]) if len(sys.argv) > 1 else 100000)
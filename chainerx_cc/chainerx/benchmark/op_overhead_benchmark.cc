@@ -0,0 +1,144 @@
+// Measures the per-op overhead of ChainerX, i.e. the time spent outside of kernels when operating on tiny arrays.
+//
+// Usage: chainerx_op_overhead_benchmark [iterations]
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/backprop_mode.h"
+#include "chainerx/backprop_scope.h"
+#include "chainerx/backward.h"
+#include "chainerx/context.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/graph_replay.h"
+#include "chainerx/recorded_graph.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/shape.h"
+
+namespace {
+
+// Number of calls to the global operator new, which is replaced below to count the heap allocations per op.
+std::atomic<int64_t> g_allocation_count{0};
+
+}  // namespace
+
+void* operator new(std::size_t size) {
+    g_allocation_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept { std::free(ptr); }
+
+namespace chainerx {
+namespace {
+
+// Runs the given function for the given number of iterations after a warm-up, and prints the average time and number of heap allocations
+// per op.
+void Run(const std::string& name, int64_t iterations, int64_t ops_per_iteration, const std::function<void()>& func) {
+    for (int64_t i = 0; i < iterations / 10; ++i) {
+        func();
+    }
+
+    int64_t start_allocation_count = g_allocation_count.load(std::memory_order_relaxed);
+    auto start = std::chrono::steady_clock::now();
+    for (int64_t i = 0; i < iterations; ++i) {
+        func();
+    }
+    auto end = std::chrono::steady_clock::now();
+    int64_t allocation_count = g_allocation_count.load(std::memory_order_relaxed) - start_allocation_count;
+
+    double total_ns = std::chrono::duration<double, std::nano>(end - start).count();
+    double total_ops = static_cast<double>(iterations * ops_per_iteration);
+    std::cout << std::left << std::setw(32) << name << std::right << std::setw(12) << std::fixed << std::setprecision(1)
+              << total_ns / total_ops << " ns/op" << std::setw(10) << allocation_count / total_ops << " allocs/op" << std::endl;
+}
+
+void RunAll(int64_t iterations) {
+    Context context{};
+    ContextScope context_scope{context};
+    Device& device = context.GetDevice({"native", 0});
+    DeviceScope device_scope{device};
+
+    Array a = Ones({1}, Dtype::kFloat32);
+    Array b = Ones({1}, Dtype::kFloat32);
+
+    Run("add (no graph)", iterations, 1, [&a, &b]() { Array c = a + b; });
+    Run("multiply (no graph)", iterations, 1, [&a, &b]() { Array c = a * b; });
+
+    // Lower bound of the overhead: the device kernel alone, writing to a preallocated output.
+    Array out = EmptyLike(a);
+    Run("add (device call)", iterations, 1, [&device, &a, &b, &out]() { device.Add(a, b, out); });
+
+    {
+        BackpropScope backprop_scope{"bench"};
+        BackpropId backprop_id = backprop_scope.backprop_id();
+        Array x = Ones({1}, Dtype::kFloat32).RequireGrad(backprop_id);
+
+        Run("add (graph)", iterations, 1, [&x, &b]() { Array c = x + b; });
+        Run("multiply (graph)", iterations, 1, [&x, &b]() { Array c = x * b; });
+
+        {
+            NoBackpropModeScope no_backprop_mode_scope{};
+            Run("add (no backprop mode)", iterations, 1, [&x, &b]() { Array c = x + b; });
+        }
+        {
+            InferenceModeScope inference_mode_scope{};
+            Run("add (inference mode)", iterations, 1, [&x, &b]() { Array c = x + b; });
+        }
+
+        // A chain of 10 ops followed by backward, which exercises the creation and destruction of op nodes and array nodes.
+        Run("add chain + backward", iterations, 10, [&x, &b, &backprop_id]() {
+            Array y = x;
+            for (int i = 0; i < 10; ++i) {
+                y = y + b;
+            }
+            Backward(y, backprop_id);
+            x.ClearGrad(backprop_id);
+        });
+
+        // The same chain replayed as a single op.
+        RecordedGraph graph{};
+        GraphNodeId x_node = graph.AddInput(x.shape(), x.dtype());
+        GraphNodeId b_node = graph.AddInput(b.shape(), b.dtype());
+        GraphNodeId y_node = x_node;
+        for (int i = 0; i < 10; ++i) {
+            y_node = graph.Add(y_node, b_node);
+        }
+        graph.AddOutput(y_node);
+        GraphReplay replay{std::move(graph)};
+        Run("add chain replay + backward", iterations, 10, [&x, &b, &backprop_id, &replay]() {
+            Array y = replay.Run({x, b})[0];
+            Backward(y, backprop_id);
+            x.ClearGrad(backprop_id);
+        });
+    }
+}
+
+}  // namespace
+}  // namespace chainerx
+
+int main(int argc, char** argv) {
+    int64_t iterations = argc > 1 ? std::atoll(argv[1]) : 100000;
+    if (iterations <= 0) {
+        std::cerr << "Number of iterations must be positive." << std::endl;
+        return 1;
+    }
+    chainerx::RunAll(iterations);
+    return 0;
+}
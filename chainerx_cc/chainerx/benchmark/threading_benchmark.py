@@ -0,0 +1,51 @@
+# Measures how compute-heavy routines called from Python threads scale with
+# the number of threads, which requires the bindings to release the GIL.
+#
+# Usage: python threading_benchmark.py [max_threads]
+
+import sys
+import threading
+import time
+
+import numpy
+
+import chainerx
+
+
+def measure(func, n_threads, repeat):
+    threads = [
+        threading.Thread(target=lambda: [func() for _ in range(repeat)])
+        for _ in range(n_threads)]
+    start = time.perf_counter()
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    return time.perf_counter() - start
+
+
+def run_all(max_threads):
+    chainerx.set_default_device('native:0')
+
+    # Integer dot is computed without BLAS, i.e. in the calling thread only.
+    size = 384
+    a = chainerx.array(
+        numpy.arange(size * size, dtype=numpy.int32).reshape(size, size) % 7)
+    b = chainerx.array(
+        numpy.arange(size * size, dtype=numpy.int32).reshape(size, size) % 5)
+    repeat = 4
+
+    chainerx.dot(a, b)  # Warm-up
+    serial = measure(lambda: chainerx.dot(a, b), 1, repeat)
+    print('{:<16}{:>10.3f} s'.format('1 thread', serial))
+    n_threads = 2
+    while n_threads <= max_threads:
+        elapsed = measure(lambda: chainerx.dot(a, b), n_threads, repeat)
+        print('{:<16}{:>10.3f} s  (speedup: {:.2f}x)'.format(
+            '{} threads'.format(n_threads), elapsed,
+            serial * n_threads / elapsed))
+        n_threads *= 2
+
+
+if __name__ == '__main__':
+    run_all(int(sys.argv[1]) if len(sys.argv) > 1 else 4)
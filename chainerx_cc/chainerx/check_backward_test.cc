@@ -18,6 +18,7 @@
 #include "chainerx/backward_context.h"
 #include "chainerx/check_backward.h"
 #include "chainerx/context.h"
+#include "chainerx/device.h"
 #include "chainerx/graph.h"
 #include "chainerx/indexable_array.h"
 #include "chainerx/indexer.h"
@@ -46,6 +47,8 @@ Arrays ForwardWithIncorrectBackward(const Arrays& inputs) {
     }
     bb.Finalize();
 
+    // The input is read directly, after the kernels writing it are finished.
+    in.device().Synchronize();
     VisitDtype(in.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         IndexableArray<const T> in_iarray{in};
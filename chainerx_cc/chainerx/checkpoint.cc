@@ -0,0 +1,103 @@
+#include "chainerx/checkpoint.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include <gsl/gsl>
+
+#include "chainerx/array.h"
+#include "chainerx/backprop_mode.h"
+#include "chainerx/backward.h"
+#include "chainerx/backward_builder.h"
+#include "chainerx/backward_context.h"
+#include "chainerx/context.h"
+#include "chainerx/error.h"
+#include "chainerx/graph.h"
+#include "chainerx/routines/routines_util.h"
+
+namespace chainerx {
+
+std::vector<Array> Checkpoint(const std::function<std::vector<Array>(const std::vector<Array>&)>& func, const std::vector<Array>& inputs) {
+    if (inputs.empty()) {
+        throw ChainerxError{"Checkpoint requires at least one input."};
+    }
+
+    std::vector<Array> outputs{};
+    {
+        NoBackpropModeScope scope{};
+        outputs = func(inputs);
+    }
+    if (outputs.empty()) {
+        throw ChainerxError{"Checkpoint requires at least one output."};
+    }
+    // Outputs may be identical to the inputs. Make views so that the graph is not connected to the input bodies.
+    for (Array& output : outputs) {
+        internal::MakeViewForForwardBackwardOutput(output);
+    }
+
+    std::vector<ConstArrayRef> input_refs{inputs.begin(), inputs.end()};
+    std::vector<ConstArrayRef> output_refs{outputs.begin(), outputs.end()};
+    BackwardBuilder bb{"checkpoint", std::move(input_refs), std::move(output_refs)};
+    if (BackwardBuilder::Target bt = bb.CreateTarget()) {
+        std::vector<RetainedInputToken> input_toks{};
+        input_toks.reserve(inputs.size());
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            input_toks.emplace_back(bb.RetainInput(i));
+        }
+
+        bt.Define([func, input_toks = std::move(input_toks), &context = inputs.front().context()](BackwardContext& bctx) {
+            // Rebuild the local graph on a dedicated backprop ID. If the retained inputs are connected to graphs for higher order
+            // derivatives, the recomputation is recorded on those graphs as well. The ID is local so that other threads finishing
+            // backprop on those connected graphs do not prohibit the backprop below.
+            BackpropId backprop_id = context.MakeLocalBackpropId("checkpoint");
+            auto release_backprop_id = gsl::finally([&backprop_id]() { backprop_id.context().ReleaseBackpropIdNoExcept(backprop_id); });
+            // The local graph must be built even if the backward pass is running in a no-backprop mode for the whole context.
+            ForceBackpropModeScope force_backprop_scope{backprop_id};
+
+            std::vector<Array> xs{};
+            xs.reserve(input_toks.size());
+            std::transform(input_toks.begin(), input_toks.end(), std::back_inserter(xs), [&bctx, &backprop_id](const auto& tok) {
+                Array x = bctx.GetRetainedInput(tok).MakeView();
+                x.RequireGrad(backprop_id);
+                return x;
+            });
+
+            std::vector<Array> ys = func(xs);
+            if (ys.size() != bctx.output_count()) {
+                throw ChainerxError{"Checkpoint function returned a different number of outputs in recomputation."};
+            }
+
+            std::vector<ConstArrayRef> ys_to_backprop{};
+            for (size_t i = 0; i < ys.size(); ++i) {
+                Array& y = ys[i];
+                if (!bctx.HasOutputGrad(i) || !y.IsBackpropRequired(backprop_id)) {
+                    continue;
+                }
+                y.SetGrad(*bctx.output_grad(i), backprop_id);
+                ys_to_backprop.emplace_back(y);
+            }
+            if (ys_to_backprop.empty()) {
+                return;
+            }
+            Backward(ys_to_backprop, backprop_id);
+
+            for (size_t i = 0; i < xs.size(); ++i) {
+                if (!bctx.is_input_grad_required(i)) {
+                    continue;
+                }
+                const nonstd::optional<Array>& gx = xs[i].GetGrad(backprop_id);
+                if (gx.has_value()) {
+                    bctx.input_grad(i) = *gx;
+                }
+            }
+        });
+    }
+    bb.Finalize();
+
+    return outputs;
+}
+
+}  // namespace chainerx
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "chainerx/array.h"
+
+namespace chainerx {
+
+// Computes `func(inputs)` without keeping the intermediate graph (gradient checkpointing).
+//
+// The function is first called with backprop disabled, so that none of the arrays created inside `func` are retained for the backward pass.
+// Only the inputs are retained instead. The returned outputs are connected to the inputs through a single op node, whose backward function
+// re-executes `func` on the retained inputs to rebuild the local graph and backpropagates the output gradients through it. This trades
+// the computation of another forward pass of `func` for the memory of its intermediate arrays.
+//
+// `func` must be deterministic, i.e. it must return the same results given the same inputs, and must not have side effects on the inputs.
+// Double backprop is supported as long as `func` itself is differentiable twice.
+std::vector<Array> Checkpoint(const std::function<std::vector<Array>(const std::vector<Array>&)>& func, const std::vector<Array>& inputs);
+
+}  // namespace chainerx
@@ -0,0 +1,139 @@
+#include "chainerx/checkpoint.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/array_body.h"
+#include "chainerx/backward.h"
+#include "chainerx/check_backward.h"
+#include "chainerx/device_id.h"
+#include "chainerx/error.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/math.h"
+#include "chainerx/shape.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+class CheckpointTest : public ::testing::TestWithParam<std::string> {
+protected:
+    void SetUp() override {
+        const std::string& backend_name = GetParam();
+        device_session_.emplace(DeviceId{backend_name, 0});
+    }
+
+    void TearDown() override { device_session_.reset(); }
+
+private:
+    nonstd::optional<testing::DeviceSession> device_session_;
+};
+
+std::vector<Array> Block(const std::vector<Array>& xs) {
+    Array h = Exp(xs[0] * xs[1]);
+    return {h * xs[0], h + xs[1]};
+}
+
+TEST_P(CheckpointTest, Forward) {
+    Array a = testing::BuildArray({2, 3}).WithLinearData<double>(-1, 0.25).WithPadding(1);
+    Array b = testing::BuildArray({2, 3}).WithLinearData<double>(0.5, -0.125);
+
+    std::vector<Array> expected = Block({a, b});
+    std::vector<Array> actual = Checkpoint(&Block, {a, b});
+    ASSERT_EQ(expected.size(), actual.size());
+    EXPECT_ARRAY_EQ(expected[0], actual[0]);
+    EXPECT_ARRAY_EQ(expected[1], actual[1]);
+}
+
+TEST_P(CheckpointTest, IntermediatesAreNotRetained) {
+    Array a = (*testing::BuildArray({2, 3}).WithLinearData<double>(-1, 0.25)).RequireGrad();
+    Array b = (*testing::BuildArray({2, 3}).WithLinearData<double>(0.5, -0.125)).RequireGrad();
+
+    std::weak_ptr<internal::ArrayBody> intermediate{};
+    auto func = [&intermediate](const std::vector<Array>& xs) -> std::vector<Array> {
+        Array h = xs[0] * xs[1];
+        intermediate = internal::GetArrayBody(h);
+        return {Exp(h)};
+    };
+
+    std::vector<Array> ys = Checkpoint(func, {a, b});
+    EXPECT_TRUE(intermediate.expired());
+
+    Backward(ys[0]);
+    EXPECT_TRUE(intermediate.expired());
+    EXPECT_ARRAY_EQ(Exp(a * b) * b, *a.GetGrad());
+    EXPECT_ARRAY_EQ(Exp(a * b) * a, *b.GetGrad());
+}
+
+TEST_P(CheckpointTest, Backward) {
+    Array a = (*testing::BuildArray({2, 3}).WithLinearData<double>(-1, 0.25).WithPadding(1)).RequireGrad();
+    Array b = (*testing::BuildArray({2, 3}).WithLinearData<double>(0.5, -0.125)).RequireGrad();
+    Array go0 = testing::BuildArray({2, 3}).WithLinearData<double>(-0.1, 0.1);
+    Array go1 = testing::BuildArray({2, 3}).WithLinearData<double>(0.2, -0.05);
+    Array eps = Full({2, 3}, 1e-3);
+
+    CheckBackward([](const std::vector<Array>& xs) { return Checkpoint(&Block, xs); }, {a, b}, {go0, go1}, {eps, eps});
+}
+
+TEST_P(CheckpointTest, BackwardPartialOutputGrads) {
+    Array a = (*testing::BuildArray({2}).WithData<double>({1, 2})).RequireGrad();
+    Array b = testing::BuildArray({2}).WithData<double>({3, 4});
+
+    std::vector<Array> ys = Checkpoint(&Block, {a, b});
+    Backward(ys[1]);
+
+    // d(exp(ab) + b)/da = b exp(ab)
+    EXPECT_ARRAY_EQ(b * Exp(a * b), *a.GetGrad());
+    EXPECT_THROW(b.GetGrad(), ChainerxError);
+}
+
+TEST_P(CheckpointTest, DoubleBackward) {
+    Array a = (*testing::BuildArray({2, 3}).WithLinearData<double>(-1, 0.25).WithPadding(1)).RequireGrad();
+    Array b = (*testing::BuildArray({2, 3}).WithLinearData<double>(0.5, -0.125)).RequireGrad();
+    Array go0 = (*testing::BuildArray({2, 3}).WithLinearData<double>(-0.1, 0.1)).RequireGrad();
+    Array go1 = (*testing::BuildArray({2, 3}).WithLinearData<double>(0.2, -0.05)).RequireGrad();
+    Array gga = testing::BuildArray({2, 3}).WithLinearData<double>(-0.3, 0.1);
+    Array ggb = testing::BuildArray({2, 3}).WithLinearData<double>(0.1, 0.05);
+    Array eps = Full({2, 3}, 1e-3);
+
+    CheckDoubleBackwardComputation(
+            [](const std::vector<Array>& xs) { return Checkpoint(&Block, xs); }, {a, b}, {go0, go1}, {gga, ggb}, {eps, eps, eps, eps});
+}
+
+TEST_P(CheckpointTest, GradReadyHook) {
+    Array a = (*testing::BuildArray({2, 3}).WithLinearData<double>(-1, 0.25)).RequireGrad();
+    Array b = (*testing::BuildArray({2, 3}).WithLinearData<double>(0.5, -0.125)).RequireGrad();
+
+    std::vector<const internal::ArrayBody*> leaves{};
+    GradReadyHookScope scope{[&leaves](const Array& array, const Array& /*grad*/) {
+        leaves.emplace_back(internal::GetArrayBody(array).get());
+    }};
+    std::vector<Array> ys = Checkpoint(&Block, {a, b});
+    Backward({ys[0], ys[1]});
+
+    // The hook is called once for each of a and b, but not for the leaves of the recomputation in the backward of the checkpoint.
+    ASSERT_EQ(2U, leaves.size());
+    EXPECT_NE(leaves[0], leaves[1]);
+    for (const internal::ArrayBody* leaf : leaves) {
+        EXPECT_TRUE(leaf == internal::GetArrayBody(a).get() || leaf == internal::GetArrayBody(b).get());
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(
+        ForEachBackend,
+        CheckpointTest,
+        ::testing::Values(
+#ifdef CHAINERX_ENABLE_CUDA
+                std::string{"cuda"},
+#endif  // CHAINERX_ENABLE_CUDA
+                std::string{"native"}));
+
+}  // namespace
+}  // namespace chainerx
@@ -6,7 +6,9 @@
 #include <atomic>
 #include <cstdlib>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -125,43 +127,53 @@ Device& Context::GetDevice(const DeviceId& device_id) {
 
 BackpropId Context::MakeBackpropId(std::string backprop_name) {
     // Create new backprop ID
-    std::lock_guard<std::mutex> lock{mutex_};
-    backprop_set_.emplace_back(next_backprop_ordinal_, std::move(backprop_name));
+    std::lock_guard<std::shared_timed_mutex> lock{backprop_mutex_};
+    backprop_set_.emplace(next_backprop_ordinal_, BackpropSetItem{std::move(backprop_name)});
+    return BackpropId{*this, next_backprop_ordinal_++};
+}
+
+BackpropId Context::MakeLocalBackpropId(std::string backprop_name) {
+    std::lock_guard<std::shared_timed_mutex> lock{backprop_mutex_};
+    backprop_set_.emplace(next_backprop_ordinal_, BackpropSetItem{std::move(backprop_name), true});
     return BackpropId{*this, next_backprop_ordinal_++};
 }
 
 void Context::ReleaseBackpropId(const BackpropId& backprop_id) {
     CheckValidBackpropId(backprop_id);
 
-    if (backprop_id.ordinal() == 0) {
+    if (backprop_id.ordinal() == kDefaultBackpropOrdinal) {
         throw ChainerxError{"The default backprop ID cannot be released."};
     }
 
     ReleaseBackpropIdNoExcept(backprop_id);
 }
 
+namespace {
+
+void EraseOrdinal(std::vector<BackpropOrdinal>& ordinals, BackpropOrdinal ordinal) {
+    ordinals.erase(std::remove(ordinals.begin(), ordinals.end(), ordinal), ordinals.end());
+}
+
+}  // namespace
+
 void Context::ReleaseBackpropIdNoExcept(const BackpropId& backprop_id) noexcept {
-    std::lock_guard<std::mutex> lock{mutex_};
-    BackpropSetItem* item = GetBackpropSetItem(backprop_id.ordinal());
-    if (item == nullptr) {
+    std::lock_guard<std::shared_timed_mutex> lock{backprop_mutex_};
+    auto it = backprop_set_.find(backprop_id.ordinal());
+    if (it == backprop_set_.end()) {
         return;
     }
 
-    // Remove the connection pairs involving the backprop ID
-    backprop_connections_.erase(
-            std::remove_if(
-                    backprop_connections_.begin(),
-                    backprop_connections_.end(),
-                    [ordinal = backprop_id.ordinal()](const std::pair<BackpropOrdinal, BackpropOrdinal>& pair) {
-                        return pair.first == ordinal || pair.second == ordinal;
-                    }),
-            backprop_connections_.end());
+    // Remove the connections involving the backprop ID from the connected ones.
+    const BackpropSetItem& item = it->second;
+    for (BackpropOrdinal inner_ordinal : item.inner_ordinals) {
+        EraseOrdinal(backprop_set_.at(inner_ordinal).outer_ordinals, backprop_id.ordinal());
+    }
+    for (BackpropOrdinal outer_ordinal : item.outer_ordinals) {
+        EraseOrdinal(backprop_set_.at(outer_ordinal).inner_ordinals, backprop_id.ordinal());
+    }
 
     // Remove the backprop ID.
-    backprop_set_.erase(
-            std::find_if(backprop_set_.begin(), backprop_set_.end(), [ordinal = backprop_id.ordinal()](const BackpropSetItem& item) {
-                return item.ordinal == ordinal;
-            }));
+    backprop_set_.erase(it);
 }
 
 void Context::CheckValidBackpropId(const BackpropId& backprop_id) const {
@@ -169,7 +181,7 @@ void Context::CheckValidBackpropId(const BackpropId& backprop_id) const {
         throw ChainerxError{"Invalid context in backprop ID: ", backprop_id};
     }
 
-    std::lock_guard<std::mutex> lock{mutex_};
+    std::shared_lock<std::shared_timed_mutex> lock{backprop_mutex_};
     if (GetBackpropSetItem(backprop_id.ordinal()) == nullptr) {
         throw ChainerxError{"Invalid backprop ID, maybe already expired: ", ToBackpropIdString(backprop_id.ordinal())};
     }
@@ -183,35 +195,50 @@ void Context::ConnectBackpropIds(const BackpropId& backprop_id1, const BackpropI
         return;
     }
 
-    std::lock_guard<std::mutex> lock{mutex_};
+    BackpropOrdinal outer_ordinal{};
+    BackpropOrdinal inner_ordinal{};
+    std::tie(outer_ordinal, inner_ordinal) = std::minmax(backprop_id1.ordinal(), backprop_id2.ordinal());
 
-    BackpropSetItem* item1 = GetBackpropSetItem(backprop_id1.ordinal());
-    BackpropSetItem* item2 = GetBackpropSetItem(backprop_id2.ordinal());
-    if (item1 == nullptr || item2 == nullptr) {
-        // At least one cannot be found
-        return;
-    }
+    // Returns the outer item, or nullptr if nothing is to be done.
+    auto find_outer_item_to_connect = [this, outer_ordinal, inner_ordinal]() -> BackpropSetItem* {
+        BackpropSetItem* outer_item = GetBackpropSetItem(outer_ordinal);
+        if (outer_item == nullptr || GetBackpropSetItem(inner_ordinal) == nullptr) {
+            // At least one cannot be found
+            return nullptr;
+        }
+        const std::vector<BackpropOrdinal>& inner_ordinals = outer_item->inner_ordinals;
+        if (std::find(inner_ordinals.begin(), inner_ordinals.end(), inner_ordinal) != inner_ordinals.end()) {
+            // Already in connection
+            return nullptr;
+        }
+        return outer_item;
+    };
 
-    std::pair<BackpropOrdinal, BackpropOrdinal> pair = std::minmax(backprop_id1.ordinal(), backprop_id2.ordinal());
-    if (backprop_connections_.end() != std::find(backprop_connections_.begin(), backprop_connections_.end(), pair)) {
-        // Already in connection
-        return;
+    // Most calls find the backprop IDs already connected, which only requires a shared lock.
+    {
+        std::shared_lock<std::shared_timed_mutex> lock{backprop_mutex_};
+        if (find_outer_item_to_connect() == nullptr) {
+            return;
+        }
     }
 
     // Add a new connection
-    backprop_connections_.emplace_back(pair);
+    std::lock_guard<std::shared_timed_mutex> lock{backprop_mutex_};
+    if (BackpropSetItem* outer_item = find_outer_item_to_connect()) {
+        outer_item->inner_ordinals.emplace_back(inner_ordinal);
+        GetBackpropSetItem(inner_ordinal)->outer_ordinals.emplace_back(outer_ordinal);
+    }
 }
 
 std::string Context::GetBackpropName(const BackpropId& backprop_id) {
-    // Note: backprop name cannot be returned by reference, as the reference may be invalidated when a new graph is pushed to the backprop
-    // set.
-    std::lock_guard<std::mutex> lock{mutex_};
+    // Note: backprop name cannot be returned by reference, as the reference may be invalidated when the backprop ID is released.
+    std::shared_lock<std::shared_timed_mutex> lock{backprop_mutex_};
     return ToBackpropIdString(backprop_id.ordinal());
 }
 
 void Context::CheckBackpropAllowed(const BackpropId& backprop_id) {
-    std::lock_guard<std::mutex> lock{mutex_};
-    BackpropSetItem* item = GetBackpropSetItem(backprop_id.ordinal());
+    std::shared_lock<std::shared_timed_mutex> lock{backprop_mutex_};
+    const BackpropSetItem* item = GetBackpropSetItem(backprop_id.ordinal());
     if (item == nullptr) {
         throw ChainerxError{"Backprop ID not found: ", ToBackpropIdString(backprop_id.ordinal())};
     }
@@ -225,22 +252,24 @@ void Context::CheckBackpropAllowed(const BackpropId& backprop_id) {
 }
 
 void Context::SetBackpropDone(const BackpropId& backprop_id) {
-    std::lock_guard<std::mutex> lock{mutex_};
-
-    CHAINERX_ASSERT(GetBackpropSetItem(backprop_id.ordinal()) != nullptr);
-
-    // Find connected backprop IDs
-    std::vector<BackpropOrdinal> ordinals_to_prohibit;
-    for (const std::pair<BackpropOrdinal, BackpropOrdinal>& pair : backprop_connections_) {
-        if (pair.first == backprop_id.ordinal()) {
-            ordinals_to_prohibit.emplace_back(pair.second);
+    // Backprop IDs without any inner connection, which are the majority, do not need an exclusive lock.
+    {
+        std::shared_lock<std::shared_timed_mutex> lock{backprop_mutex_};
+        const BackpropSetItem* item = GetBackpropSetItem(backprop_id.ordinal());
+        CHAINERX_ASSERT(item != nullptr);
+        if (item->inner_ordinals.empty()) {
+            return;
         }
     }
 
+    std::lock_guard<std::shared_timed_mutex> lock{backprop_mutex_};
+    BackpropSetItem* item = GetBackpropSetItem(backprop_id.ordinal());
+    CHAINERX_ASSERT(item != nullptr);
+
     // Mark connected backprop IDs as prohibited.
-    for (BackpropOrdinal ord : ordinals_to_prohibit) {
+    for (BackpropOrdinal ord : item->inner_ordinals) {
         BackpropSetItem* item2 = GetBackpropSetItem(ord);
-        if (!item2->prohibiting_ordinal.has_value()) {
+        if (!item2->is_local && !item2->prohibiting_ordinal.has_value()) {
             item2->prohibiting_ordinal = backprop_id.ordinal();
         }
     }
@@ -249,26 +278,25 @@ void Context::SetBackpropDone(const BackpropId& backprop_id) {
 std::vector<BackpropId> Context::GetInnerBackpropIds(const BackpropId& backprop_id) {
     std::vector<BackpropId> inner_backprop_ids;
 
-    std::lock_guard<std::mutex> lock{mutex_};
-    inner_backprop_ids.reserve(backprop_set_.size());
-    for (const std::pair<BackpropOrdinal, BackpropOrdinal>& pair : backprop_connections_) {
-        if (pair.first == backprop_id.ordinal()) {
-            inner_backprop_ids.emplace_back(BackpropId{*this, pair.second});
-        }
+    std::shared_lock<std::shared_timed_mutex> lock{backprop_mutex_};
+    const BackpropSetItem* item = GetBackpropSetItem(backprop_id.ordinal());
+    if (item == nullptr) {
+        return inner_backprop_ids;
+    }
+    inner_backprop_ids.reserve(item->inner_ordinals.size());
+    for (BackpropOrdinal ordinal : item->inner_ordinals) {
+        inner_backprop_ids.emplace_back(BackpropId{*this, ordinal});
     }
     return inner_backprop_ids;
 }
 
 template <typename ThisPtr, typename ReturnType>
 ReturnType Context::GetBackpropSetItemImpl(ThisPtr this_ptr, BackpropOrdinal ordinal) {
-    // using reverse iterator because it's more likely to find earlier
-    auto it = std::find_if(this_ptr->backprop_set_.rbegin(), this_ptr->backprop_set_.rend(), [ordinal](const BackpropSetItem& item) {
-        return item.ordinal == ordinal;
-    });
-    if (it == this_ptr->backprop_set_.rend()) {
+    auto it = this_ptr->backprop_set_.find(ordinal);
+    if (it == this_ptr->backprop_set_.end()) {
         return nullptr;
     }
-    return &*it;
+    return &it->second;
 }
 
 std::string Context::ToBackpropIdString(BackpropOrdinal ordinal) const {
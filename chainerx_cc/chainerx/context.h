@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -43,7 +44,9 @@ private:
 
 // TODO(sonots): Hide BackpropId-related functions from users.
 // TODO(sonots): Move implementations of BackpropId-releated functions into another class.
-// TODO(niboshi): Make BackpropId-related functions thread-safe.
+//
+// BackpropId-related functions are thread safe. Backprop IDs are looked up by their ordinals in constant time, and the functions which
+// only inspect backprop IDs, which are called on every backward, can run concurrently with each other.
 class Context {
 public:
     Context();
@@ -67,6 +70,11 @@ public:
 
     BackpropId MakeBackpropId(std::string backprop_name);
 
+    // Creates a backprop ID which is only backpropped by the backward function creating it, e.g. for recomputation in a checkpoint.
+    // Backprop on connected backprop IDs does not prohibit backprop on it, even if it runs concurrently in another thread.
+    // TODO(sonots): Hide from users
+    BackpropId MakeLocalBackpropId(std::string backprop_name);
+
     void ReleaseBackpropId(const BackpropId& backprop_id);
 
     // TODO(sonots): Hide from users
@@ -102,33 +110,40 @@ public:
     std::vector<BackpropId> GetInnerBackpropIds(const BackpropId& backprop_id);
 
     BackpropId default_backprop_id() {
-        // The first entry is always the default backprop ID.
-        std::lock_guard<std::mutex> lock{mutex_};
-        CHAINERX_ASSERT(!backprop_set_.empty());
-        return BackpropId{*this, backprop_set_.front().ordinal};
+        // The default backprop ID is the first one, which is never released.
+        return BackpropId{*this, kDefaultBackpropOrdinal};
     }
 
 private:
-    // TODO(niboshi): Support multi-thread usage
+    static constexpr BackpropOrdinal kDefaultBackpropOrdinal = 0;
+
     struct BackpropSetItem {
-        BackpropSetItem(BackpropOrdinal ordinal, std::string name) : ordinal{ordinal}, name{std::move(name)} {}
+        explicit BackpropSetItem(std::string name, bool is_local = false) : name{std::move(name)}, is_local{is_local} {}
 
-        BackpropOrdinal ordinal;
         std::string name;
 
+        // Whether this backprop ID is local to a backward function, in which case it is never prohibited.
+        bool is_local;
+
         // If this member has a value, it indicates that this Backprop ID is prohibited for further backprop.
         // Its value is the backprop ID which caused the prohibition.
         nonstd::optional<BackpropOrdinal> prohibiting_ordinal{nonstd::nullopt};
+
+        // Connected backprop IDs with greater ordinals, i.e. those prohibited by backprop on this backprop ID.
+        std::vector<BackpropOrdinal> inner_ordinals;
+
+        // Connected backprop IDs with less ordinals.
+        std::vector<BackpropOrdinal> outer_ordinals;
     };
 
     // Finds the BackpropSetItem instance.
-    // Note that this function is not thread safe.
+    // Note that backprop_mutex_ must be locked by the caller.
     const BackpropSetItem* GetBackpropSetItem(BackpropOrdinal ordinal) const {
         return GetBackpropSetItemImpl<const Context*, const BackpropSetItem*>(this, ordinal);
     }
 
     // Finds the BackpropSetItem instance.
-    // Note that this function is not thread safe.
+    // Note that backprop_mutex_ must be locked by the caller.
     BackpropSetItem* GetBackpropSetItem(BackpropOrdinal ordinal) {
         return GetBackpropSetItemImpl<Context*, BackpropSetItem*>(this, ordinal);
     }
@@ -138,20 +153,21 @@ private:
 
     // Returns a string representation of a backprop ID given its ordinal.
     // A special string is returned if the given ordinal has already expired.
-    // Note that this function is not thread safe.
+    // Note that backprop_mutex_ must be locked by the caller.
     std::string ToBackpropIdString(BackpropOrdinal ordinal) const;
 
     std::unordered_map<std::string, std::unique_ptr<Backend, context_detail::BackendDeleter>> backends_;
     std::vector<void*> dlopen_handles_;
     mutable std::mutex mutex_;
 
-    BackpropOrdinal next_backprop_ordinal_{0};
+    // Guards the members below. Functions which do not modify them take shared locks.
+    mutable std::shared_timed_mutex backprop_mutex_;
 
-    std::vector<BackpropSetItem> backprop_set_{};
+    BackpropOrdinal next_backprop_ordinal_{kDefaultBackpropOrdinal};
 
-    // List of pairs of connected backprop IDs.
-    // The first ordinal is always less than the second, which means backpropping on the first will prohibit future backprop on the second.
-    std::vector<std::pair<BackpropOrdinal, BackpropOrdinal>> backprop_connections_;
+    // Alive backprop IDs keyed by their ordinals.
+    // Connections are stored in both of the connected items, so that they can be traversed and removed without scanning all the items.
+    std::unordered_map<BackpropOrdinal, BackpropSetItem> backprop_set_{};
 };
 
 // Gets/sets the context that used by default when current context is not set.
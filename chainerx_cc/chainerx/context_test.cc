@@ -2,6 +2,7 @@
 
 #include <cstdlib>
 #include <future>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -9,6 +10,8 @@
 
 #include "chainerx/backend.h"
 #include "chainerx/device.h"
+#include "chainerx/error.h"
+#include "chainerx/graph.h"
 #include "chainerx/native/native_backend.h"
 #include "chainerx/native/native_device.h"
 #include "chainerx/testing/threading.h"
@@ -112,6 +115,65 @@ TEST(ContextTest, BackpropIdThreadSafe) {
     });
 }
 
+TEST(ContextTest, BackpropIdManyThreads) {
+    Context ctx{};
+    BackpropId default_backprop_id = ctx.default_backprop_id();
+    static constexpr size_t kThreadCount = 8;
+    static constexpr int kIterationCount = 200;
+
+    testing::RunThreads(kThreadCount, [&ctx, &default_backprop_id](size_t thread_index) {
+        std::string name = "bp" + std::to_string(thread_index);
+        nonstd::optional<BackpropId> prev_backprop_id{};
+        for (int i = 0; i < kIterationCount; ++i) {
+            BackpropId backprop_id = ctx.MakeBackpropId(name);
+            EXPECT_EQ(name, ctx.GetBackpropName(backprop_id));
+            ctx.ConnectBackpropIds(default_backprop_id, backprop_id);
+            ctx.ConnectBackpropIds(backprop_id, default_backprop_id);  // no-op
+
+            if (prev_backprop_id.has_value()) {
+                ctx.ConnectBackpropIds(backprop_id, *prev_backprop_id);
+                std::vector<BackpropId> inner_backprop_ids = ctx.GetInnerBackpropIds(*prev_backprop_id);
+                ASSERT_EQ(size_t{1}, inner_backprop_ids.size());
+                EXPECT_EQ(backprop_id, inner_backprop_ids.front());
+
+                // Backprop on the earlier backprop ID prohibits the later one.
+                ctx.CheckBackpropAllowed(backprop_id);
+                ctx.SetBackpropDone(*prev_backprop_id);
+                EXPECT_THROW(ctx.CheckBackpropAllowed(backprop_id), ChainerxError);
+
+                ctx.ReleaseBackpropId(*prev_backprop_id);
+                EXPECT_THROW(ctx.CheckValidBackpropId(*prev_backprop_id), ChainerxError);
+                EXPECT_EQ("<expired>", ctx.GetBackpropName(*prev_backprop_id));
+            }
+            EXPECT_TRUE(ctx.GetInnerBackpropIds(backprop_id).empty());
+            prev_backprop_id.emplace(backprop_id);
+        }
+        ctx.ReleaseBackpropId(*prev_backprop_id);
+    });
+
+    // All the connections to the released backprop IDs have been removed.
+    EXPECT_TRUE(ctx.GetInnerBackpropIds(default_backprop_id).empty());
+    ctx.CheckBackpropAllowed(default_backprop_id);
+    EXPECT_THROW(ctx.ReleaseBackpropId(default_backprop_id), ChainerxError);
+}
+
+TEST(ContextTest, LocalBackpropIdNotProhibited) {
+    Context ctx{};
+    BackpropId default_backprop_id = ctx.default_backprop_id();
+    BackpropId backprop_id = ctx.MakeBackpropId("bp");
+    BackpropId local_backprop_id = ctx.MakeLocalBackpropId("local");
+    ctx.ConnectBackpropIds(default_backprop_id, backprop_id);
+    ctx.ConnectBackpropIds(default_backprop_id, local_backprop_id);
+
+    ctx.SetBackpropDone(default_backprop_id);
+    EXPECT_THROW(ctx.CheckBackpropAllowed(backprop_id), ChainerxError);
+    ctx.CheckBackpropAllowed(local_backprop_id);
+    EXPECT_EQ("local", ctx.GetBackpropName(local_backprop_id));
+
+    ctx.ReleaseBackpropId(local_backprop_id);
+    ctx.ReleaseBackpropId(backprop_id);
+}
+
 TEST(ContextTest, DefaultContext) {
     SetGlobalDefaultContext(nullptr);
     SetDefaultContext(nullptr);
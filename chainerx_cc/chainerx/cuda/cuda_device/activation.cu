@@ -11,6 +11,7 @@
 #include "chainerx/cuda/elementwise.cuh"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
+#include "chainerx/profiler.h"
 #include "chainerx/scalar.h"
 
 namespace chainerx {
@@ -29,6 +30,7 @@ struct IfLessElseASSAImpl {
 
 void CudaDevice::IfLessElseASSA(const Array& x1, Scalar x2, Scalar pos, const Array& neg, const Array& out) {
     CheckDevicesCompatible(x1, neg, out);
+    ProfileRange profile_range{"kernel", "IfLessElseASSA"};
     CheckCudaError(cudaSetDevice(index()));
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -47,6 +49,7 @@ struct TanhImpl {
 
 void CudaDevice::Tanh(const Array& x, const Array& out) {
     CheckDevicesCompatible(x, out);
+    ProfileRange profile_range{"kernel", "Tanh"};
     CudaSetDeviceScope scope{index()};
     VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -11,6 +11,7 @@
 #include "chainerx/cuda/elementwise.cuh"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
+#include "chainerx/profiler.h"
 #include "chainerx/scalar.h"
 
 namespace chainerx {
@@ -27,6 +28,7 @@ struct AddImpl {
 // TODO(sonots): support stream
 void CudaDevice::Add(const Array& x1, const Array& x2, const Array& out) {
     CheckDevicesCompatible(x1, x2, out);
+    ProfileRange profile_range{"kernel", "Add"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -46,6 +48,7 @@ struct AddASImpl {
 
 void CudaDevice::AddAS(const Array& x1, Scalar x2, const Array& out) {
     CheckDevicesCompatible(x1, out);
+    ProfileRange profile_range{"kernel", "AddAS"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -64,6 +67,7 @@ struct SubtractImpl {
 
 void CudaDevice::Subtract(const Array& x1, const Array& x2, const Array& out) {
     CheckDevicesCompatible(x1, x2, out);
+    ProfileRange profile_range{"kernel", "Subtract"};
     CudaSetDeviceScope scope{index()};
     VisitNumericDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -83,6 +87,7 @@ struct SubtractASImpl {
 
 void CudaDevice::SubtractAS(const Array& x1, Scalar x2, const Array& out) {
     CheckDevicesCompatible(x1, out);
+    ProfileRange profile_range{"kernel", "SubtractAS"};
     CudaSetDeviceScope scope{index()};
     VisitNumericDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -102,6 +107,7 @@ struct MultiplyImpl {
 // TODO(sonots): support stream
 void CudaDevice::Multiply(const Array& x1, const Array& x2, const Array& out) {
     CheckDevicesCompatible(x1, x2, out);
+    ProfileRange profile_range{"kernel", "Multiply"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -121,6 +127,7 @@ struct MultiplyASImpl {
 
 void CudaDevice::MultiplyAS(const Array& x1, Scalar x2, const Array& out) {
     CheckDevicesCompatible(x1, out);
+    ProfileRange profile_range{"kernel", "MultiplyAS"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -139,6 +146,7 @@ struct DivideImpl {
 
 void CudaDevice::Divide(const Array& x1, const Array& x2, const Array& out) {
     CheckDevicesCompatible(x1, x2, out);
+    ProfileRange profile_range{"kernel", "Divide"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -158,6 +166,7 @@ struct DivideASImpl {
 
 void CudaDevice::DivideAS(const Array& x1, Scalar x2, const Array& out) {
     CheckDevicesCompatible(x1, out);
+    ProfileRange profile_range{"kernel", "DivideAS"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -14,6 +14,7 @@
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
 #include "chainerx/macro.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/scalar.h"
 #include "chainerx/shape.h"
@@ -102,6 +103,7 @@ public:
     }
 
     Array Forward(const Array& x, const Array& gamma, const Array& beta) override {
+        ProfileRange profile_range{"kernel", "BatchNormForward"};
         if (CHAINERX_DEBUG) {
             Shape reduced_shape = internal::ReduceShape(x.shape(), axis(), true);
             CHAINERX_ASSERT(gamma.shape() == reduced_shape);
@@ -199,6 +201,7 @@ public:
     }
 
     std::array<Array, 3> Backward(const Array& gout) override {
+        ProfileRange profile_range{"kernel", "BatchNormBackward"};
         const Array& x_cont = this->x();
         const Array& gamma = this->gamma();
         const Array& x_mean = this->x_mean();
@@ -289,6 +292,7 @@ std::unique_ptr<BatchNormForwardBackward> CudaDevice::GetBatchNormForwardBackwar
 
 Array CudaDevice::FixedBatchNorm(
         const Array& x, const Array& gamma, const Array& beta, const Array& mean, const Array& var, Scalar eps, const Axes& axis) {
+    ProfileRange profile_range{"kernel", "FixedBatchNorm"};
     if (static_cast<double>(eps) < CUDNN_BN_MIN_EPSILON) {
         throw CudnnError{"Minimum allowed epsilon is ", CUDNN_BN_MIN_EPSILON, " but found ", eps, "."};
     }
@@ -10,6 +10,7 @@
 #include "chainerx/cuda/elementwise.cuh"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
+#include "chainerx/profiler.h"
 
 namespace chainerx {
 namespace cuda {
@@ -24,6 +25,7 @@ struct EqualImpl {
 
 void CudaDevice::Equal(const Array& x1, const Array& x2, const Array& out) {
     CheckDevicesCompatible(x1, x2, out);
+    ProfileRange profile_range{"kernel", "Equal"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(x1.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -42,6 +44,7 @@ struct NotEqualImpl {
 
 void CudaDevice::NotEqual(const Array& x1, const Array& x2, const Array& out) {
     CheckDevicesCompatible(x1, x2, out);
+    ProfileRange profile_range{"kernel", "NotEqual"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(x1.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -60,6 +63,7 @@ struct GreaterImpl {
 
 void CudaDevice::Greater(const Array& x1, const Array& x2, const Array& out) {
     CheckDevicesCompatible(x1, x2, out);
+    ProfileRange profile_range{"kernel", "Greater"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(x1.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -78,6 +82,7 @@ struct GreaterEqualImpl {
 
 void CudaDevice::GreaterEqual(const Array& x1, const Array& x2, const Array& out) {
     CheckDevicesCompatible(x1, x2, out);
+    ProfileRange profile_range{"kernel", "GreaterEqual"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(x1.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -96,6 +101,7 @@ struct LogicalNotImpl {
 
 void CudaDevice::LogicalNot(const Array& x, const Array& out) {
     CheckDevicesCompatible(x, out);
+    ProfileRange profile_range{"kernel", "LogicalNot"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(x.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -6,6 +6,7 @@
 #include "chainerx/constant.h"
 #include "chainerx/cuda/cuda_conv.h"
 #include "chainerx/dtype.h"
+#include "chainerx/profiler.h"
 #include "chainerx/shape.h"
 #include "chainerx/stack_vector.h"
 
@@ -19,6 +20,7 @@ Array CudaDevice::Conv(
         const StackVector<int64_t, kMaxNdim>& stride,
         const StackVector<int64_t, kMaxNdim>& pad,
         bool cover_all) {
+    ProfileRange profile_range{"kernel", "Conv"};
     return cuda_conv_.Conv(*this, x, w, b, stride, pad, cover_all);
 }
 
@@ -29,6 +31,7 @@ Array CudaDevice::ConvTranspose(
         const StackVector<int64_t, kMaxNdim>& stride,
         const StackVector<int64_t, kMaxNdim>& pad,
         const StackVector<int64_t, kMaxNdim>& out_size) {
+    ProfileRange profile_range{"kernel", "ConvTranspose"};
     return cuda_conv_.ConvTranspose(*this, x, w, b, stride, pad, out_size);
 }
 
@@ -40,6 +43,7 @@ Array CudaDevice::ConvGradWeight(
         const StackVector<int64_t, kMaxNdim>& stride,
         const StackVector<int64_t, kMaxNdim>& pad,
         bool cover_all) {
+    ProfileRange profile_range{"kernel", "ConvGradWeight"};
     return cuda_conv_.ConvGradWeight(*this, w_dtype, w_shape, x, gy, stride, pad, cover_all);
 }
 
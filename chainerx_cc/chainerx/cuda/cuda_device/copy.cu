@@ -10,6 +10,7 @@
 #include "chainerx/cuda/elementwise.cuh"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
+#include "chainerx/profiler.h"
 
 namespace chainerx {
 namespace cuda {
@@ -24,6 +25,7 @@ struct CopyImpl {
 
 void CudaDevice::Copy(const Array& a, const Array& out) {
     CheckDevicesCompatible(a, out);
+    ProfileRange profile_range{"kernel", "Copy"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -42,6 +44,7 @@ struct AsTypeImpl {
 
 void CudaDevice::AsType(const Array& a, const Array& out) {
     CheckDevicesCompatible(a, out);
+    ProfileRange profile_range{"kernel", "AsType"};
     CudaSetDeviceScope scope{index()};
     auto do_astype = [&](auto in_pt, auto out_pt) {
         using InT = typename decltype(in_pt)::type;
@@ -15,6 +15,7 @@
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
 #include "chainerx/macro.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/creation.h"
 
 namespace chainerx {
@@ -74,6 +75,7 @@ struct GemmInputLayout {
 
 void CudaDevice::Dot(const Array& a, const Array& b, const Array& out) {
     CheckDevicesCompatible(a, b, out);
+    ProfileRange profile_range{"kernel", "Dot"};
     CudaSetDeviceScope scope{index()};
 
     CHAINERX_ASSERT(a.ndim() == 2);
@@ -11,6 +11,7 @@
 #include "chainerx/cuda/elementwise.cuh"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
+#include "chainerx/profiler.h"
 
 namespace chainerx {
 namespace cuda {
@@ -25,6 +26,7 @@ struct ExpImpl {
 
 void CudaDevice::Exp(const Array& x, const Array& out) {
     CheckDevicesCompatible(x, out);
+    ProfileRange profile_range{"kernel", "Exp"};
     CudaSetDeviceScope scope{index()};
     VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -43,6 +45,7 @@ struct LogImpl {
 
 void CudaDevice::Log(const Array& x, const Array& out) {
     CheckDevicesCompatible(x, out);
+    ProfileRange profile_range{"kernel", "Log"};
     CudaSetDeviceScope scope{index()};
     VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -16,6 +16,7 @@
 #include "chainerx/indexable_array.h"
 #include "chainerx/indexer.h"
 #include "chainerx/macro.h"
+#include "chainerx/profiler.h"
 #include "chainerx/scalar.h"
 #include "chainerx/shape.h"
 
@@ -33,6 +34,7 @@ struct ArangeImpl {
 }  // namespace
 
 void CudaDevice::Arange(Scalar start, Scalar step, const Array& out) {
+    ProfileRange profile_range{"kernel", "Arange"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -51,6 +53,7 @@ struct FillImpl {
 }  // namespace
 
 void CudaDevice::Fill(const Array& out, Scalar value) {
+    ProfileRange profile_range{"kernel", "Fill"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -70,6 +73,7 @@ struct IdentityImpl {
 }  // namespace
 
 void CudaDevice::Identity(const Array& out) {
+    ProfileRange profile_range{"kernel", "Identity"};
     CHAINERX_ASSERT(out.ndim() == 2);
     CHAINERX_ASSERT(out.shape()[0] == out.shape()[1]);
 
@@ -94,6 +98,7 @@ struct EyeImpl {
 }  // namespace
 
 void CudaDevice::Eye(int64_t k, const Array& out) {
+    ProfileRange profile_range{"kernel", "Eye"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(out.dtype(), [k, &out](auto pt) {
         using T = typename decltype(pt)::type;
@@ -122,6 +127,7 @@ __global__ void SetVecInMat(
 }  // namespace
 
 void CudaDevice::Diagflat(const Array& v, int64_t k, const Array& out) {
+    ProfileRange profile_range{"kernel", "Diagflat"};
     CHAINERX_ASSERT(v.ndim() == 1);
     CHAINERX_ASSERT(out.ndim() == 2);
 
@@ -174,6 +180,7 @@ struct LinspaceImpl {
 }  // namespace
 
 void CudaDevice::Linspace(double start, double stop, const Array& out) {
+    ProfileRange profile_range{"kernel", "Linspace"};
     CHAINERX_ASSERT(out.ndim() == 1);
     CHAINERX_ASSERT(out.shape()[0] > 0);
 
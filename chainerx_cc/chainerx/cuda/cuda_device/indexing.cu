@@ -18,6 +18,7 @@
 #include "chainerx/indexable_array.h"
 #include "chainerx/indexer.h"
 #include "chainerx/macro.h"
+#include "chainerx/profiler.h"
 #include "chainerx/shape.h"
 
 namespace chainerx {
@@ -109,6 +110,7 @@ __global__ void AddAtKernel(
 
 void CudaDevice::Take(const Array& a, const Array& indices, int8_t axis, const Array& out) {
     CheckDevicesCompatible(a, indices, out);
+    ProfileRange profile_range{"kernel", "Take"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -151,6 +153,7 @@ void CudaDevice::Take(const Array& a, const Array& indices, int8_t axis, const A
 }
 
 void CudaDevice::AddAt(const Array& a, const Array& indices, int8_t axis, const Array& b, const Array& out) {
+    ProfileRange profile_range{"kernel", "AddAt"};
     // TODO(niboshi): Current implementation only distributes output elements in respective threads. Summation on the indices is performed
     // serially in each thread. This implementation can be improved by distributing indices as well, possibly using atomicAdd.
 
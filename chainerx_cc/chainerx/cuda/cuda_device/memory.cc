@@ -5,6 +5,7 @@
 
 #include <cuda_runtime.h>
 
+#include "chainerx/arena.h"
 #include "chainerx/cuda/cuda_runtime.h"
 #include "chainerx/cuda/cuda_set_device_scope.h"
 #include "chainerx/cuda/memory_pool.h"
@@ -12,11 +13,18 @@
 #include "chainerx/error.h"
 #include "chainerx/macro.h"
 #include "chainerx/native/native_device.h"
+#include "chainerx/profiler.h"
 
 namespace chainerx {
 namespace cuda {
 
 std::shared_ptr<void> CudaDevice::Allocate(size_t bytesize) {
+    ProfileRange::RecordAllocation(bytesize);
+    if (bytesize > 0) {
+        if (std::shared_ptr<void> ptr = internal::AllocateFromDefaultArena(*this, bytesize)) {
+            return ptr;
+        }
+    }
     void* ptr = device_memory_pool_->Malloc(bytesize);
     return std::shared_ptr<void>{ptr, [weak_pool = std::weak_ptr<MemoryPool>{device_memory_pool_}](void* ptr) {
                                      if (std::shared_ptr<MemoryPool> pool = weak_pool.lock()) {
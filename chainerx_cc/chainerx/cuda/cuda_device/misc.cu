@@ -11,6 +11,7 @@
 #include "chainerx/cuda/elementwise.cuh"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
+#include "chainerx/profiler.h"
 
 namespace chainerx {
 namespace cuda {
@@ -25,6 +26,7 @@ struct SqrtImpl {
 
 void CudaDevice::Sqrt(const Array& x, const Array& out) {
     CheckDevicesCompatible(x, out);
+    ProfileRange profile_range{"kernel", "Sqrt"};
     CudaSetDeviceScope scope{index()};
     VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -50,6 +52,7 @@ struct IsNanImpl {
 
 void CudaDevice::IsNan(const Array& x, const Array& out) {
     CheckDevicesCompatible(x, out);
+    ProfileRange profile_range{"kernel", "IsNan"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(x.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -75,6 +78,7 @@ struct IsInfImpl {
 
 void CudaDevice::IsInf(const Array& x, const Array& out) {
     CheckDevicesCompatible(x, out);
+    ProfileRange profile_range{"kernel", "IsInf"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(x.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
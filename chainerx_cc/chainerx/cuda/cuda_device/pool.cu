@@ -20,6 +20,7 @@
 #include "chainerx/indexer.h"
 #include "chainerx/macro.h"
 #include "chainerx/numeric_limits.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/connection.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/pooling.h"
@@ -242,11 +243,20 @@ public:
             bool cover_all)
         : pool_impl_{cudnn_handle, kernel_size, stride, pad, cover_all, CUDNN_POOLING_MAX} {}
 
-    Array Forward(const Array& x) override { return pool_impl_.Forward(x); }
+    Array Forward(const Array& x) override {
+        ProfileRange profile_range{"kernel", "MaxPoolForward"};
+        return pool_impl_.Forward(x);
+    }
 
-    Array Backward(const Array& gout) override { return pool_impl_.Backward(gout); }
+    Array Backward(const Array& gout) override {
+        ProfileRange profile_range{"kernel", "MaxPoolBackward"};
+        return pool_impl_.Backward(gout);
+    }
 
-    Array DoubleBackward(const Array& ggx) override { return pool_impl_.DoubleBackward(ggx); }
+    Array DoubleBackward(const Array& ggx) override {
+        ProfileRange profile_range{"kernel", "MaxPoolDoubleBackward"};
+        return pool_impl_.DoubleBackward(ggx);
+    }
 
 private:
     PoolImpl pool_impl_;
@@ -285,9 +295,15 @@ public:
             AveragePoolPadMode pad_mode)
         : pool_impl_{cudnn_handle, kernel_size, stride, pad, false, GetCudnnPoolingMode(pad_mode)} {}
 
-    Array Forward(const Array& x) override { return pool_impl_.Forward(x); }
+    Array Forward(const Array& x) override {
+        ProfileRange profile_range{"kernel", "AveragePoolForward"};
+        return pool_impl_.Forward(x);
+    }
 
-    Array Backward(const Array& gout) override { return pool_impl_.Backward(gout); }
+    Array Backward(const Array& gout) override {
+        ProfileRange profile_range{"kernel", "AveragePoolBackward"};
+        return pool_impl_.Backward(gout);
+    }
 
 private:
     PoolImpl pool_impl_;
@@ -14,6 +14,7 @@
 #include "chainerx/dtype.h"
 #include "chainerx/macro.h"
 #include "chainerx/numeric_limits.h"
+#include "chainerx/profiler.h"
 #include "chainerx/reduction_kernel_arg.h"
 #include "chainerx/shape.h"
 
@@ -41,6 +42,7 @@ struct ArgMaxImpl {
 
 void CudaDevice::ArgMax(const Array& a, const Axes& axis, const Array& out) {
     CheckDevicesCompatible(a, out);
+    ProfileRange profile_range{"kernel", "ArgMax"};
     CudaSetDeviceScope scope{index()};
     VisitDtype(a.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -61,6 +63,7 @@ struct SumImpl {
 }  // namespace
 
 void CudaDevice::Sum(const Array& a, const Axes& axis, const Array& out) {
+    ProfileRange profile_range{"kernel", "Sum"};
     CHAINERX_ASSERT(internal::IsValidReductionShape(a.shape(), axis, out.shape(), true));
     CheckDevicesCompatible(a, out);
     CudaSetDeviceScope scope{index()};
@@ -96,6 +99,7 @@ struct AMaxImpl {
 }  // namespace
 
 void CudaDevice::AMax(const Array& a, const Axes& axis, const Array& out) {
+    ProfileRange profile_range{"kernel", "AMax"};
     CHAINERX_ASSERT(internal::IsValidReductionShape(a.shape(), axis, out.shape(), true));
     CheckDevicesCompatible(a, out);
     CudaSetDeviceScope scope{index()};
@@ -9,6 +9,7 @@
 #include "chainerx/error.h"
 #include "chainerx/macro.h"
 #include "chainerx/native/native_backend.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/math.h"
 #include "chainerx/routines/statistics.h"
@@ -93,6 +94,7 @@ void GenericBatchNormForwardBackward::SetForwardResults(Array x, Array gamma, Ar
 }
 
 Array GenericBatchNormForwardBackward::Forward(const Array& x, const Array& gamma, const Array& beta) {
+    ProfileRange profile_range{"kernel", "BatchNormForward"};
     CHAINERX_ASSERT(internal::GetArrayBody(x)->nodes().empty());
     CHAINERX_ASSERT(internal::GetArrayBody(gamma)->nodes().empty());
     CHAINERX_ASSERT(internal::GetArrayBody(beta)->nodes().empty());
@@ -117,6 +119,7 @@ Array GenericBatchNormForwardBackward::Forward(const Array& x, const Array& gamm
 }
 
 std::array<Array, 3> GenericBatchNormForwardBackward::Backward(const Array& gout) {
+    ProfileRange profile_range{"kernel", "BatchNormBackward"};
     CHAINERX_ASSERT(internal::GetArrayBody(gout)->nodes().empty());
 
     // Note: x_inv_std_ has the information of eps.
@@ -137,6 +140,7 @@ std::array<Array, 3> GenericBatchNormForwardBackward::Backward(const Array& gout
 
 Array Device::FixedBatchNorm(
         const Array& x, const Array& gamma, const Array& beta, const Array& mean, const Array& var, Scalar eps, const Axes& axis) {
+    ProfileRange profile_range{"kernel", "FixedBatchNorm"};
     ApplyBatchNormResult result = ApplyBatchNorm(x, gamma, beta, mean, var, eps, axis);
     return std::move(result.out);
 }
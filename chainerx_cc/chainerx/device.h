@@ -88,12 +88,18 @@ public:
     Device& operator=(Device&&) = delete;
 
     // Allocates a memory chunk on this device.
+    // Implementations should first try internal::AllocateFromDefaultArena() so that an active ArenaScope can serve the request.
     virtual std::shared_ptr<void> Allocate(size_t bytesize) = 0;
 
     // Makes an array data pointer from a foreign pointer without copying.
     // May throw an error if the foreign pointer is invalid for this device.
     virtual std::shared_ptr<void> MakeDataFromForeignPointer(const std::shared_ptr<void>& data) { return data; }
 
+    // Returns the number of references to the data of this device, excluding those held by the device itself, e.g. by kernels which are
+    // enqueued but not finished yet. Such references never make the data shared, since the kernels are executed before any kernels
+    // enqueued later.
+    virtual long GetDataUseCount(const std::shared_ptr<void>& data) const { return data.use_count(); }
+
     // Copies the data between devices.
     // The other device may or may not be the same as this device.
     // The caller must guarantee that:
@@ -0,0 +1,252 @@
+#include "chainerx/graph_memory.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/array_body.h"
+#include "chainerx/array_node.h"
+#include "chainerx/dtype.h"
+#include "chainerx/graph.h"
+#include "chainerx/op_node.h"
+#include "chainerx/shape.h"
+#include "chainerx/strides.h"
+
+namespace chainerx {
+namespace {
+
+using internal::ArrayNode;
+using internal::OpNode;
+
+// Maps each buffer to the largest extent used by the arrays viewing it.
+class BufferSet {
+public:
+    void Add(const void* data, int64_t bytesize) {
+        int64_t& size = sizes_[data];
+        size = std::max(size, bytesize);
+    }
+
+    int64_t GetTotalBytes() const {
+        int64_t total{0};
+        for (const auto& pair : sizes_) {
+            total += pair.second;
+        }
+        return total;
+    }
+
+private:
+    std::unordered_map<const void*, int64_t> sizes_;
+};
+
+int64_t GetBufferExtent(const internal::ArrayBody& body) {
+    if (body.GetTotalSize() == 0) {
+        return 0;
+    }
+    return body.offset() + std::get<1>(GetDataRange(body.shape(), body.strides(), body.GetItemSize()));
+}
+
+// Adds the gradient of the array node, if any.
+void AddGrad(const ArrayNode& array_node, BufferSet& buffers, BufferSet& all_buffers) {
+    std::shared_ptr<internal::ArrayBody> body = array_node.weak_body().lock();
+    if (body == nullptr) {
+        return;
+    }
+    const nonstd::optional<Array>* grad = body->GetGrad(array_node.backprop_id());
+    if (grad == nullptr || !grad->has_value()) {
+        return;
+    }
+    const internal::ArrayBody& grad_body = *internal::GetArrayBody(**grad);
+    buffers.Add(grad_body.data().get(), GetBufferExtent(grad_body));
+    all_buffers.Add(grad_body.data().get(), GetBufferExtent(grad_body));
+}
+
+// Adds the buffer of an output array retained by the backward functions of an op node.
+// The buffer is looked up through the array body if it is still alive. Otherwise, the buffer is only reachable from the backward
+// functions, and it is identified by the given key and sized from the shape and the dtype.
+void AddRetained(
+        const ArrayNode* array_node, const Shape& shape, Dtype dtype, const void* key, BufferSet& buffers, BufferSet& all_buffers) {
+    const void* data = key;
+    int64_t bytesize = shape.GetTotalSize() * GetItemSize(dtype);
+    if (array_node != nullptr) {
+        if (std::shared_ptr<internal::ArrayBody> body = array_node->weak_body().lock()) {
+            data = body->data().get();
+            bytesize = GetBufferExtent(*body);
+        }
+    }
+    buffers.Add(data, bytesize);
+    all_buffers.Add(data, bytesize);
+}
+
+// Escapes a string to be quoted in JSON or DOT.
+std::string Escape(const std::string& str) {
+    std::string escaped;
+    for (char c : str) {
+        if (c == '"' || c == '\\') {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+}  // namespace
+
+std::string GraphMemoryUsage::ToJson() const {
+    std::ostringstream os;
+    os << "{\"backprop_id\":\"" << Escape(backprop_id_name) << "\",\"total_bytes\":" << total_bytes
+       << ",\"leaf_grad_bytes\":" << leaf_grad_bytes << ",\"op_nodes\":[";
+    for (const OpNodeMemoryUsage& op_node : op_nodes) {
+        if (op_node.id != 0) {
+            os << ",";
+        }
+        os << "{\"id\":" << op_node.id << ",\"name\":\"" << Escape(op_node.name) << "\",\"rank\":" << op_node.rank
+           << ",\"retained_input_bytes\":" << op_node.retained_input_bytes << ",\"retained_output_bytes\":" << op_node.retained_output_bytes
+           << ",\"grad_bytes\":" << op_node.grad_bytes << ",\"inputs\":[";
+        for (auto it = op_node.input_op_node_ids.begin(); it != op_node.input_op_node_ids.end(); ++it) {
+            if (it != op_node.input_op_node_ids.begin()) {
+                os << ",";
+            }
+            os << *it;
+        }
+        os << "]}";
+    }
+    os << "]}";
+    return os.str();
+}
+
+std::string GraphMemoryUsage::ToDot() const {
+    std::ostringstream os;
+    os << "digraph {\n";
+    os << "  label=\"" << Escape(backprop_id_name) << " (total " << total_bytes << " bytes)\";\n";
+    os << "  node [shape=box];\n";
+    for (const OpNodeMemoryUsage& op_node : op_nodes) {
+        os << "  op" << op_node.id << " [label=\"" << Escape(op_node.name) << "\\nretained inputs: " << op_node.retained_input_bytes
+           << " bytes\\nretained outputs: " << op_node.retained_output_bytes << " bytes\\ngrads: " << op_node.grad_bytes << " bytes\"];\n";
+    }
+    for (const OpNodeMemoryUsage& op_node : op_nodes) {
+        for (size_t input_id : op_node.input_op_node_ids) {
+            os << "  op" << input_id << " -> op" << op_node.id << ";\n";
+        }
+    }
+    os << "}\n";
+    return os.str();
+}
+
+GraphMemoryUsage GetGraphMemoryUsage(const std::vector<ConstArrayRef>& outputs, const nonstd::optional<BackpropId>& backprop_id) {
+    GraphMemoryUsage usage{};
+    if (outputs.empty()) {
+        return usage;
+    }
+    BackpropId actual_backprop_id = internal::GetArrayBackpropId(outputs.front(), backprop_id);
+    usage.backprop_id_name = actual_backprop_id.GetName();
+
+    // Collect the op nodes reachable from the outputs.
+    std::vector<const OpNode*> op_nodes;
+    std::unordered_map<const OpNode*, size_t> op_node_ids;
+    std::vector<const ArrayNode*> leaf_array_nodes;
+    std::queue<const OpNode*> candidates;
+    auto push_creator = [&op_node_ids, &op_nodes, &candidates, &leaf_array_nodes](const ArrayNode& array_node) {
+        std::shared_ptr<const OpNode> creator = array_node.creator_op_node();
+        if (creator == nullptr) {
+            leaf_array_nodes.emplace_back(&array_node);
+        } else if (op_node_ids.emplace(creator.get(), op_nodes.size()).second) {
+            op_nodes.emplace_back(creator.get());
+            candidates.push(creator.get());
+        }
+    };
+    for (const Array& output : outputs) {
+        const std::shared_ptr<internal::ArrayBody>& body = internal::GetArrayBody(output);
+        if (body->HasArrayNode(actual_backprop_id)) {
+            push_creator(*body->GetArrayNode(actual_backprop_id));
+        }
+    }
+    while (!candidates.empty()) {
+        const OpNode* op_node = candidates.front();
+        candidates.pop();
+        for (const std::shared_ptr<ArrayNode>& input_array_node : op_node->input_array_nodes()) {
+            if (input_array_node != nullptr) {
+                push_creator(*input_array_node);
+            }
+        }
+    }
+
+    // Op nodes with higher ranks are closer to the outputs.
+    std::stable_sort(op_nodes.begin(), op_nodes.end(), [](const OpNode* lhs, const OpNode* rhs) { return lhs->rank() > rhs->rank(); });
+    for (size_t i = 0; i < op_nodes.size(); ++i) {
+        op_node_ids[op_nodes[i]] = i;
+    }
+
+    BufferSet all_buffers{};
+    for (size_t i = 0; i < op_nodes.size(); ++i) {
+        const OpNode& op_node = *op_nodes[i];
+        OpNodeMemoryUsage op_node_usage{};
+        op_node_usage.id = i;
+        op_node_usage.name = op_node.name();
+        op_node_usage.rank = op_node.rank();
+
+        BufferSet retained_inputs{};
+        BufferSet retained_outputs{};
+        // Retained inputs are counted from the buffers recorded by the op node, also those without array nodes on this graph.
+        for (const internal::RetainedBuffer& buffer : op_node.retained_input_buffers()) {
+            retained_inputs.Add(buffer.data, buffer.extent);
+            all_buffers.Add(buffer.data, buffer.extent);
+        }
+        for (size_t j = 0; j < op_node.output_array_node_count(); ++j) {
+            if (!op_node.IsOutputRetained(j)) {
+                continue;
+            }
+            const internal::ArrayProps& props = op_node.GetOutputArrayProps(j);
+            std::shared_ptr<ArrayNode> output_array_node{};
+            if (const nonstd::optional<std::weak_ptr<ArrayNode>>& weak_output_array_node = op_node.output_array_nodes()[j]) {
+                output_array_node = weak_output_array_node->lock();
+            }
+            AddRetained(output_array_node.get(), props.shape, props.dtype, &props, retained_outputs, all_buffers);
+        }
+        op_node_usage.retained_input_bytes = retained_inputs.GetTotalBytes();
+        op_node_usage.retained_output_bytes = retained_outputs.GetTotalBytes();
+
+        BufferSet grads{};
+        for (const nonstd::optional<std::weak_ptr<ArrayNode>>& output_array_node : op_node.output_array_nodes()) {
+            if (!output_array_node.has_value()) {
+                continue;
+            }
+            if (std::shared_ptr<ArrayNode> array_node = output_array_node->lock()) {
+                AddGrad(*array_node, grads, all_buffers);
+            }
+        }
+        op_node_usage.grad_bytes = grads.GetTotalBytes();
+
+        for (const std::shared_ptr<ArrayNode>& input_array_node : op_node.input_array_nodes()) {
+            if (input_array_node == nullptr) {
+                continue;
+            }
+            std::shared_ptr<const OpNode> creator = input_array_node->creator_op_node();
+            if (creator != nullptr) {
+                op_node_usage.input_op_node_ids.emplace_back(op_node_ids.at(creator.get()));
+            }
+        }
+
+        usage.op_nodes.emplace_back(std::move(op_node_usage));
+    }
+
+    BufferSet leaf_grads{};
+    for (const ArrayNode* array_node : leaf_array_nodes) {
+        AddGrad(*array_node, leaf_grads, all_buffers);
+    }
+    usage.leaf_grad_bytes = leaf_grads.GetTotalBytes();
+    usage.total_bytes = all_buffers.GetTotalBytes();
+    return usage;
+}
+
+}  // namespace chainerx
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array_fwd.h"
+#include "chainerx/graph.h"
+
+namespace chainerx {
+
+// Memory held by an op node of a computation graph.
+struct OpNodeMemoryUsage {
+    // Index of the op node in GraphMemoryUsage::op_nodes.
+    size_t id{};
+
+    std::string name;
+
+    int64_t rank{};
+
+    // Bytes of the input and output buffers retained for the backward functions.
+    int64_t retained_input_bytes{};
+    int64_t retained_output_bytes{};
+
+    // Bytes of the gradients currently held by the output array nodes, i.e. during backprop.
+    int64_t grad_bytes{};
+
+    // IDs of the op nodes that created the inputs of this op node.
+    std::vector<size_t> input_op_node_ids;
+};
+
+// Memory held by a computation graph, reported by GetGraphMemoryUsage().
+//
+// Sizes are measured in bytes from the head of each buffer to the end of the array viewing it.
+// Buffers shared among arrays are counted once per op node and once in the total.
+// A retained array whose body has been released is only held by the backward functions. Its buffer cannot be identified, so it is
+// sized from its shape and dtype and counted separately.
+struct GraphMemoryUsage {
+    std::string backprop_id_name;
+
+    // Op nodes in the topological order from the outputs to the inputs.
+    std::vector<OpNodeMemoryUsage> op_nodes;
+
+    // Bytes of the gradients held by the leaf array nodes.
+    int64_t leaf_grad_bytes{};
+
+    // Bytes of all the distinct buffers held by the graph.
+    int64_t total_bytes{};
+
+    std::string ToJson() const;
+
+    // Returns the graph in the DOT language, whose nodes are annotated with their sizes.
+    std::string ToDot() const;
+};
+
+// Walks the graph reachable from the outputs and reports the memory held by each op node.
+GraphMemoryUsage GetGraphMemoryUsage(
+        const std::vector<ConstArrayRef>& outputs, const nonstd::optional<BackpropId>& backprop_id = nonstd::nullopt);
+
+}  // namespace chainerx
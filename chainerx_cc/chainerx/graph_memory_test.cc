@@ -0,0 +1,157 @@
+#include "chainerx/graph_memory.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/backprop_scope.h"
+#include "chainerx/backward.h"
+#include "chainerx/dtype.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/linalg.h"
+#include "chainerx/routines/math.h"
+#include "chainerx/testing/context_session.h"
+
+namespace chainerx {
+namespace {
+
+constexpr int64_t kBytes = 2 * 3 * sizeof(float);
+
+TEST(GraphMemoryTest, RetainedArrays) {
+    testing::ContextSession context_session;
+    BackpropScope backprop_scope{"bp"};
+    BackpropId backprop_id = backprop_scope.backprop_id();
+
+    Array x1 = Ones({2, 3}, Dtype::kFloat32).RequireGrad(backprop_id);
+    Array x2 = Ones({2, 3}, Dtype::kFloat32).RequireGrad(backprop_id);
+    Array y = x1 * x2;
+    Array z = Exp(y);
+
+    GraphMemoryUsage usage = GetGraphMemoryUsage({z}, backprop_id);
+    EXPECT_EQ("bp", usage.backprop_id_name);
+    ASSERT_EQ(size_t{2}, usage.op_nodes.size());
+
+    const OpNodeMemoryUsage& exp = usage.op_nodes[0];
+    EXPECT_EQ("exp", exp.name);
+    EXPECT_EQ(0, exp.retained_input_bytes);
+    EXPECT_EQ(kBytes, exp.retained_output_bytes);
+    EXPECT_EQ(std::vector<size_t>{1}, exp.input_op_node_ids);
+
+    const OpNodeMemoryUsage& multiply = usage.op_nodes[1];
+    EXPECT_EQ("multiply", multiply.name);
+    EXPECT_EQ(2 * kBytes, multiply.retained_input_bytes);
+    EXPECT_EQ(0, multiply.retained_output_bytes);
+    EXPECT_TRUE(multiply.input_op_node_ids.empty());
+
+    EXPECT_EQ(0, usage.leaf_grad_bytes);
+    EXPECT_EQ(3 * kBytes, usage.total_bytes);
+
+    // The graph is kept alive to inspect the gradients of the leaves.
+    Backward(z, backprop_id, DoubleBackpropOption::kEnable);
+    usage = GetGraphMemoryUsage({z}, backprop_id);
+    EXPECT_EQ(kBytes, usage.op_nodes[0].grad_bytes);
+    EXPECT_EQ(0, usage.op_nodes[1].grad_bytes);
+    EXPECT_EQ(2 * kBytes, usage.leaf_grad_bytes);
+    EXPECT_EQ(6 * kBytes, usage.total_bytes);
+}
+
+TEST(GraphMemoryTest, ReleasedArrayBodies) {
+    testing::ContextSession context_session;
+    BackpropScope backprop_scope{"bp"};
+    BackpropId backprop_id = backprop_scope.backprop_id();
+
+    // The retained arrays are only held by the backward functions.
+    Array z{};
+    {
+        Array x1 = Ones({2, 3}, Dtype::kFloat32).RequireGrad(backprop_id);
+        Array x2 = Ones({2, 3}, Dtype::kFloat32).RequireGrad(backprop_id);
+        z = Exp(x1 * x2);
+    }
+
+    GraphMemoryUsage usage = GetGraphMemoryUsage({z}, backprop_id);
+    ASSERT_EQ(size_t{2}, usage.op_nodes.size());
+    EXPECT_EQ(kBytes, usage.op_nodes[0].retained_output_bytes);
+    EXPECT_EQ(2 * kBytes, usage.op_nodes[1].retained_input_bytes);
+    EXPECT_EQ(3 * kBytes, usage.total_bytes);
+}
+
+TEST(GraphMemoryTest, SharedBuffers) {
+    testing::ContextSession context_session;
+    BackpropScope backprop_scope{"bp"};
+    BackpropId backprop_id = backprop_scope.backprop_id();
+
+    // Both retained inputs view the same buffer.
+    Array x = Ones({2, 3}, Dtype::kFloat32).RequireGrad(backprop_id);
+    Array y = x * x;
+    Array x0 = x.At({0}).BroadcastTo({2, 3});
+    Array z = y * x0;
+
+    GraphMemoryUsage usage = GetGraphMemoryUsage({z}, backprop_id);
+    auto it = std::find_if(usage.op_nodes.begin(), usage.op_nodes.end(), [](const OpNodeMemoryUsage& op_node) {
+        return op_node.name == "multiply" && op_node.input_op_node_ids.empty();
+    });
+    ASSERT_NE(usage.op_nodes.end(), it);
+    EXPECT_EQ(kBytes, it->retained_input_bytes);
+
+    // The buffers of x and y.
+    EXPECT_EQ(2 * kBytes, usage.total_bytes);
+}
+
+TEST(GraphMemoryTest, RetainedInputsWithoutArrayNodes) {
+    testing::ContextSession context_session;
+    BackpropScope backprop_scope{"bp"};
+    BackpropId backprop_id = backprop_scope.backprop_id();
+
+    // x is retained for the gradient of w, though x itself has no array node on the graph.
+    Array z{};
+    {
+        Array x = Ones({2, 3}, Dtype::kFloat32);
+        Array w = Ones({3, 4}, Dtype::kFloat32).RequireGrad(backprop_id);
+        z = Dot(x, w);
+    }
+
+    GraphMemoryUsage usage = GetGraphMemoryUsage({z}, backprop_id);
+    ASSERT_EQ(size_t{1}, usage.op_nodes.size());
+    EXPECT_EQ("dot", usage.op_nodes[0].name);
+    EXPECT_EQ(kBytes, usage.op_nodes[0].retained_input_bytes);
+    EXPECT_EQ(kBytes, usage.total_bytes);
+}
+
+TEST(GraphMemoryTest, NoGraph) {
+    testing::ContextSession context_session;
+    Array x = Ones({2, 3}, Dtype::kFloat32);
+    Array y = Exp(x);
+
+    GraphMemoryUsage usage = GetGraphMemoryUsage({y});
+    EXPECT_TRUE(usage.op_nodes.empty());
+    EXPECT_EQ(0, usage.total_bytes);
+    EXPECT_EQ("{\"backprop_id\":\"<default>\",\"total_bytes\":0,\"leaf_grad_bytes\":0,\"op_nodes\":[]}", usage.ToJson());
+}
+
+TEST(GraphMemoryTest, ToJsonAndDot) {
+    testing::ContextSession context_session;
+    BackpropScope backprop_scope{"bp"};
+    BackpropId backprop_id = backprop_scope.backprop_id();
+
+    Array x = Ones({2, 3}, Dtype::kFloat32).RequireGrad(backprop_id);
+    Array z = Exp(Exp(x));
+    GraphMemoryUsage usage = GetGraphMemoryUsage({z}, backprop_id);
+
+    std::string json = usage.ToJson();
+    EXPECT_EQ(0U, json.find("{\"backprop_id\":\"bp\",\"total_bytes\":48,"));
+    EXPECT_NE(
+            std::string::npos,
+            json.find("{\"id\":0,\"name\":\"exp\",\"rank\":2,\"retained_input_bytes\":0,\"retained_output_bytes\":24,\"grad_bytes\":0,"
+                      "\"inputs\":[1]}"));
+
+    std::string dot = usage.ToDot();
+    EXPECT_EQ(0U, dot.find("digraph {\n"));
+    EXPECT_NE(std::string::npos, dot.find("op0 [label=\"exp\\nretained inputs: 0 bytes\\nretained outputs: 24 bytes\\ngrads: 0 bytes\"];"));
+    EXPECT_NE(std::string::npos, dot.find("op1 -> op0;"));
+}
+
+}  // namespace
+}  // namespace chainerx
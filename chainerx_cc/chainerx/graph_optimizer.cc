@@ -0,0 +1,271 @@
+#include "chainerx/graph_optimizer.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ios>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/axes.h"
+#include "chainerx/backprop_mode.h"
+#include "chainerx/dtype.h"
+#include "chainerx/recorded_graph.h"
+#include "chainerx/scalar.h"
+
+namespace chainerx {
+namespace {
+
+bool IsIdentityAxes(const Axes& axes) {
+    for (size_t i = 0; i < axes.size(); ++i) {
+        if (axes[i] != static_cast<int8_t>(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Returns the input that the node is equivalent to, if any.
+nonstd::optional<GraphNodeId> GetEquivalentInput(const RecordedGraph& graph, const GraphNode& node) {
+    if (node.inputs.size() != 1) {
+        return nonstd::nullopt;
+    }
+    GraphNodeId input = node.inputs.front();
+    const GraphNode& input_node = graph.nodes()[input];
+    switch (node.kind) {
+        case GraphOpKind::kTranspose:
+            return IsIdentityAxes(node.axes) ? nonstd::make_optional(input) : nonstd::nullopt;
+        case GraphOpKind::kReshape:
+            return node.shape == input_node.shape ? nonstd::make_optional(input) : nonstd::nullopt;
+        case GraphOpKind::kSum:
+            return node.axes.empty() && node.dtype == input_node.dtype ? nonstd::make_optional(input) : nonstd::nullopt;
+        case GraphOpKind::kNegative:
+            if (input_node.kind == GraphOpKind::kNegative) {
+                return input_node.inputs.front();
+            }
+            return nonstd::nullopt;
+        case GraphOpKind::kAddScalar:
+            return static_cast<double>(node.scalar) == 0 ? nonstd::make_optional(input) : nonstd::nullopt;
+        case GraphOpKind::kMultiplyScalar:
+            return static_cast<double>(node.scalar) == 1 ? nonstd::make_optional(input) : nonstd::nullopt;
+        default:
+            return nonstd::nullopt;
+    }
+}
+
+// Writes the exact value of the scalar, so that close but different scalars make different keys.
+void WriteScalarKey(std::ostream& os, Scalar scalar) {
+    os << GetDtypeName(scalar.dtype()) << ';';
+    if (GetKind(scalar.dtype()) == DtypeKind::kFloat) {
+        os << std::hexfloat << static_cast<double>(scalar) << std::defaultfloat;
+    } else {
+        os << static_cast<int64_t>(scalar);
+    }
+}
+
+// Returns a key which is equal for nodes computing the same value.
+std::string GetNodeKey(const GraphNode& node) {
+    std::ostringstream os;
+    os << static_cast<int>(node.kind) << ';' << node.no_backprop << ';';
+    for (GraphNodeId input : node.inputs) {
+        os << input << ',';
+    }
+    switch (node.kind) {
+        case GraphOpKind::kConstant:
+            os << ';' << internal::GetArrayBody(*node.value).get() << ';' << node.value->offset() << ';' << node.value->strides() << ';'
+               << node.shape;
+            break;
+        case GraphOpKind::kAddScalar:
+        case GraphOpKind::kMultiplyScalar:
+            os << ';';
+            WriteScalarKey(os, node.scalar);
+            break;
+        case GraphOpKind::kSum:
+            os << ';' << node.axes << ';' << node.keepdims;
+            break;
+        case GraphOpKind::kTranspose:
+            os << ';' << node.axes;
+            break;
+        case GraphOpKind::kReshape:
+            os << ';' << node.shape;
+            break;
+        default:
+            break;
+    }
+    return os.str();
+}
+
+// Returns the nodes that the flagged outputs depend on.
+std::vector<bool> GetLiveNodes(const RecordedGraph& graph, bool requires_grad_only) {
+    const std::vector<GraphNode>& nodes = graph.nodes();
+    std::vector<bool> is_live(nodes.size());
+    for (const GraphOutput& output : graph.outputs()) {
+        if (output.requires_grad || !requires_grad_only) {
+            is_live[output.node] = true;
+        }
+    }
+    // Nodes are in a topological order.
+    for (size_t i = nodes.size(); i > 0; --i) {
+        if (!is_live[i - 1]) {
+            continue;
+        }
+        for (GraphNodeId input : nodes[i - 1].inputs) {
+            is_live[input] = true;
+        }
+    }
+    return is_live;
+}
+
+}  // namespace
+
+int64_t AlgebraicSimplificationPass::Run(RecordedGraph& graph) {
+    int64_t rewrite_count{0};
+    for (GraphNodeId id = 0; id < graph.nodes().size(); ++id) {
+        GraphNode& node = graph.node(id);
+        if (node.inputs.size() == 1) {
+            const GraphNode& input_node = graph.nodes()[node.inputs.front()];
+            if (node.kind == GraphOpKind::kTranspose && input_node.kind == GraphOpKind::kTranspose) {
+                // Transpose(Transpose(x, a), b) is Transpose(x, c) where c[i] = a[b[i]].
+                Axes axes{};
+                for (int8_t axis : node.axes) {
+                    axes.emplace_back(input_node.axes[axis]);
+                }
+                node.axes = axes;
+                node.inputs = input_node.inputs;
+                ++rewrite_count;
+            } else if (node.kind == GraphOpKind::kReshape && input_node.kind == GraphOpKind::kReshape) {
+                node.inputs = input_node.inputs;
+                ++rewrite_count;
+            }
+        }
+
+        if (nonstd::optional<GraphNodeId> input = GetEquivalentInput(graph, node)) {
+            graph.ReplaceAllUsesWith(id, *input);
+            ++rewrite_count;
+        }
+    }
+    return rewrite_count;
+}
+
+int64_t ConstantFoldingPass::Run(RecordedGraph& graph) {
+    int64_t rewrite_count{0};
+    NoBackpropModeScope scope{};
+    std::vector<Array> inputs{};
+    for (GraphNodeId id = 0; id < graph.nodes().size(); ++id) {
+        GraphNode& node = graph.node(id);
+        if (node.kind == GraphOpKind::kInput || node.kind == GraphOpKind::kConstant) {
+            continue;
+        }
+        inputs.clear();
+        for (GraphNodeId input : node.inputs) {
+            const GraphNode& input_node = graph.nodes()[input];
+            if (input_node.kind != GraphOpKind::kConstant) {
+                break;
+            }
+            inputs.emplace_back(*input_node.value);
+        }
+        if (inputs.size() != node.inputs.size()) {
+            continue;
+        }
+        node.value = RecordedGraph::Evaluate(node, inputs);
+        node.kind = GraphOpKind::kConstant;
+        node.inputs.clear();
+        ++rewrite_count;
+    }
+    return rewrite_count;
+}
+
+int64_t CommonSubexpressionEliminationPass::Run(RecordedGraph& graph) {
+    int64_t rewrite_count{0};
+    std::unordered_map<std::string, GraphNodeId> node_ids{};
+    for (GraphNodeId id = 0; id < graph.nodes().size(); ++id) {
+        const GraphNode& node = graph.nodes()[id];
+        if (node.kind == GraphOpKind::kInput) {
+            continue;
+        }
+        // Inputs of the node have already been replaced with their first occurrences.
+        auto pair = node_ids.emplace(GetNodeKey(node), id);
+        if (!pair.second) {
+            graph.ReplaceAllUsesWith(id, pair.first->second);
+            ++rewrite_count;
+        }
+    }
+    return rewrite_count;
+}
+
+int64_t BackpropPruningPass::Run(RecordedGraph& graph) {
+    int64_t rewrite_count{0};
+    std::vector<bool> is_live = GetLiveNodes(graph, false);
+    std::vector<bool> is_backpropped = GetLiveNodes(graph, true);
+    for (GraphNodeId id = 0; id < graph.nodes().size(); ++id) {
+        GraphNode& node = graph.node(id);
+        // Dead nodes are left to DeadNodeEliminationPass.
+        if (node.kind == GraphOpKind::kInput || node.kind == GraphOpKind::kConstant || !is_live[id]) {
+            continue;
+        }
+        bool no_backprop = !is_backpropped[id];
+        if (no_backprop && !node.no_backprop) {
+            ++rewrite_count;
+        }
+        node.no_backprop = no_backprop;
+    }
+    return rewrite_count;
+}
+
+int64_t DeadNodeEliminationPass::Run(RecordedGraph& graph) {
+    std::vector<bool> is_live = GetLiveNodes(graph, false);
+    std::vector<bool> is_removed(is_live.size());
+    int64_t rewrite_count{0};
+    for (GraphNodeId id = 0; id < is_live.size(); ++id) {
+        if (!is_live[id] && graph.nodes()[id].kind != GraphOpKind::kInput) {
+            is_removed[id] = true;
+            ++rewrite_count;
+        }
+    }
+    if (rewrite_count > 0) {
+        graph.RemoveNodes(is_removed);
+    }
+    return rewrite_count;
+}
+
+GraphPassManager GraphPassManager::CreateDefault() {
+    GraphPassManager manager{};
+    manager.AddPass(std::make_unique<AlgebraicSimplificationPass>());
+    manager.AddPass(std::make_unique<ConstantFoldingPass>());
+    manager.AddPass(std::make_unique<CommonSubexpressionEliminationPass>());
+    manager.AddPass(std::make_unique<BackpropPruningPass>());
+    manager.AddPass(std::make_unique<DeadNodeEliminationPass>());
+    return manager;
+}
+
+void GraphPassManager::AddPass(std::unique_ptr<GraphPass> pass) { passes_.emplace_back(std::move(pass)); }
+
+std::vector<GraphPassStats> GraphPassManager::Run(RecordedGraph& graph) {
+    std::vector<GraphPassStats> stats{};
+    stats.reserve(passes_.size());
+    for (const std::unique_ptr<GraphPass>& pass : passes_) {
+        GraphPassStats pass_stats{};
+        pass_stats.name = pass->name();
+        pass_stats.node_count_before = graph.nodes().size();
+
+        auto start = std::chrono::steady_clock::now();
+        pass_stats.rewrite_count = pass->Run(graph);
+        pass_stats.duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+        pass_stats.node_count_after = graph.nodes().size();
+        stats.emplace_back(std::move(pass_stats));
+    }
+    return stats;
+}
+
+std::vector<GraphPassStats> OptimizeGraph(RecordedGraph& graph) { return GraphPassManager::CreateDefault().Run(graph); }
+
+}  // namespace chainerx
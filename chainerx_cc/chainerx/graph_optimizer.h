@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chainerx/recorded_graph.h"
+
+namespace chainerx {
+
+// Rewrite of a recorded graph which preserves the values of its outputs.
+class GraphPass {
+public:
+    virtual ~GraphPass() = default;
+
+    virtual const char* name() const = 0;
+
+    // Rewrites the graph and returns the number of rewrites.
+    virtual int64_t Run(RecordedGraph& graph) = 0;
+};
+
+// Folds transpose-of-transpose and reshape-of-reshape chains, and removes no-op transposes, reshapes, sums, double negations,
+// additions of 0 and multiplications by 1.
+class AlgebraicSimplificationPass : public GraphPass {
+public:
+    const char* name() const override { return "algebraic_simplification"; }
+    int64_t Run(RecordedGraph& graph) override;
+};
+
+// Evaluates the ops whose inputs are all constants and replaces them with their values.
+class ConstantFoldingPass : public GraphPass {
+public:
+    const char* name() const override { return "constant_folding"; }
+    int64_t Run(RecordedGraph& graph) override;
+};
+
+// Merges the ops which take the same inputs with the same attributes.
+class CommonSubexpressionEliminationPass : public GraphPass {
+public:
+    const char* name() const override { return "common_subexpression_elimination"; }
+    int64_t Run(RecordedGraph& graph) override;
+};
+
+// Marks the ops that none of the outputs requiring gradients depend on, so that they are executed without building the computation graph.
+class BackpropPruningPass : public GraphPass {
+public:
+    const char* name() const override { return "backprop_pruning"; }
+    int64_t Run(RecordedGraph& graph) override;
+};
+
+// Removes the ops that none of the outputs depend on. Input nodes are kept to validate the inputs on execution.
+class DeadNodeEliminationPass : public GraphPass {
+public:
+    const char* name() const override { return "dead_node_elimination"; }
+    int64_t Run(RecordedGraph& graph) override;
+};
+
+struct GraphPassStats {
+    std::string name;
+    int64_t rewrite_count{};
+    size_t node_count_before{};
+    size_t node_count_after{};
+    int64_t duration_ns{};
+};
+
+// Runs a sequence of passes over recorded graphs.
+class GraphPassManager {
+public:
+    // Creates a manager running all the passes above, in the order of their declarations.
+    static GraphPassManager CreateDefault();
+
+    void AddPass(std::unique_ptr<GraphPass> pass);
+
+    // Runs the passes in the order they were added, and returns the statistics of each run.
+    std::vector<GraphPassStats> Run(RecordedGraph& graph);
+
+    size_t pass_count() const { return passes_.size(); }
+
+private:
+    std::vector<std::unique_ptr<GraphPass>> passes_;
+};
+
+// Optimizes the graph with the default passes.
+std::vector<GraphPassStats> OptimizeGraph(RecordedGraph& graph);
+
+}  // namespace chainerx
@@ -0,0 +1,207 @@
+#include "chainerx/graph_optimizer.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/backward.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/recorded_graph.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/math.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+size_t CountNodes(const RecordedGraph& graph, GraphOpKind kind) {
+    return std::count_if(graph.nodes().begin(), graph.nodes().end(), [kind](const GraphNode& node) { return node.kind == kind; });
+}
+
+TEST(GraphOptimizerTest, AlgebraicSimplification) {
+    RecordedGraph graph{};
+    GraphNodeId x = graph.AddInput({2, 3, 4}, Dtype::kFloat32);
+    GraphNodeId t = graph.Transpose(graph.Transpose(x, Axes{1, 2, 0}), Axes{2, 0, 1});
+    GraphNodeId t2 = graph.Transpose(graph.Transpose(x, Axes{1, 0, 2}), Axes{0, 2, 1});
+    GraphNodeId r = graph.Reshape(graph.Reshape(graph.Reshape(x, {6, 4}), {24}), {4, 6});
+    GraphNodeId n = graph.MultiplyScalar(graph.Negative(graph.Negative(graph.AddScalar(x, 0.f))), 1.f);
+    graph.AddOutput(t);
+    graph.AddOutput(t2);
+    graph.AddOutput(r);
+    graph.AddOutput(n);
+
+    AlgebraicSimplificationPass pass{};
+    EXPECT_EQ(8, pass.Run(graph));
+    EXPECT_EQ(x, graph.outputs()[0].node);
+    EXPECT_EQ(x, graph.outputs()[3].node);
+
+    const GraphNode& t2_node = graph.nodes()[graph.outputs()[1].node];
+    EXPECT_EQ(std::vector<GraphNodeId>{x}, t2_node.inputs);
+    EXPECT_EQ(Axes({1, 2, 0}), t2_node.axes);
+
+    const GraphNode& r_node = graph.nodes()[graph.outputs()[2].node];
+    EXPECT_EQ(std::vector<GraphNodeId>{x}, r_node.inputs);
+    EXPECT_EQ(Shape({4, 6}), r_node.shape);
+}
+
+TEST(GraphOptimizerTest, ConstantFolding) {
+    testing::DeviceSession device_session{DeviceId{native::NativeBackend::kDefaultName, 0}};
+    Array c = (*testing::BuildArray({2}).WithData<float>({1.f, 2.f})).RequireGrad();
+
+    RecordedGraph graph{};
+    GraphNodeId x = graph.AddInput({2}, Dtype::kFloat32);
+    GraphNodeId k = graph.AddConstant(c);
+    GraphNodeId y = graph.Multiply(x, graph.AddScalar(graph.Multiply(k, k), 1.f));
+    graph.AddOutput(y);
+
+    ConstantFoldingPass pass{};
+    EXPECT_EQ(2, pass.Run(graph));
+    const GraphNode& folded = graph.nodes()[graph.nodes()[y].inputs[1]];
+    ASSERT_EQ(GraphOpKind::kConstant, folded.kind);
+    EXPECT_ARRAY_EQ(testing::BuildArray({2}).WithData<float>({2.f, 5.f}), *folded.value);
+    EXPECT_FALSE(folded.value->IsBackpropRequired());
+}
+
+TEST(GraphOptimizerTest, CommonSubexpressionElimination) {
+    RecordedGraph graph{};
+    GraphNodeId x = graph.AddInput({2, 3}, Dtype::kFloat32);
+    GraphNodeId x2 = graph.AddInput({2, 3}, Dtype::kFloat32);
+    GraphNodeId a = graph.Exp(graph.MultiplyScalar(x, 2.f));
+    GraphNodeId b = graph.Exp(graph.MultiplyScalar(x, 2.f));
+    GraphNodeId c = graph.Exp(graph.MultiplyScalar(x, 3.f));
+    GraphNodeId d = graph.Exp(x2);
+    graph.AddOutput(graph.Add(a, b));
+    graph.AddOutput(c);
+    graph.AddOutput(d);
+
+    CommonSubexpressionEliminationPass pass{};
+    EXPECT_EQ(2, pass.Run(graph));
+    EXPECT_EQ(std::vector<GraphNodeId>({a, a}), graph.nodes()[graph.outputs()[0].node].inputs);
+    EXPECT_EQ(c, graph.outputs()[1].node);
+    EXPECT_EQ(d, graph.outputs()[2].node);
+}
+
+TEST(GraphOptimizerTest, CommonSubexpressionEliminationCloseScalars) {
+    testing::DeviceSession device_session{DeviceId{native::NativeBackend::kDefaultName, 0}};
+    RecordedGraph graph{};
+    GraphNodeId x = graph.AddInput({1}, Dtype::kFloat64);
+    GraphNodeId a = graph.MultiplyScalar(x, 0.1);
+    GraphNodeId b = graph.MultiplyScalar(x, 0.1000001);
+    GraphNodeId c = graph.MultiplyScalar(x, 0.1);
+    graph.AddOutput(a);
+    graph.AddOutput(b);
+    graph.AddOutput(c);
+
+    CommonSubexpressionEliminationPass pass{};
+    EXPECT_EQ(1, pass.Run(graph));
+    EXPECT_EQ(a, graph.outputs()[0].node);
+    EXPECT_EQ(b, graph.outputs()[1].node);
+    EXPECT_EQ(a, graph.outputs()[2].node);
+
+    Array x1 = testing::BuildArray({1}).WithData<double>({1.0});
+    std::vector<Array> ys = graph.Execute({x1});
+    EXPECT_ARRAY_EQ(testing::BuildArray({1}).WithData<double>({0.1}), ys[0]);
+    EXPECT_ARRAY_EQ(testing::BuildArray({1}).WithData<double>({0.1000001}), ys[1]);
+}
+
+TEST(GraphOptimizerTest, BackpropPruningAndDeadNodeElimination) {
+    testing::DeviceSession device_session{DeviceId{native::NativeBackend::kDefaultName, 0}};
+    RecordedGraph graph{};
+    GraphNodeId x = graph.AddInput({2}, Dtype::kFloat32);
+    GraphNodeId unused = graph.AddInput({2}, Dtype::kFloat32);
+    GraphNodeId h = graph.Exp(x);
+    GraphNodeId loss = graph.Sum(h);
+    GraphNodeId metric = graph.Sum(graph.Log(h));
+    graph.Negative(h);
+    graph.AddOutput(loss);
+    graph.AddOutput(metric, false);
+
+    BackpropPruningPass pruning_pass{};
+    EXPECT_EQ(2, pruning_pass.Run(graph));
+    EXPECT_FALSE(graph.nodes()[h].no_backprop);
+    EXPECT_TRUE(graph.nodes()[metric].no_backprop);
+
+    DeadNodeEliminationPass elimination_pass{};
+    EXPECT_EQ(1, elimination_pass.Run(graph));
+    EXPECT_EQ(size_t{6}, graph.nodes().size());
+    EXPECT_EQ(GraphOpKind::kInput, graph.nodes()[unused].kind);
+    EXPECT_EQ(0, elimination_pass.Run(graph));
+
+    Array x1 = (*testing::BuildArray({2}).WithData<float>({0.f, 1.f})).RequireGrad();
+    std::vector<Array> ys = graph.Execute({x1, Zeros({2}, Dtype::kFloat32)});
+    EXPECT_TRUE(ys[0].IsBackpropRequired());
+    EXPECT_FALSE(ys[1].IsBackpropRequired());
+    EXPECT_ARRAY_ALL_CLOSE(Sum(x1.AsGradStopped()), ys[1]);
+}
+
+TEST(GraphOptimizerTest, OptimizeGraph) {
+    testing::DeviceSession device_session{DeviceId{native::NativeBackend::kDefaultName, 0}};
+    Array c = testing::BuildArray({3}).WithLinearData<float>(1.f);
+
+    RecordedGraph graph{};
+    GraphNodeId x = graph.AddInput({2, 3}, Dtype::kFloat32);
+    GraphNodeId k = graph.Exp(graph.AddConstant(c));
+    GraphNodeId h1 = graph.Multiply(graph.Transpose(graph.Transpose(x)), k);
+    GraphNodeId h2 = graph.Multiply(x, k);
+    graph.AddOutput(graph.Sum(graph.Add(h1, h2)));
+    graph.AddOutput(graph.Sum(h2), false);
+
+    std::vector<GraphPassStats> stats = OptimizeGraph(graph);
+    ASSERT_EQ(size_t{5}, stats.size());
+    EXPECT_EQ("algebraic_simplification", stats[0].name);
+    EXPECT_EQ(2, stats[0].rewrite_count);
+    EXPECT_EQ("constant_folding", stats[1].name);
+    EXPECT_EQ(1, stats[1].rewrite_count);
+    EXPECT_EQ("common_subexpression_elimination", stats[2].name);
+    EXPECT_EQ(1, stats[2].rewrite_count);
+    EXPECT_EQ("backprop_pruning", stats[3].name);
+    EXPECT_EQ(1, stats[3].rewrite_count);
+    EXPECT_EQ("dead_node_elimination", stats[4].name);
+    EXPECT_EQ(size_t{10}, stats[4].node_count_before);
+    EXPECT_EQ(size_t{6}, stats[4].node_count_after);
+    for (const GraphPassStats& pass_stats : stats) {
+        EXPECT_LE(0, pass_stats.duration_ns);
+    }
+
+    // input, constant, multiply, add, sum and sum
+    EXPECT_EQ(size_t{1}, CountNodes(graph, GraphOpKind::kMultiply));
+    EXPECT_EQ(size_t{0}, CountNodes(graph, GraphOpKind::kExp));
+
+    Array x1 = (*testing::BuildArray({2, 3}).WithLinearData<float>(-1.f, 0.25f)).RequireGrad();
+    Array x2 = x1.AsGradStopped().RequireGrad();
+    std::vector<Array> ys = graph.Execute({x1});
+    Backward(ys[0]);
+
+    Array expected_y = Sum(x2 * Exp(c) * 2.f);
+    Backward(expected_y);
+    EXPECT_ARRAY_ALL_CLOSE(expected_y, ys[0]);
+    EXPECT_ARRAY_ALL_CLOSE(Sum(x2 * Exp(c)).AsGradStopped(), ys[1]);
+    EXPECT_ARRAY_ALL_CLOSE(*x2.GetGrad(), *x1.GetGrad());
+}
+
+TEST(GraphOptimizerTest, CustomPasses) {
+    GraphPassManager manager{};
+    manager.AddPass(std::make_unique<DeadNodeEliminationPass>());
+    EXPECT_EQ(size_t{1}, manager.pass_count());
+    EXPECT_EQ(size_t{5}, GraphPassManager::CreateDefault().pass_count());
+
+    RecordedGraph graph{};
+    GraphNodeId x = graph.AddInput({2}, Dtype::kFloat32);
+    graph.Exp(x);
+    graph.AddOutput(x);
+    std::vector<GraphPassStats> stats = manager.Run(graph);
+    ASSERT_EQ(size_t{1}, stats.size());
+    EXPECT_EQ(1, stats[0].rewrite_count);
+    EXPECT_EQ(size_t{2}, stats[0].node_count_before);
+    EXPECT_EQ(size_t{1}, stats[0].node_count_after);
+}
+
+}  // namespace
+}  // namespace chainerx
@@ -0,0 +1,333 @@
+#include "chainerx/graph_replay.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/axes.h"
+#include "chainerx/backprop_mode.h"
+#include "chainerx/backward_builder.h"
+#include "chainerx/backward_context.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/macro.h"
+#include "chainerx/recorded_graph.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/linalg.h"
+#include "chainerx/routines/manipulation.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+namespace {
+
+using graph_replay_detail::ReplayPlan;
+
+void AccumulateGrad(nonstd::optional<Array>& grad, Array value) {
+    if (grad.has_value()) {
+        grad = *grad + value;
+    } else {
+        grad = std::move(value);
+    }
+}
+
+// Sums up a gradient over the axes along which the input of the shape was broadcast.
+Array SumToShape(const Array& grad, const Shape& shape) {
+    if (grad.shape() == shape) {
+        return grad;
+    }
+    int8_t lead = grad.ndim() - shape.ndim();
+    Axes axis{};
+    for (int8_t i = 0; i < lead; ++i) {
+        axis.emplace_back(i);
+    }
+    for (int8_t i = 0; i < shape.ndim(); ++i) {
+        if (shape[i] == 1 && grad.shape()[i + lead] != 1) {
+            axis.emplace_back(i + lead);
+        }
+    }
+    return grad.Sum(axis, true).Reshape(shape);
+}
+
+// Computes the gradients of the inputs of the replayed graph from those of its outputs, in the reverse order of the recorded nodes.
+void BackwardReplay(const ReplayPlan& plan, const std::vector<nonstd::optional<Array>>& kept_values, BackwardContext& bctx) {
+    if (bctx.next_required()) {
+        throw NotImplementedError{"Double backprop of replayed graphs is not supported."};
+    }
+
+    const std::vector<GraphNode>& nodes = plan.graph.nodes();
+    std::vector<nonstd::optional<Array>> grads(nodes.size());
+    for (size_t i = 0; i < plan.grad_output_indices.size(); ++i) {
+        if (bctx.HasOutputGrad(i)) {
+            AccumulateGrad(grads[plan.graph.outputs()[plan.grad_output_indices[i]].node], *bctx.output_grad(i));
+        }
+    }
+
+    for (size_t id = nodes.size(); id-- > 0;) {
+        if (!plan.backpropped[id] || !grads[id].has_value()) {
+            continue;
+        }
+        const GraphNode& node = nodes[id];
+        Array gy = std::move(*grads[id]);
+        grads[id].reset();
+
+        auto is_backpropped = [&plan, &node](size_t k) { return static_cast<bool>(plan.backpropped[node.inputs[k]]); };
+        auto input_shape = [&nodes, &node](size_t k) -> const Shape& { return nodes[node.inputs[k]].shape; };
+        auto input_value = [&kept_values, &node](size_t k) -> const Array& {
+            CHAINERX_ASSERT(kept_values[node.inputs[k]].has_value());
+            return *kept_values[node.inputs[k]];
+        };
+        auto propagate = [&grads, &plan, &node, &input_shape](size_t k, const Array& gx) {
+            if (plan.backpropped[node.inputs[k]]) {
+                AccumulateGrad(grads[node.inputs[k]], SumToShape(gx, input_shape(k)));
+            }
+        };
+
+        switch (node.kind) {
+            case GraphOpKind::kInput:
+                if (bctx.is_input_grad_required(node.input_index)) {
+                    bctx.input_grad(node.input_index) = std::move(gy);
+                }
+                break;
+            case GraphOpKind::kConstant:
+                CHAINERX_NEVER_REACH();
+            case GraphOpKind::kNegative:
+                propagate(0, -gy);
+                break;
+            case GraphOpKind::kExp:
+                CHAINERX_ASSERT(kept_values[id].has_value());
+                propagate(0, gy * *kept_values[id]);
+                break;
+            case GraphOpKind::kLog:
+                propagate(0, gy / input_value(0));
+                break;
+            case GraphOpKind::kAdd:
+                propagate(0, gy);
+                propagate(1, gy);
+                break;
+            case GraphOpKind::kSubtract:
+                propagate(0, gy);
+                if (is_backpropped(1)) {
+                    propagate(1, -gy);
+                }
+                break;
+            case GraphOpKind::kMultiply:
+                if (is_backpropped(0)) {
+                    propagate(0, gy * input_value(1));
+                }
+                if (is_backpropped(1)) {
+                    propagate(1, gy * input_value(0));
+                }
+                break;
+            case GraphOpKind::kDivide: {
+                Array gx1 = gy / input_value(1);
+                if (is_backpropped(1)) {
+                    propagate(1, -(gx1 * input_value(0)) / input_value(1));
+                }
+                propagate(0, gx1);
+                break;
+            }
+            case GraphOpKind::kAddScalar:
+                propagate(0, gy);
+                break;
+            case GraphOpKind::kMultiplyScalar:
+                propagate(0, gy * node.scalar);
+                break;
+            case GraphOpKind::kDot: {
+                // Computed as a product of matrices of shapes (m, k) and (k, n) as in the forward.
+                int64_t k = input_shape(1)[0];
+                if (k == 0) {
+                    // Both inputs are empty.
+                    for (size_t i = 0; i < 2; ++i) {
+                        if (is_backpropped(i)) {
+                            propagate(i, Zeros(input_shape(i), gy.dtype(), gy.device()));
+                        }
+                    }
+                    break;
+                }
+                int64_t m = input_shape(0).GetTotalSize() / k;
+                int64_t n = input_shape(1).GetTotalSize() / k;
+                Array gy_matrix = gy.Reshape({m, n});
+                if (is_backpropped(0)) {
+                    propagate(0, Dot(gy_matrix, input_value(1).Reshape({k, n}).Transpose()).Reshape(input_shape(0)));
+                }
+                if (is_backpropped(1)) {
+                    propagate(1, Dot(input_value(0).Reshape({m, k}).Transpose(), gy_matrix).Reshape(input_shape(1)));
+                }
+                break;
+            }
+            case GraphOpKind::kSum: {
+                const Shape& shape = input_shape(0);
+                propagate(0, BroadcastTo(node.keepdims ? gy : gy.Reshape(internal::ReduceShape(shape, node.axes, true)), shape));
+                break;
+            }
+            case GraphOpKind::kTranspose: {
+                Axes inverse_axes{};
+                inverse_axes.resize(node.axes.ndim());
+                for (int8_t i = 0; i < node.axes.ndim(); ++i) {
+                    inverse_axes[node.axes[i]] = i;
+                }
+                propagate(0, gy.Transpose(inverse_axes));
+                break;
+            }
+            case GraphOpKind::kReshape:
+                propagate(0, gy.Reshape(input_shape(0)));
+                break;
+        }
+    }
+}
+
+}  // namespace
+
+GraphReplay::GraphReplay(RecordedGraph graph) {
+    auto plan = std::make_shared<ReplayPlan>();
+    plan->graph = std::move(graph);
+    const std::vector<GraphNode>& nodes = plan->graph.nodes();
+    const std::vector<GraphOutput>& outputs = plan->graph.outputs();
+
+    // Nodes which depend on an input.
+    std::vector<int8_t> depends_on_input(nodes.size());
+    for (size_t id = 0; id < nodes.size(); ++id) {
+        const GraphNode& node = nodes[id];
+        depends_on_input[id] = node.kind == GraphOpKind::kInput ||
+                               std::any_of(node.inputs.begin(), node.inputs.end(), [&depends_on_input](GraphNodeId input_id) {
+                                   return static_cast<bool>(depends_on_input[input_id]);
+                               });
+    }
+
+    // Nodes on which an output requiring gradients depends, through backpropped nodes.
+    std::vector<int8_t> required(nodes.size());
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        if (outputs[i].requires_grad && GetKind(nodes[outputs[i].node].dtype) == DtypeKind::kFloat) {
+            required[outputs[i].node] = 1;
+            plan->grad_output_indices.emplace_back(i);
+        }
+    }
+    plan->backpropped.resize(nodes.size());
+    for (size_t id = nodes.size(); id-- > 0;) {
+        if (required[id] && depends_on_input[id] && GetKind(nodes[id].dtype) == DtypeKind::kFloat) {
+            plan->backpropped[id] = 1;
+            for (GraphNodeId input_id : nodes[id].inputs) {
+                required[input_id] = 1;
+            }
+        }
+    }
+
+    // Values used to compute the gradients of the backpropped inputs of each node.
+    plan->kept.resize(nodes.size());
+    for (size_t id = 0; id < nodes.size(); ++id) {
+        const GraphNode& node = nodes[id];
+        if (!plan->backpropped[id]) {
+            continue;
+        }
+        switch (node.kind) {
+            case GraphOpKind::kExp:
+                plan->kept[id] = 1;
+                break;
+            case GraphOpKind::kLog:
+                plan->kept[node.inputs[0]] = 1;
+                break;
+            case GraphOpKind::kMultiply:
+            case GraphOpKind::kDot:
+                if (plan->backpropped[node.inputs[0]]) {
+                    plan->kept[node.inputs[1]] = 1;
+                }
+                if (plan->backpropped[node.inputs[1]]) {
+                    plan->kept[node.inputs[0]] = 1;
+                }
+                break;
+            case GraphOpKind::kDivide:
+                plan->kept[node.inputs[1]] = 1;
+                if (plan->backpropped[node.inputs[1]]) {
+                    plan->kept[node.inputs[0]] = 1;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    plan->use_counts = plan->graph.GetUseCounts();
+    plan_ = std::move(plan);
+}
+
+std::vector<Array> GraphReplay::Run(const std::vector<Array>& inputs) const {
+    const RecordedGraph& graph = plan_->graph;
+    graph.CheckInputs(inputs);
+    const std::vector<GraphNode>& nodes = graph.nodes();
+
+    // Values kept for the backward function. They are stopped from gradients so that the backward function refers to none of the graphs.
+    std::vector<nonstd::optional<Array>> kept_values(nodes.size());
+
+    std::vector<Array> outputs{};
+    {
+        NoBackpropModeScope scope{};
+
+        // Each value is released after its last use.
+        std::vector<size_t> use_counts = plan_->use_counts;
+        std::vector<nonstd::optional<Array>> values(nodes.size());
+        std::vector<Array> node_inputs{};
+        for (size_t id = 0; id < nodes.size(); ++id) {
+            const GraphNode& node = nodes[id];
+            if (node.kind == GraphOpKind::kInput) {
+                values[id] = inputs[node.input_index];
+            } else {
+                node_inputs.clear();
+                for (GraphNodeId input_id : node.inputs) {
+                    CHAINERX_ASSERT(values[input_id].has_value());
+                    node_inputs.emplace_back(*values[input_id]);
+                    if (--use_counts[input_id] == 0) {
+                        values[input_id].reset();
+                    }
+                }
+                values[id] = RecordedGraph::Evaluate(node, node_inputs);
+            }
+            if (plan_->kept[id]) {
+                kept_values[id] = values[id]->AsGradStopped();
+            }
+        }
+
+        // Each output needs its own array body, to which the op node connects. Constant values must not share their buffers across calls.
+        std::vector<int8_t> is_output(nodes.size());
+        outputs.reserve(graph.outputs().size());
+        for (const GraphOutput& output : graph.outputs()) {
+            CHAINERX_ASSERT(values[output.node].has_value());
+            const Array& value = *values[output.node];
+            GraphOpKind kind = nodes[output.node].kind;
+            if (kind == GraphOpKind::kConstant) {
+                outputs.emplace_back(value.Copy());
+            } else if (kind == GraphOpKind::kInput || is_output[output.node]) {
+                outputs.emplace_back(value.AsGradStopped());
+            } else {
+                outputs.emplace_back(value);
+            }
+            is_output[output.node] = 1;
+        }
+    }
+
+    if (inputs.empty() || plan_->grad_output_indices.empty()) {
+        return outputs;
+    }
+
+    std::vector<ConstArrayRef> op_outputs{};
+    op_outputs.reserve(plan_->grad_output_indices.size());
+    for (size_t i : plan_->grad_output_indices) {
+        op_outputs.emplace_back(outputs[i]);
+    }
+    BackwardBuilder bb{"graph_replay", std::vector<ConstArrayRef>{inputs.begin(), inputs.end()}, std::move(op_outputs)};
+    if (BackwardBuilder::Target bt = bb.CreateTarget()) {
+        bt.Define([plan = plan_, kept_values = std::move(kept_values)](BackwardContext& bctx) {
+            BackwardReplay(*plan, kept_values, bctx);
+        });
+    }
+    bb.Finalize();
+
+    return outputs;
+}
+
+}  // namespace chainerx
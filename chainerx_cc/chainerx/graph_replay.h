@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/recorded_graph.h"
+
+namespace chainerx {
+namespace graph_replay_detail {
+
+// Analysis of a recorded graph shared by the replays and their backward functions, which may outlive the GraphReplay.
+struct ReplayPlan {
+    RecordedGraph graph;
+
+    // Binary flags of the nodes whose gradients are computed, i.e. the float nodes which depend on an input and on which an output
+    // requiring gradients depends.
+    std::vector<int8_t> backpropped;
+
+    // Binary flags of the nodes whose values are kept for the backward function.
+    std::vector<int8_t> kept;
+
+    // Numbers of references to each node, used to release the values after their last uses in the forward pass.
+    std::vector<size_t> use_counts;
+
+    // Indices of the outputs which require gradients. They are the outputs of the op node.
+    std::vector<size_t> grad_output_indices;
+};
+
+}  // namespace graph_replay_detail
+
+// Replays a recorded graph as a single op.
+//
+// The recorded ops are run without building the computation graph. Instead, a single op node is added whose backward function computes
+// the gradients of all the inputs in the reverse order of the recorded nodes. Which nodes are backpropped and which values are kept for
+// backward is analyzed only once on construction, so that replaying a graph of fixed shapes skips the construction of an op node, array
+// nodes and a backward function per op.
+//
+// Only first-order gradients are supported. The backward function throws NotImplementedError if double backprop is enabled.
+class GraphReplay {
+public:
+    explicit GraphReplay(RecordedGraph graph);
+
+    // Runs the recorded ops on the inputs and returns the outputs, which are connected to the inputs by a single op node.
+    // Throws DimensionError or DtypeError if the inputs do not match the recorded ones.
+    std::vector<Array> Run(const std::vector<Array>& inputs) const;
+
+    const RecordedGraph& graph() const { return plan_->graph; }
+
+private:
+    std::shared_ptr<const graph_replay_detail::ReplayPlan> plan_;
+};
+
+}  // namespace chainerx
@@ -0,0 +1,178 @@
+#include "chainerx/graph_replay.h"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/array_node.h"
+#include "chainerx/backward.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/op_node.h"
+#include "chainerx/recorded_graph.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/linalg.h"
+#include "chainerx/routines/manipulation.h"
+#include "chainerx/routines/math.h"
+#include "chainerx/shape.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+TEST(GraphReplayTest, Run) {
+    testing::DeviceSession device_session{DeviceId{native::NativeBackend::kDefaultName, 0}};
+    Array c = testing::BuildArray({3}).WithLinearData<float>(1.f);
+
+    RecordedGraph graph{};
+    GraphNodeId x = graph.AddInput({2, 3}, Dtype::kFloat32);
+    GraphNodeId w = graph.AddInput({3, 4}, Dtype::kFloat32);
+    GraphNodeId h = graph.Add(graph.MultiplyScalar(graph.Exp(x), 2.f), graph.AddConstant(c));
+    GraphNodeId y = graph.Sum(graph.Reshape(graph.Transpose(graph.Dot(h, w)), {-1, 2}), Axes{0}, true);
+    graph.AddOutput(y);
+    GraphReplay replay{graph};
+
+    // The same replay runs on different inputs.
+    for (float start : {-1.f, 0.5f}) {
+        Array x1 = (*testing::BuildArray({2, 3}).WithLinearData<float>(start, 0.25f)).RequireGrad();
+        Array w1 = (*testing::BuildArray({3, 4}).WithLinearData<float>(0.5f, -0.125f)).RequireGrad();
+        Array x2 = x1.AsGradStopped().RequireGrad();
+        Array w2 = w1.AsGradStopped().RequireGrad();
+
+        std::vector<Array> ys = replay.Run({x1, w1});
+        ASSERT_EQ(size_t{1}, ys.size());
+
+        // The outputs are connected to the inputs by a single op node.
+        std::shared_ptr<const internal::OpNode> op_node = internal::GetArrayBody(ys[0])->nodes()[0]->creator_op_node();
+        EXPECT_EQ("graph_replay", op_node->name());
+        EXPECT_EQ(size_t{2}, op_node->input_array_node_count());
+        Backward(ys[0]);
+
+        Array expected_y = Sum(Reshape(Transpose(Dot(Exp(x2) * 2.f + c, w2)), {4, 2}), Axes{0}, true);
+        Backward(expected_y);
+
+        EXPECT_ARRAY_ALL_CLOSE(expected_y, ys[0]);
+        EXPECT_ARRAY_ALL_CLOSE(*x2.GetGrad(), *x1.GetGrad());
+        EXPECT_ARRAY_ALL_CLOSE(*w2.GetGrad(), *w1.GetGrad());
+    }
+}
+
+TEST(GraphReplayTest, Gradients) {
+    testing::DeviceSession device_session{DeviceId{native::NativeBackend::kDefaultName, 0}};
+
+    RecordedGraph graph{};
+    GraphNodeId x = graph.AddInput({2, 3}, Dtype::kFloat32);
+    GraphNodeId b = graph.AddInput({3}, Dtype::kFloat32);
+    GraphNodeId v = graph.AddInput({3}, Dtype::kFloat32);
+    GraphNodeId h1 = graph.Divide(graph.Log(graph.Add(x, b)), graph.Multiply(x, x));
+    GraphNodeId h2 = graph.Subtract(graph.Negative(h1), b);
+    graph.AddOutput(graph.Sum(graph.Dot(h2, v)));
+    graph.AddOutput(graph.AddScalar(h1, 1.f));
+    GraphReplay replay{graph};
+
+    Array x1 = (*testing::BuildArray({2, 3}).WithLinearData<float>(0.5f, 0.25f)).RequireGrad();
+    Array b1 = (*testing::BuildArray({3}).WithLinearData<float>(1.f, 0.5f)).RequireGrad();
+    Array v1 = (*testing::BuildArray({3}).WithLinearData<float>(-1.f, 0.75f)).RequireGrad();
+    Array x2 = x1.AsGradStopped().RequireGrad();
+    Array b2 = b1.AsGradStopped().RequireGrad();
+    Array v2 = v1.AsGradStopped().RequireGrad();
+
+    std::vector<Array> ys = replay.Run({x1, b1, v1});
+    ASSERT_EQ(size_t{2}, ys.size());
+    Backward({ys[0], ys[1]});
+
+    Array expected_h1 = Log(x2 + b2) / (x2 * x2);
+    std::vector<Array> expected_ys{Sum(Dot(-expected_h1 - b2, v2)), expected_h1 + 1.f};
+    Backward({expected_ys[0], expected_ys[1]});
+
+    EXPECT_ARRAY_ALL_CLOSE(expected_ys[0], ys[0]);
+    EXPECT_ARRAY_ALL_CLOSE(expected_ys[1], ys[1]);
+    EXPECT_ARRAY_ALL_CLOSE(*x2.GetGrad(), *x1.GetGrad());
+    EXPECT_ARRAY_ALL_CLOSE(*b2.GetGrad(), *b1.GetGrad());
+    EXPECT_ARRAY_ALL_CLOSE(*v2.GetGrad(), *v1.GetGrad());
+}
+
+TEST(GraphReplayTest, Outputs) {
+    testing::DeviceSession device_session{DeviceId{native::NativeBackend::kDefaultName, 0}};
+    Array c = testing::BuildArray({3}).WithLinearData<float>(1.f);
+
+    RecordedGraph graph{};
+    GraphNodeId x = graph.AddInput({3}, Dtype::kFloat32);
+    GraphNodeId y = graph.MultiplyScalar(x, 3.f);
+    graph.AddOutput(x);
+    graph.AddOutput(y);
+    graph.AddOutput(y);
+    graph.AddOutput(y, false);
+    graph.AddOutput(graph.AddConstant(c));
+    GraphReplay replay{graph};
+
+    Array x1 = (*testing::BuildArray({3}).WithLinearData<float>()).RequireGrad();
+    std::vector<Array> ys = replay.Run({x1});
+    ASSERT_EQ(size_t{5}, ys.size());
+
+    // Each output has its own array body.
+    for (size_t i = 0; i < ys.size(); ++i) {
+        for (size_t j = 0; j < i; ++j) {
+            EXPECT_NE(internal::GetArrayBody(ys[i]), internal::GetArrayBody(ys[j]));
+        }
+    }
+    EXPECT_ARRAY_EQ(x1, ys[0]);
+    EXPECT_ARRAY_EQ(c, ys[4]);
+    EXPECT_NE(c.data(), ys[4].data());
+    EXPECT_FALSE(ys[3].IsBackpropRequired());
+
+    Backward({ys[0], ys[1], ys[2], ys[4]});
+    EXPECT_ARRAY_EQ(Full({3}, 7.f), *x1.GetGrad());
+}
+
+TEST(GraphReplayTest, OutliveReplay) {
+    testing::DeviceSession device_session{DeviceId{native::NativeBackend::kDefaultName, 0}};
+
+    Array x1 = (*testing::BuildArray({2, 3}).WithLinearData<float>(0.5f, 0.25f)).RequireGrad();
+    Array y{};
+    {
+        RecordedGraph graph{};
+        GraphNodeId x = graph.AddInput({2, 3}, Dtype::kFloat32);
+        graph.AddOutput(graph.Multiply(graph.Exp(x), x));
+        y = GraphReplay{graph}.Run({x1})[0];
+    }
+    Backward(y);
+
+    Array x2 = x1.AsGradStopped();
+    EXPECT_ARRAY_ALL_CLOSE(Exp(x2) * (x2 + 1.f), *x1.GetGrad());
+}
+
+TEST(GraphReplayTest, InvalidInputs) {
+    testing::DeviceSession device_session{DeviceId{native::NativeBackend::kDefaultName, 0}};
+    RecordedGraph graph{};
+    GraphNodeId x = graph.AddInput({2, 3}, Dtype::kFloat32);
+    graph.AddOutput(graph.Exp(x));
+    GraphReplay replay{graph};
+
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>();
+    EXPECT_THROW(replay.Run({}), DimensionError);
+    EXPECT_THROW(replay.Run({Reshape(a, {3, 2})}), DimensionError);
+    EXPECT_THROW(replay.Run({a.AsType(Dtype::kFloat64)}), DtypeError);
+}
+
+TEST(GraphReplayTest, DoubleBackprop) {
+    testing::DeviceSession device_session{DeviceId{native::NativeBackend::kDefaultName, 0}};
+    RecordedGraph graph{};
+    GraphNodeId x = graph.AddInput({2, 3}, Dtype::kFloat32);
+    graph.AddOutput(graph.Exp(x));
+    GraphReplay replay{graph};
+
+    Array x1 = (*testing::BuildArray({2, 3}).WithLinearData<float>()).RequireGrad();
+    Array y = replay.Run({x1})[0];
+    EXPECT_THROW(Backward(y, nonstd::nullopt, DoubleBackpropOption::kEnable), NotImplementedError);
+}
+
+}  // namespace
+}  // namespace chainerx
@@ -12,6 +12,7 @@
 #include "chainerx/indexable_array.h"
 #include "chainerx/indexer.h"
 #include "chainerx/macro.h"
+#include "chainerx/native/native_device.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/scalar.h"
 #include "chainerx/shape.h"
@@ -88,32 +89,34 @@ Array Col2Im(
     CHAINERX_ASSERT(ndim + 2 == padded_out.ndim());
 
     // Write to the output array
-    VisitDtype(col.dtype(), [&](auto pt) {
-        using T = typename decltype(pt)::type;
-        Indexer<2> batch_channel_indexer{Shape{batch_size, channels}};
-
-        static_assert(4 * 2 + 2 == kMaxNdim, "4 is the maximum kernel ndim whose col ndim does not exceed kMaxNdim");
-        switch (ndim) {
-            case 0:
-                Col2ImImpl<T, 0>(col, padded_out, stride, batch_channel_indexer);
-                break;
-            case 1:
-                Col2ImImpl<T, 1>(col, padded_out, stride, batch_channel_indexer);
-                break;
-            case 2:
-                Col2ImImpl<T, 2>(col, padded_out, stride, batch_channel_indexer);
-                break;
-            case 3:
-                Col2ImImpl<T, 3>(col, padded_out, stride, batch_channel_indexer);
-                break;
-            case 4:
-                Col2ImImpl<T, 4>(col, padded_out, stride, batch_channel_indexer);
-                break;
-            default:
-                CHAINERX_NEVER_REACH();  // Never col.ndim() > kMaxNdim
-                break;
-        }
-    });
+    static_cast<NativeDevice&>(col.device()).Launch([=](const Array& col, const Array& padded_out) {
+        VisitDtype(col.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            Indexer<2> batch_channel_indexer{Shape{batch_size, channels}};
+
+            static_assert(4 * 2 + 2 == kMaxNdim, "4 is the maximum kernel ndim whose col ndim does not exceed kMaxNdim");
+            switch (ndim) {
+                case 0:
+                    Col2ImImpl<T, 0>(col, padded_out, stride, batch_channel_indexer);
+                    break;
+                case 1:
+                    Col2ImImpl<T, 1>(col, padded_out, stride, batch_channel_indexer);
+                    break;
+                case 2:
+                    Col2ImImpl<T, 2>(col, padded_out, stride, batch_channel_indexer);
+                    break;
+                case 3:
+                    Col2ImImpl<T, 3>(col, padded_out, stride, batch_channel_indexer);
+                    break;
+                case 4:
+                    Col2ImImpl<T, 4>(col, padded_out, stride, batch_channel_indexer);
+                    break;
+                default:
+                    CHAINERX_NEVER_REACH();  // Never col.ndim() > kMaxNdim
+                    break;
+            }
+        });
+    }, col, padded_out);
 
     std::vector<ArrayIndex> slice{ArrayIndex{Slice{}}, ArrayIndex{Slice{}}};  // All batch and channel dimensions.
     for (int8_t i = 0; i < ndim; ++i) {
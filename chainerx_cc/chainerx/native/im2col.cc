@@ -11,6 +11,7 @@
 #include "chainerx/indexable_array.h"
 #include "chainerx/indexer.h"
 #include "chainerx/macro.h"
+#include "chainerx/native/native_device.h"
 #include "chainerx/routines/connection.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/scalar.h"
@@ -122,32 +123,34 @@ Array Im2Col(
     CHAINERX_ASSERT(ndim * 2 + 2 == out.ndim());
 
     // Write to the output array.
-    VisitDtype(x.dtype(), [&](auto pt) {
-        using T = typename decltype(pt)::type;
-        Indexer<2> batch_channel_indexer{Shape{batch_size, channels}};
-
-        static_assert(4 * 2 + 2 == kMaxNdim, "4 is the maximum kernel ndim whose output ndim does not exceed kMaxNdim");
-        switch (ndim) {
-            case 0:
-                Im2ColImpl<T, 0>(padded_x, out, kernel_size, stride, out_dims, batch_channel_indexer);
-                break;
-            case 1:
-                Im2ColImpl<T, 1>(padded_x, out, kernel_size, stride, out_dims, batch_channel_indexer);
-                break;
-            case 2:
-                Im2ColImpl<T, 2>(padded_x, out, kernel_size, stride, out_dims, batch_channel_indexer);
-                break;
-            case 3:
-                Im2ColImpl<T, 3>(padded_x, out, kernel_size, stride, out_dims, batch_channel_indexer);
-                break;
-            case 4:
-                Im2ColImpl<T, 4>(padded_x, out, kernel_size, stride, out_dims, batch_channel_indexer);
-                break;
-            default:
-                CHAINERX_NEVER_REACH();  // Never out.ndim() > kMaxNdim
-                break;
-        }
-    });
+    static_cast<NativeDevice&>(device).Launch([=](const Array& padded_x, const Array& out) {
+        VisitDtype(padded_x.dtype(), [&](auto pt) {
+            using T = typename decltype(pt)::type;
+            Indexer<2> batch_channel_indexer{Shape{batch_size, channels}};
+
+            static_assert(4 * 2 + 2 == kMaxNdim, "4 is the maximum kernel ndim whose output ndim does not exceed kMaxNdim");
+            switch (ndim) {
+                case 0:
+                    Im2ColImpl<T, 0>(padded_x, out, kernel_size, stride, out_dims, batch_channel_indexer);
+                    break;
+                case 1:
+                    Im2ColImpl<T, 1>(padded_x, out, kernel_size, stride, out_dims, batch_channel_indexer);
+                    break;
+                case 2:
+                    Im2ColImpl<T, 2>(padded_x, out, kernel_size, stride, out_dims, batch_channel_indexer);
+                    break;
+                case 3:
+                    Im2ColImpl<T, 3>(padded_x, out, kernel_size, stride, out_dims, batch_channel_indexer);
+                    break;
+                case 4:
+                    Im2ColImpl<T, 4>(padded_x, out, kernel_size, stride, out_dims, batch_channel_indexer);
+                    break;
+                default:
+                    CHAINERX_NEVER_REACH();  // Never out.ndim() > kMaxNdim
+                    break;
+            }
+        });
+    }, padded_x, out);
 
     return out;
 }
@@ -28,6 +28,8 @@ void ExpectDataEqual(const std::shared_ptr<void>& expected, const std::shared_pt
 void ExpectArraysEqual(const Array& expected, const Array& actual) {
     EXPECT_EQ(expected.dtype(), actual.dtype());
     EXPECT_EQ(expected.shape(), actual.shape());
+    expected.device().Synchronize();
+    actual.device().Synchronize();
     VisitDtype(expected.dtype(), [&expected, &actual](auto pt) {
         using T = typename decltype(pt)::type;
         int64_t total_size = expected.GetTotalSize();
@@ -1,9 +1,83 @@
 #include "chainerx/native/native_device.h"
 
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+#include "chainerx/array.h"
+#include "chainerx/macro.h"
+#include "chainerx/native/native_stream.h"
+
 namespace chainerx {
 namespace native {
+namespace {
+
+bool IsAsyncEnabledByEnv() {
+    const char* value = std::getenv("CHAINERX_NATIVE_ASYNC");
+    return value != nullptr && std::strcmp(value, "1") == 0;
+}
+
+}  // namespace
+
+NativeDevice::NativeDevice(NativeBackend& backend, int index) : Device(backend, index) {
+    if (IsAsyncEnabledByEnv()) {
+        SetAsync(true);
+    }
+}
+
+void NativeDevice::Synchronize() {
+    NativeStream* stream{};
+    {
+        // The stream is never destroyed once created.
+        std::lock_guard<std::mutex> lock{stream_mutex_};
+        stream = stream_.get();
+    }
+    if (stream != nullptr && !stream->IsWorkerThread()) {
+        stream->Synchronize();
+    }
+}
+
+void NativeDevice::SetAsync(bool async) {
+    {
+        std::lock_guard<std::mutex> lock{stream_mutex_};
+        if (async && stream_ == nullptr) {
+            stream_ = std::make_unique<NativeStream>();
+        }
+        async_.store(async, std::memory_order_release);
+    }
+    if (!async) {
+        Synchronize();
+    }
+}
+
+long NativeDevice::GetDataUseCount(const std::shared_ptr<void>& data) const {
+    std::lock_guard<std::mutex> lock{pending_data_mutex_};
+    auto it = pending_data_use_counts_.find(data);
+    return data.use_count() - (it == pending_data_use_counts_.end() ? 0 : it->second);
+}
+
+Array NativeDevice::DetachFromGraph(const Array& array) {
+    std::shared_ptr<void> data{};
+    {
+        std::lock_guard<std::mutex> lock{pending_data_mutex_};
+        data = array.data();
+        ++pending_data_use_counts_[data];
+    }
+    void* ptr = data.get();
+    std::shared_ptr<void> pending_data{ptr, [this, data = std::move(data)](void* /*ptr*/) mutable { ReleasePendingData(std::move(data)); }};
+    return internal::MakeArray(array.shape(), array.strides(), array.dtype(), array.device(), std::move(pending_data), array.offset());
+}
 
-void NativeDevice::Synchronize() {}
+void NativeDevice::ReleasePendingData(std::shared_ptr<void> data) {
+    std::lock_guard<std::mutex> lock{pending_data_mutex_};
+    auto it = pending_data_use_counts_.find(data);
+    CHAINERX_ASSERT(it != pending_data_use_counts_.end());
+    if (--it->second == 0) {
+        pending_data_use_counts_.erase(it);
+    }
+    data.reset();
+}
 
 }  // namespace native
 }  // namespace chainerx
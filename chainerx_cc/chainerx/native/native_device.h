@@ -1,8 +1,12 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <tuple>
+#include <utility>
 
 #include <nonstd/optional.hpp>
 
@@ -12,6 +16,8 @@
 #include "chainerx/indexable_array.h"
 #include "chainerx/indexer.h"
 #include "chainerx/native/native_backend.h"
+#include "chainerx/native/native_stream.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/pooling.h"
 #include "chainerx/scalar.h"
 #include "chainerx/stack_vector.h"
@@ -21,8 +27,33 @@ namespace native {
 
 class NativeDevice : public Device {
 public:
+    // Waits for all the kernels enqueued in the asynchronous mode and rethrows the first error raised by them, if any.
     void Synchronize() override;
 
+    // In the asynchronous mode, kernels are executed in order by a worker thread of the device instead of the calling thread.
+    // Host reads (Array::ToNative()), memory copies and transfers synchronize the device.
+    // The asynchronous mode is enabled by default if the environment variable CHAINERX_NATIVE_ASYNC is set to 1.
+    // Disabling it synchronizes the device.
+    void SetAsync(bool async);
+
+    bool is_async() const { return async_.load(std::memory_order_acquire); }
+
+    // Runs kernel(args...) in the worker thread if the device is asynchronous, or in the calling thread otherwise.
+    // The arguments are copied so that the arrays outlive the kernel. Arrays must be passed as arguments rather than captured by the
+    // kernel, so that they are detached from the graphs.
+    template <typename Kernel, typename... Args>
+    void Launch(Kernel&& kernel, const Args&... args) {
+        if (ShouldEnqueue()) {
+            stream_->Enqueue([kernel = std::forward<Kernel>(kernel), args = std::make_tuple(DetachFromGraph(args)...)]() {
+                CallWithTuple(kernel, args, std::index_sequence_for<Args...>{});
+            });
+        } else {
+            kernel(args...);
+        }
+    }
+
+    long GetDataUseCount(const std::shared_ptr<void>& data) const override;
+
     // memory.cc
 
     std::shared_ptr<void> Allocate(size_t bytesize) override;
@@ -161,10 +192,67 @@ public:
             AveragePoolPadMode pad_mode) override;
 
 protected:
-    NativeDevice(NativeBackend& backend, int index) : Device(backend, index) {}
+    NativeDevice(NativeBackend& backend, int index);
 
 private:
     friend NativeDevice* native_internal::CreateDevice(NativeBackend&, int);
+
+    bool ShouldEnqueue() const { return is_async() && !stream_->IsWorkerThread(); }
+
+    // Enqueues a call to the given kernel member function if the device is asynchronous and returns true. The enqueued kernel is run
+    // within a "kernel" range of the profiler active at this call, which is recorded in the worker thread.
+    // Otherwise returns false, and opens the "kernel" range in the given optional to be kept until the end of the kernel, unless called
+    // from a worker thread, i.e. by an enqueued kernel or by a kernel called from it, which are covered by the range of the former.
+    template <typename... Params, typename... Args>
+    bool EnqueueIfAsync(
+            nonstd::optional<ProfileRange>& profile_range, const char* name, void (NativeDevice::*kernel)(Params...), const Args&... args) {
+        if (ShouldEnqueue()) {
+            stream_->Enqueue(
+                    [this, name, kernel, profiler = internal::AcquireActiveProfiler(), args = std::make_tuple(DetachFromGraph(args)...)]() {
+                        ProfileRange kernel_range{profiler, "kernel", name};
+                        CallWithTuple(kernel, args, std::index_sequence_for<Args...>{});
+                    });
+            return true;
+        }
+        if (!NativeStream::IsAnyWorkerThread()) {
+            profile_range.emplace("kernel", name);
+        }
+        return false;
+    }
+
+    template <typename... Params, typename Tuple, size_t... Is>
+    void CallWithTuple(void (NativeDevice::*kernel)(Params...), const Tuple& args, std::index_sequence<Is...> /*indices*/) {
+        (this->*kernel)(std::get<Is>(args)...);
+    }
+
+    template <typename Kernel, typename Tuple, size_t... Is>
+    static void CallWithTuple(const Kernel& kernel, const Tuple& args, std::index_sequence<Is...> /*indices*/) {
+        kernel(std::get<Is>(args)...);
+    }
+
+    // Arrays are passed to the worker thread as new array bodies sharing the data, so that the worker thread never reads the array nodes
+    // while the calling thread connects them to graphs.
+    // The references to the data held by the new array bodies are counted as pending until released, so that GetDataUseCount() can
+    // exclude them.
+    Array DetachFromGraph(const Array& array);
+
+    template <typename T>
+    static const T& DetachFromGraph(const T& value) {
+        return value;
+    }
+
+    // Releases a reference to the data held by an array body made by DetachFromGraph().
+    void ReleasePendingData(std::shared_ptr<void> data);
+
+    // Numbers of references held by the array bodies made by DetachFromGraph(), keyed by the owners of the data as the use counts are.
+    // A reference to the data and its count are always updated together under the mutex.
+    // They are declared before the stream so that they outlive the tasks.
+    mutable std::mutex pending_data_mutex_;
+    std::map<std::weak_ptr<void>, long, std::owner_less<std::weak_ptr<void>>> pending_data_use_counts_;
+
+    std::mutex stream_mutex_;
+    std::unique_ptr<NativeStream> stream_;
+    std::atomic<bool> async_{false};
 };
 
 }  // namespace native
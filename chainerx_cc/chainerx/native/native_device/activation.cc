@@ -3,10 +3,13 @@
 #include <cmath>
 #include <cstdint>
 
+#include <nonstd/optional.hpp>
+
 #include "chainerx/array.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/native/elementwise.h"
+#include "chainerx/profiler.h"
 #include "chainerx/scalar.h"
 
 namespace chainerx {
@@ -14,6 +17,10 @@ namespace native {
 
 void NativeDevice::IfLessElseASSA(const Array& x1, Scalar x2, Scalar pos, const Array& neg, const Array& out) {
     CheckDevicesCompatible(x1, neg, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "IfLessElseASSA", &NativeDevice::IfLessElseASSA, x1, x2, pos, neg, out)) {
+        return;
+    }
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -27,6 +34,10 @@ void NativeDevice::IfLessElseASSA(const Array& x1, Scalar x2, Scalar pos, const
 
 void NativeDevice::Tanh(const Array& x, const Array& out) {
     CheckDevicesCompatible(x, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Tanh", &NativeDevice::Tanh, x, out)) {
+        return;
+    }
     VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -2,11 +2,14 @@
 
 #include <cstdint>
 
+#include <nonstd/optional.hpp>
+
 #include "chainerx/arithmetic_ops.h"
 #include "chainerx/array.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/native/elementwise.h"
+#include "chainerx/profiler.h"
 #include "chainerx/scalar.h"
 
 namespace chainerx {
@@ -14,6 +17,10 @@ namespace native {
 
 void NativeDevice::Add(const Array& x1, const Array& x2, const Array& out) {
     CheckDevicesCompatible(x1, x2, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Add", &NativeDevice::Add, x1, x2, out)) {
+        return;
+    }
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -25,6 +32,10 @@ void NativeDevice::Add(const Array& x1, const Array& x2, const Array& out) {
 
 void NativeDevice::AddAS(const Array& x1, Scalar x2, const Array& out) {
     CheckDevicesCompatible(x1, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "AddAS", &NativeDevice::AddAS, x1, x2, out)) {
+        return;
+    }
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -37,6 +48,10 @@ void NativeDevice::AddAS(const Array& x1, Scalar x2, const Array& out) {
 
 void NativeDevice::Subtract(const Array& x1, const Array& x2, const Array& out) {
     CheckDevicesCompatible(x1, x2, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Subtract", &NativeDevice::Subtract, x1, x2, out)) {
+        return;
+    }
     VisitNumericDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -48,6 +63,10 @@ void NativeDevice::Subtract(const Array& x1, const Array& x2, const Array& out)
 
 void NativeDevice::SubtractAS(const Array& x1, Scalar x2, const Array& out) {
     CheckDevicesCompatible(x1, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "SubtractAS", &NativeDevice::SubtractAS, x1, x2, out)) {
+        return;
+    }
     VisitNumericDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -60,6 +79,10 @@ void NativeDevice::SubtractAS(const Array& x1, Scalar x2, const Array& out) {
 
 void NativeDevice::Multiply(const Array& x1, const Array& x2, const Array& out) {
     CheckDevicesCompatible(x1, x2, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Multiply", &NativeDevice::Multiply, x1, x2, out)) {
+        return;
+    }
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -71,6 +94,10 @@ void NativeDevice::Multiply(const Array& x1, const Array& x2, const Array& out)
 
 void NativeDevice::MultiplyAS(const Array& x1, Scalar x2, const Array& out) {
     CheckDevicesCompatible(x1, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "MultiplyAS", &NativeDevice::MultiplyAS, x1, x2, out)) {
+        return;
+    }
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -83,6 +110,10 @@ void NativeDevice::MultiplyAS(const Array& x1, Scalar x2, const Array& out) {
 
 void NativeDevice::Divide(const Array& x1, const Array& x2, const Array& out) {
     CheckDevicesCompatible(x1, x2, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Divide", &NativeDevice::Divide, x1, x2, out)) {
+        return;
+    }
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -94,6 +125,10 @@ void NativeDevice::Divide(const Array& x1, const Array& x2, const Array& out) {
 
 void NativeDevice::DivideAS(const Array& x1, Scalar x2, const Array& out) {
     CheckDevicesCompatible(x1, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "DivideAS", &NativeDevice::DivideAS, x1, x2, out)) {
+        return;
+    }
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -2,16 +2,23 @@
 
 #include <cstdint>
 
+#include <nonstd/optional.hpp>
+
 #include "chainerx/array.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/native/elementwise.h"
+#include "chainerx/profiler.h"
 
 namespace chainerx {
 namespace native {
 
 void NativeDevice::Equal(const Array& x1, const Array& x2, const Array& out) {
     CheckDevicesCompatible(x1, x2, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Equal", &NativeDevice::Equal, x1, x2, out)) {
+        return;
+    }
     VisitDtype(x1.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -23,6 +30,10 @@ void NativeDevice::Equal(const Array& x1, const Array& x2, const Array& out) {
 
 void NativeDevice::NotEqual(const Array& x1, const Array& x2, const Array& out) {
     CheckDevicesCompatible(x1, x2, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "NotEqual", &NativeDevice::NotEqual, x1, x2, out)) {
+        return;
+    }
     VisitDtype(x1.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -34,6 +45,10 @@ void NativeDevice::NotEqual(const Array& x1, const Array& x2, const Array& out)
 
 void NativeDevice::Greater(const Array& x1, const Array& x2, const Array& out) {
     CheckDevicesCompatible(x1, x2, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Greater", &NativeDevice::Greater, x1, x2, out)) {
+        return;
+    }
     VisitDtype(x1.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -45,6 +60,10 @@ void NativeDevice::Greater(const Array& x1, const Array& x2, const Array& out) {
 
 void NativeDevice::GreaterEqual(const Array& x1, const Array& x2, const Array& out) {
     CheckDevicesCompatible(x1, x2, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "GreaterEqual", &NativeDevice::GreaterEqual, x1, x2, out)) {
+        return;
+    }
     VisitDtype(x1.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -56,6 +75,10 @@ void NativeDevice::GreaterEqual(const Array& x1, const Array& x2, const Array& o
 
 void NativeDevice::LogicalNot(const Array& x, const Array& out) {
     CheckDevicesCompatible(x, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "LogicalNot", &NativeDevice::LogicalNot, x, out)) {
+        return;
+    }
     VisitDtype(x.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -19,6 +19,7 @@
 #include "chainerx/native/col2im.h"
 #include "chainerx/native/im2col.h"
 #include "chainerx/native/tensor_dot.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/connection.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/manipulation.h"
@@ -35,6 +36,7 @@ Array NativeDevice::Conv(
         const StackVector<int64_t, kMaxNdim>& stride,
         const StackVector<int64_t, kMaxNdim>& pad,
         bool cover_all) {
+    ProfileRange profile_range{"kernel", "Conv"};
     int8_t ndim = w.ndim() - 2;  // Number of spatial dimensions
 
     // Compute the kernel size from the weight array.
@@ -74,6 +76,7 @@ Array NativeDevice::ConvGradWeight(
         const StackVector<int64_t, kMaxNdim>& stride,
         const StackVector<int64_t, kMaxNdim>& pad,
         bool cover_all) {
+    ProfileRange profile_range{"kernel", "ConvGradWeight"};
     CHAINERX_ASSERT(x.ndim() == w_shape.ndim());
     int8_t ndim = x.ndim() - 2;  // Number of spatial dimensions
 
@@ -100,6 +103,7 @@ Array NativeDevice::ConvTranspose(
         const StackVector<int64_t, kMaxNdim>& stride,
         const StackVector<int64_t, kMaxNdim>& pad,
         const StackVector<int64_t, kMaxNdim>& out_size) {
+    ProfileRange profile_range{"kernel", "ConvTranspose"};
     Array col = TensorDot(w, x, {0}, {1});  // shape: out_channel, k_1, ..., k_n, batch_size, out_1, ..., out_n
     col = RollAxis(col, x.ndim() - 1);  // batch axis is rolled to the top
 
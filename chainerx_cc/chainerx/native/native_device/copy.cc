@@ -2,16 +2,23 @@
 
 #include <cstdint>
 
+#include <nonstd/optional.hpp>
+
 #include "chainerx/array.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/native/elementwise.h"
+#include "chainerx/profiler.h"
 
 namespace chainerx {
 namespace native {
 
 void NativeDevice::Copy(const Array& a, const Array& out) {
     CheckDevicesCompatible(a, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Copy", &NativeDevice::Copy, a, out)) {
+        return;
+    }
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -23,6 +30,10 @@ void NativeDevice::Copy(const Array& a, const Array& out) {
 
 void NativeDevice::AsType(const Array& a, const Array& out) {
     CheckDevicesCompatible(a, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "AsType", &NativeDevice::AsType, a, out)) {
+        return;
+    }
     auto do_astype = [&](auto in_pt, auto out_pt) {
         using InT = typename decltype(in_pt)::type;
         using OutT = typename decltype(out_pt)::type;
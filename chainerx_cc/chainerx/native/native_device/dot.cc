@@ -6,12 +6,15 @@
 #include <cblas.h>
 #endif  // CHAINERX_ENABLE_BLAS
 
+#include <nonstd/optional.hpp>
+
 #include "chainerx/array.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/indexable_array.h"
 #include "chainerx/macro.h"
 #include "chainerx/native/elementwise.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/shape.h"
 
@@ -124,6 +127,10 @@ void NativeDevice::Dot(const Array& a, const Array& b, const Array& out) {
     if (a.ndim() != 2 || b.ndim() != 2 || out.ndim() != 2) {
         throw DimensionError{"ChainerX dot supports only 2-dimensional arrays."};
     }
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Dot", &NativeDevice::Dot, a, b, out)) {
+        return;
+    }
 
 #ifdef CHAINERX_ENABLE_BLAS
     if (out.dtype() == Dtype::kFloat32 || out.dtype() == Dtype::kFloat64) {
@@ -2,16 +2,23 @@
 
 #include <cstdint>
 
+#include <nonstd/optional.hpp>
+
 #include "chainerx/array.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/native/elementwise.h"
+#include "chainerx/profiler.h"
 
 namespace chainerx {
 namespace native {
 
 void NativeDevice::Exp(const Array& x, const Array& out) {
     CheckDevicesCompatible(x, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Exp", &NativeDevice::Exp, x, out)) {
+        return;
+    }
     VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -23,6 +30,10 @@ void NativeDevice::Exp(const Array& x, const Array& out) {
 
 void NativeDevice::Log(const Array& x, const Array& out) {
     CheckDevicesCompatible(x, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Log", &NativeDevice::Log, x, out)) {
+        return;
+    }
     VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
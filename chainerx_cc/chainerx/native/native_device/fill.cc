@@ -2,6 +2,8 @@
 
 #include <cstdint>
 
+#include <nonstd/optional.hpp>
+
 #include "chainerx/array.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
@@ -9,6 +11,7 @@
 #include "chainerx/indexer.h"
 #include "chainerx/macro.h"
 #include "chainerx/native/elementwise.h"
+#include "chainerx/profiler.h"
 #include "chainerx/scalar.h"
 #include "chainerx/shape.h"
 
@@ -16,6 +19,10 @@ namespace chainerx {
 namespace native {
 
 void NativeDevice::Fill(const Array& out, Scalar value) {
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Fill", &NativeDevice::Fill, out, value)) {
+        return;
+    }
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -27,6 +34,10 @@ void NativeDevice::Fill(const Array& out, Scalar value) {
 }
 
 void NativeDevice::Arange(Scalar start, Scalar step, const Array& out) {
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Arange", &NativeDevice::Arange, start, step, out)) {
+        return;
+    }
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -41,6 +52,10 @@ void NativeDevice::Arange(Scalar start, Scalar step, const Array& out) {
 void NativeDevice::Identity(const Array& out) {
     CHAINERX_ASSERT(out.ndim() == 2);
     CHAINERX_ASSERT(out.shape()[0] == out.shape()[1]);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Identity", &NativeDevice::Identity, out)) {
+        return;
+    }
 
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -54,6 +69,10 @@ void NativeDevice::Identity(const Array& out) {
 }
 
 void NativeDevice::Eye(int64_t k, const Array& out) {
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Eye", &NativeDevice::Eye, k, out)) {
+        return;
+    }
     VisitDtype(out.dtype(), [k, &out](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -70,6 +89,10 @@ void NativeDevice::Eye(int64_t k, const Array& out) {
 void NativeDevice::Diagflat(const Array& v, int64_t k, const Array& out) {
     CHAINERX_ASSERT(v.ndim() == 1);
     CHAINERX_ASSERT(out.ndim() == 2);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Diagflat", &NativeDevice::Diagflat, v, k, out)) {
+        return;
+    }
 
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -106,6 +129,10 @@ void NativeDevice::Diagflat(const Array& v, int64_t k, const Array& out) {
 void NativeDevice::Linspace(double start, double stop, const Array& out) {
     CHAINERX_ASSERT(out.ndim() == 1);
     CHAINERX_ASSERT(out.shape()[0] > 0);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Linspace", &NativeDevice::Linspace, start, stop, out)) {
+        return;
+    }
 
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
@@ -2,6 +2,8 @@
 
 #include <cstdint>
 
+#include <nonstd/optional.hpp>
+
 #include "chainerx/array.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
@@ -9,6 +11,7 @@
 #include "chainerx/indexer.h"
 #include "chainerx/macro.h"
 #include "chainerx/native/elementwise.h"
+#include "chainerx/profiler.h"
 #include "chainerx/shape.h"
 
 namespace chainerx {
@@ -16,6 +19,10 @@ namespace native {
 
 void NativeDevice::Take(const Array& a, const Array& indices, int8_t axis, const Array& out) {
     CheckDevicesCompatible(a, indices, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Take", &NativeDevice::Take, a, indices, axis, out)) {
+        return;
+    }
     VisitDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
 
@@ -74,6 +81,10 @@ void NativeDevice::Take(const Array& a, const Array& indices, int8_t axis, const
 void NativeDevice::AddAt(const Array& a, const Array& indices, int8_t axis, const Array& b, const Array& out) {
     CheckDevicesCompatible(a, indices, b);
     CHAINERX_ASSERT(a.shape() == out.shape());
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "AddAt", &NativeDevice::AddAt, a, indices, axis, b, out)) {
+        return;
+    }
     VisitDtype(a.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
 
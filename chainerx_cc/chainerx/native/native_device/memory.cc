@@ -5,8 +5,10 @@
 #include <cstring>
 #include <memory>
 
+#include "chainerx/arena.h"
 #include "chainerx/device.h"
 #include "chainerx/macro.h"
+#include "chainerx/profiler.h"
 
 namespace chainerx {
 namespace native {
@@ -15,16 +17,25 @@ std::shared_ptr<void> NativeDevice::Allocate(size_t bytesize) {
     if (bytesize == 0) {
         return std::shared_ptr<void>{nullptr};
     }
+    ProfileRange::RecordAllocation(bytesize);
+    if (std::shared_ptr<void> ptr = internal::AllocateFromDefaultArena(*this, bytesize)) {
+        return ptr;
+    }
     return std::make_unique<uint8_t[]>(bytesize);
 }
 
 void NativeDevice::MemoryCopyFrom(void* dst, const void* src, size_t bytesize, Device& src_device) {
     CHAINERX_ASSERT(nullptr != dynamic_cast<NativeDevice*>(&src_device) && "Native device only supports copy between native devices");
+    // Wait for pending kernels writing to the source or the destination.
+    Synchronize();
+    src_device.Synchronize();
     std::memcpy(dst, src, bytesize);
 }
 
 void NativeDevice::MemoryCopyTo(void* dst, const void* src, size_t bytesize, Device& dst_device) {
     CHAINERX_ASSERT(nullptr != dynamic_cast<NativeDevice*>(&dst_device) && "Native device only supports copy between native devices");
+    Synchronize();
+    dst_device.Synchronize();
     std::memcpy(dst, src, bytesize);
 }
 
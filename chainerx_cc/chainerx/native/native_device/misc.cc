@@ -3,16 +3,23 @@
 #include <cmath>
 #include <cstdint>
 
+#include <nonstd/optional.hpp>
+
 #include "chainerx/array.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/native/elementwise.h"
+#include "chainerx/profiler.h"
 
 namespace chainerx {
 namespace native {
 
 void NativeDevice::Sqrt(const Array& x, const Array& out) {
     CheckDevicesCompatible(x, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Sqrt", &NativeDevice::Sqrt, x, out)) {
+        return;
+    }
     VisitFloatingPointDtype(out.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -24,6 +31,10 @@ void NativeDevice::Sqrt(const Array& x, const Array& out) {
 
 void NativeDevice::IsNan(const Array& x, const Array& out) {
     CheckDevicesCompatible(x, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "IsNan", &NativeDevice::IsNan, x, out)) {
+        return;
+    }
     VisitDtype(x.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
@@ -35,6 +46,10 @@ void NativeDevice::IsNan(const Array& x, const Array& out) {
 
 void NativeDevice::IsInf(const Array& x, const Array& out) {
     CheckDevicesCompatible(x, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "IsInf", &NativeDevice::IsInf, x, out)) {
+        return;
+    }
     VisitDtype(x.dtype(), [&](auto pt) {
         using T = typename decltype(pt)::type;
         struct Impl {
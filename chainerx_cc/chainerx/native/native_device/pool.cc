@@ -15,6 +15,7 @@
 #include "chainerx/native/im2col.h"
 #include "chainerx/native/tensor_dot.h"
 #include "chainerx/numeric_limits.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/connection.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/indexing.h"
@@ -59,6 +60,7 @@ public:
         : kernel_size_{std::move(kernel_size)}, stride_{std::move(stride)}, pad_{std::move(pad)}, cover_all_{cover_all} {}
 
     Array Forward(const Array& x) override {
+        ProfileRange profile_range{"kernel", "MaxPoolForward"};
         CHAINERX_ASSERT(internal::GetArrayBody(x)->nodes().empty());
 
         // Convert to column representation of shape (batch_size, channel, k_1, k_2, ..., k_n, out_1, out_2, ..., out_n).
@@ -70,6 +72,7 @@ public:
     }
 
     Array Backward(const Array& gout) override {
+        ProfileRange profile_range{"kernel", "MaxPoolBackward"};
         CHAINERX_ASSERT(internal::GetArrayBody(gout)->nodes().empty());
 
         indices_ = col_.ArgMax(axes_);
@@ -97,6 +100,7 @@ public:
     }
 
     Array DoubleBackward(const Array& ggx) override {
+        ProfileRange profile_range{"kernel", "MaxPoolDoubleBackward"};
         CHAINERX_ASSERT(internal::GetArrayBody(ggx)->nodes().empty());
 
         Array col = native_internal::Im2Col(ggx, kernel_size_, stride_, pad_, cover_all_, GetLowestOrInf(x_.dtype()));
@@ -206,6 +210,7 @@ public:
         : kernel_size_{std::move(kernel_size)}, stride_{std::move(stride)}, pad_{std::move(pad)}, pad_mode_{pad_mode} {}
 
     Array Forward(const Array& x) override {
+        ProfileRange profile_range{"kernel", "AveragePoolForward"};
         CHAINERX_ASSERT(internal::GetArrayBody(x)->nodes().empty());
 
         Array col = native_internal::Im2Col(x, kernel_size_, stride_, pad_, false, 0);
@@ -237,6 +242,7 @@ public:
     }
 
     Array Backward(const Array& gout) override {
+        ProfileRange profile_range{"kernel", "AveragePoolBackward"};
         CHAINERX_ASSERT(internal::GetArrayBody(gout)->nodes().empty());
 
         Shape reshape_to = gcol_shape_;
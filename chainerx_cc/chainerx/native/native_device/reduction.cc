@@ -2,12 +2,15 @@
 
 #include <cstdint>
 
+#include <nonstd/optional.hpp>
+
 #include "chainerx/array.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
 #include "chainerx/macro.h"
 #include "chainerx/native/reduce.h"
 #include "chainerx/numeric_limits.h"
+#include "chainerx/profiler.h"
 #include "chainerx/shape.h"
 
 namespace chainerx {
@@ -17,6 +20,10 @@ void NativeDevice::ArgMax(const Array& a, const Axes& axis, const Array& out) {
     CHAINERX_ASSERT(std::all_of(axis.begin(), axis.end(), [&a](int8_t i) { return a.shape()[i] > 0; }));
     CHAINERX_ASSERT(internal::IsValidReductionShape(a.shape(), axis, out.shape(), false));
     CheckDevicesCompatible(a, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "ArgMax", &NativeDevice::ArgMax, a, axis, out)) {
+        return;
+    }
 
     VisitDtype(a.dtype(), [&a, &axis, &out](auto pt) {
         using T = typename decltype(pt)::type;
@@ -42,6 +49,10 @@ void NativeDevice::ArgMax(const Array& a, const Axes& axis, const Array& out) {
 void NativeDevice::Sum(const Array& a, const Axes& axis, const Array& out) {
     CHAINERX_ASSERT(internal::IsValidReductionShape(a.shape(), axis, out.shape(), true));
     CheckDevicesCompatible(a, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "Sum", &NativeDevice::Sum, a, axis, out)) {
+        return;
+    }
 
     auto do_sum = [&a, &axis, &out](auto in_pt, auto out_pt) {
         using In = typename decltype(in_pt)::type;
@@ -61,6 +72,10 @@ void NativeDevice::Sum(const Array& a, const Axes& axis, const Array& out) {
 void NativeDevice::AMax(const Array& a, const Axes& axis, const Array& out) {
     CHAINERX_ASSERT(internal::IsValidReductionShape(a.shape(), axis, out.shape(), true));
     CheckDevicesCompatible(a, out);
+    nonstd::optional<ProfileRange> profile_range{};
+    if (EnqueueIfAsync(profile_range, "AMax", &NativeDevice::AMax, a, axis, out)) {
+        return;
+    }
 
     VisitDtype(a.dtype(), [&a, &axis, &out](auto pt) {
         using T = typename decltype(pt)::type;
@@ -1,15 +1,31 @@
 #include "chainerx/native/native_device.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <future>
 #include <memory>
 #include <string>
 #include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
+#include <nonstd/optional.hpp>
 
+#include "chainerx/array.h"
+#include "chainerx/backward.h"
 #include "chainerx/context.h"
+#include "chainerx/error.h"
 #include "chainerx/native/native_backend.h"
+#include "chainerx/routines/connection.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/linalg.h"
+#include "chainerx/routines/manipulation.h"
+#include "chainerx/routines/pooling.h"
+#include "chainerx/slice.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
 #include "chainerx/testing/threading.h"
 
 namespace chainerx {
@@ -104,6 +120,111 @@ TEST(NativeDeviceTest, Synchronize) {
     device.Synchronize();  // no throw
 }
 
+TEST(NativeDeviceTest, SetAsync) {
+    Context ctx;
+    NativeDevice& device = GetNativeDevice(ctx, 0);
+    const char* env = std::getenv("CHAINERX_NATIVE_ASYNC");
+    EXPECT_EQ(env != nullptr && std::string{env} == "1", device.is_async());
+    device.SetAsync(true);
+    EXPECT_TRUE(device.is_async());
+    device.SetAsync(false);
+    EXPECT_FALSE(device.is_async());
+}
+
+Array ComputeForAsyncTest() {
+    Array x = (*testing::BuildArray({2, 3, 6, 6}).WithLinearData<float>(-1.f, 0.05f)).RequireGrad();
+    Array w = (*testing::BuildArray({4, 3, 3, 3}).WithLinearData<float>(-0.5f, 0.01f)).RequireGrad();
+    Array y = MaxPool(Conv(x, w, nonstd::nullopt, {1, 1}, {1, 1}), {2, 2}, {2, 2}, {0, 0});
+    Array z = Dot(y.Reshape({2, 36}), Ones({36, 5}, Dtype::kFloat32)) * 2 + 1;
+    Backward(z.Sum());
+    return Stack({z.Reshape({10}), x.GetGrad()->Reshape({216}).At({Slice{0, 10}}), w.GetGrad()->Reshape({108}).At({Slice{0, 10}})});
+}
+
+TEST(NativeDeviceTest, AsyncResult) {
+    testing::DeviceSession device_session{DeviceId{"native", 0}};
+    auto& device = dynamic_cast<NativeDevice&>(device_session.device());
+
+    Array expected = ComputeForAsyncTest();
+    device.SetAsync(true);
+    Array actual = ComputeForAsyncTest();
+    EXPECT_ARRAY_EQ(expected, actual);  // ToNative() synchronizes.
+}
+
+TEST(NativeDeviceTest, AsyncAsScalar) {
+    testing::DeviceSession device_session{DeviceId{"native", 0}};
+    auto& device = dynamic_cast<NativeDevice&>(device_session.device());
+    device.SetAsync(true);
+
+    Array a = Arange(1000, Dtype::kInt64);
+    for (int i = 0; i < 10; ++i) {
+        a += 1;
+    }
+    EXPECT_EQ(int64_t{(1000 * 999) / 2 + 10000}, static_cast<int64_t>(AsScalar(a.Sum())));
+}
+
+TEST(NativeDeviceTest, AsyncTransfer) {
+    testing::DeviceSession device_session{DeviceId{"native", 0}};
+    auto& device = dynamic_cast<NativeDevice&>(device_session.device());
+    device.SetAsync(true);
+
+    Device& dst_device = device.context().GetDevice({"native", 1});
+    Array a = Full({100}, 2.f, device) * 3;
+    Array b = a.ToDevice(dst_device);
+    EXPECT_EQ(&dst_device, &b.device());
+    EXPECT_ARRAY_EQ(Full({100}, 6.f, dst_device), b);
+}
+
+TEST(NativeDeviceTest, AsyncError) {
+    Context ctx;
+    NativeDevice& device = GetNativeDevice(ctx, 0);
+    device.SetAsync(true);
+
+    device.Launch([]() { throw ChainerxError{"error"}; });
+    EXPECT_THROW(device.Synchronize(), ChainerxError);
+    device.Synchronize();  // no throw
+}
+
+TEST(NativeDeviceTest, AsyncDataUseCount) {
+    testing::DeviceSession device_session{DeviceId{"native", 0}};
+    auto& device = dynamic_cast<NativeDevice&>(device_session.device());
+    device.SetAsync(true);
+
+    Array a = Zeros({10}, Dtype::kFloat32, device);
+    device.Synchronize();
+    std::promise<void> promise{};
+    std::shared_future<void> future = promise.get_future().share();
+    device.Launch([future](const Array& /*a*/) { future.wait(); }, a);
+
+    // The reference held by the pending kernel is excluded.
+    EXPECT_EQ(2, a.data().use_count());
+    EXPECT_EQ(1, device.GetDataUseCount(a.data()));
+    {
+        Array b = a.MakeView();
+        EXPECT_EQ(2, device.GetDataUseCount(a.data()));
+    }
+
+    promise.set_value();
+    device.Synchronize();
+    EXPECT_EQ(1, a.data().use_count());
+    EXPECT_EQ(1, device.GetDataUseCount(a.data()));
+}
+
+TEST(NativeDeviceTest, AsyncMultiThread) {
+    testing::DeviceSession device_session{DeviceId{"native", 0}};
+    auto& device = dynamic_cast<NativeDevice&>(device_session.device());
+    device.SetAsync(true);
+
+    testing::RunThreads(4, [&device]() {
+        ContextScope context_scope{device.context()};
+        DeviceScope device_scope{device};
+        Array a = Zeros({100}, Dtype::kFloat32, device);
+        for (int i = 0; i < 10; ++i) {
+            a += Ones({100}, Dtype::kFloat32, device);
+        }
+        EXPECT_ARRAY_EQ(Full({100}, 10.f, device), a);
+    });
+}
+
 TEST(NativeDeviceTest, GetBackendMultiThread) {
     Context ctx;
     NativeDevice& device = GetNativeDevice(ctx, 0);
@@ -0,0 +1,110 @@
+#include "chainerx/native/native_stream.h"
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace chainerx {
+namespace native {
+namespace {
+
+// The stream whose worker thread is the current thread, if any.
+thread_local NativeStream* t_worker_stream{nullptr};
+
+void CallAll(const std::vector<std::function<void()>>& funcs) {
+    for (const std::function<void()>& func : funcs) {
+        func();
+    }
+}
+
+}  // namespace
+
+constexpr size_t NativeStream::kMaxPendingTaskCount;
+
+NativeStream::NativeStream() : thread_{[this]() { WorkerLoop(); }} {}
+
+NativeStream::~NativeStream() {
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stopped_ = true;
+    }
+    cv_.notify_all();
+    thread_.join();
+    CallAll(deferred_);
+}
+
+void NativeStream::Enqueue(std::function<void()> task) {
+    std::vector<std::function<void()>> deferred{};
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        cv_.wait(lock, [this]() { return tasks_.size() < kMaxPendingTaskCount; });
+        tasks_.emplace_back(std::move(task));
+        deferred.swap(deferred_);
+    }
+    cv_.notify_all();
+    CallAll(deferred);
+}
+
+void NativeStream::Synchronize() {
+    std::vector<std::function<void()>> deferred{};
+    std::exception_ptr error{};
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        cv_.wait(lock, [this]() { return tasks_.empty() && !running_; });
+        deferred.swap(deferred_);
+        std::swap(error, error_);
+    }
+    CallAll(deferred);
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+bool NativeStream::IsAnyWorkerThread() { return t_worker_stream != nullptr; }
+
+void NativeStream::CallOutsideWorkerThread(std::function<void()> func) {
+    NativeStream* stream = t_worker_stream;
+    if (stream == nullptr) {
+        func();
+        return;
+    }
+    std::lock_guard<std::mutex> lock{stream->mutex_};
+    stream->deferred_.emplace_back(std::move(func));
+}
+
+void NativeStream::WorkerLoop() {
+    t_worker_stream = this;
+    std::unique_lock<std::mutex> lock{mutex_};
+    while (true) {
+        cv_.wait(lock, [this]() { return stopped_ || !tasks_.empty(); });
+        if (tasks_.empty()) {
+            return;
+        }
+        std::function<void()> task = std::move(tasks_.front());
+        tasks_.pop_front();
+        running_ = true;
+        lock.unlock();
+
+        std::exception_ptr error{};
+        try {
+            task();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        // The captured objects are released before the task is reported as finished, so that they are not alive after Synchronize().
+        task = nullptr;
+
+        lock.lock();
+        if (error && !error_) {
+            error_ = std::move(error);
+        }
+        running_ = false;
+        cv_.notify_all();
+    }
+}
+
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace chainerx {
+namespace native {
+
+// A queue of tasks executed in order by a dedicated worker thread.
+//
+// The first exception thrown by a task is rethrown by the next call to Synchronize(); the following tasks are still executed.
+// Each task is destroyed by the worker thread as soon as it finishes, so that the objects captured by it are released in time.
+class NativeStream {
+public:
+    // Maximum number of pending tasks. Enqueue() blocks while the queue is full.
+    static constexpr size_t kMaxPendingTaskCount = 1024;
+
+    NativeStream();
+
+    // Waits for all the enqueued tasks. Errors are discarded.
+    ~NativeStream();
+
+    NativeStream(const NativeStream&) = delete;
+    NativeStream(NativeStream&&) = delete;
+    NativeStream& operator=(const NativeStream&) = delete;
+    NativeStream& operator=(NativeStream&&) = delete;
+
+    void Enqueue(std::function<void()> task);
+
+    // Waits until all the enqueued tasks are finished.
+    void Synchronize();
+
+    // Returns true if the current thread is the worker thread of this stream.
+    bool IsWorkerThread() const { return std::this_thread::get_id() == thread_.get_id(); }
+
+    // Returns true if the current thread is the worker thread of any stream.
+    static bool IsAnyWorkerThread();
+
+    // Calls the function immediately, or, if called from the worker thread of a stream, defers the call to the next thread calling
+    // Enqueue() or Synchronize() of the stream.
+    // This is used to release objects which must not be released by a worker thread, e.g. buffers owned by Python objects, since the
+    // thread holding the GIL may be waiting for the worker thread.
+    static void CallOutsideWorkerThread(std::function<void()> func);
+
+private:
+    void WorkerLoop();
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    std::vector<std::function<void()>> deferred_;
+    bool running_{false};
+    bool stopped_{false};
+    std::exception_ptr error_{};
+    std::thread thread_;
+};
+
+}  // namespace native
+}  // namespace chainerx
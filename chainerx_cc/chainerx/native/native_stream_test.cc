@@ -0,0 +1,106 @@
+#include "chainerx/native/native_stream.h"
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace chainerx {
+namespace native {
+namespace {
+
+TEST(NativeStreamTest, Order) {
+    std::vector<int> values;
+    NativeStream stream{};
+    for (int i = 0; i < 100; ++i) {
+        stream.Enqueue([&values, i]() { values.emplace_back(i); });
+    }
+    stream.Synchronize();
+
+    ASSERT_EQ(100U, values.size());
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(i, values[i]);
+    }
+}
+
+TEST(NativeStreamTest, WorkerThread) {
+    NativeStream stream{};
+    EXPECT_FALSE(stream.IsWorkerThread());
+
+    bool is_worker_thread{false};
+    std::thread::id thread_id{};
+    stream.Enqueue([&stream, &is_worker_thread, &thread_id]() {
+        is_worker_thread = stream.IsWorkerThread();
+        thread_id = std::this_thread::get_id();
+    });
+    stream.Synchronize();
+    EXPECT_TRUE(is_worker_thread);
+    EXPECT_NE(std::this_thread::get_id(), thread_id);
+}
+
+TEST(NativeStreamTest, Error) {
+    NativeStream stream{};
+    int count{0};
+    stream.Enqueue([]() { throw std::runtime_error{"first"}; });
+    stream.Enqueue([]() { throw std::runtime_error{"second"}; });
+    stream.Enqueue([&count]() { ++count; });
+
+    try {
+        stream.Synchronize();
+        FAIL() << "Synchronize must rethrow the error";
+    } catch (const std::runtime_error& e) {
+        EXPECT_STREQ("first", e.what());
+    }
+    EXPECT_EQ(1, count);
+
+    // The error is cleared.
+    stream.Synchronize();
+}
+
+TEST(NativeStreamTest, DestructorWaitsForTasks) {
+    std::atomic<int> count{0};
+    {
+        NativeStream stream{};
+        for (int i = 0; i < 10; ++i) {
+            stream.Enqueue([&count]() {
+                std::this_thread::yield();
+                ++count;
+            });
+        }
+    }
+    EXPECT_EQ(10, count);
+}
+
+TEST(NativeStreamTest, FinishedTasksReleased) {
+    NativeStream stream{};
+    std::weak_ptr<int> weak_value{};
+    {
+        auto value = std::make_shared<int>(1);
+        weak_value = value;
+        stream.Enqueue([value]() {});
+    }
+    stream.Synchronize();
+    EXPECT_TRUE(weak_value.expired());
+}
+
+TEST(NativeStreamTest, CallOutsideWorkerThread) {
+    NativeStream stream{};
+    std::thread::id thread_id{};
+    NativeStream::CallOutsideWorkerThread([&thread_id]() { thread_id = std::this_thread::get_id(); });
+    EXPECT_EQ(std::this_thread::get_id(), thread_id);
+
+    // Calls from the worker thread are deferred to the caller of Synchronize().
+    thread_id = std::thread::id{};
+    stream.Enqueue([&thread_id]() {
+        NativeStream::CallOutsideWorkerThread([&thread_id]() { thread_id = std::this_thread::get_id(); });
+    });
+    stream.Synchronize();
+    EXPECT_EQ(std::this_thread::get_id(), thread_id);
+}
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,187 @@
+#include "chainerx/native/shared_memory.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include <utility>
+
+#include <nonstd/optional.hpp>
+
+#include "chainerx/error.h"
+
+namespace chainerx {
+namespace native {
+namespace {
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "Reference counts in shared memory must be lock free");
+
+// Header at the beginning of each shared memory object, followed by the buffer.
+struct SharedMemoryHeader {
+    // Number of references, including those added by RetainSharedMemory() and not taken over yet.
+    std::atomic<int64_t> ref_count;
+    // Number of references added by RetainSharedMemory() and not taken over yet.
+    std::atomic<int64_t> pending_count;
+    uint64_t bytesize;
+};
+
+// The buffer is aligned as well as the buffers allocated by the native device.
+constexpr size_t kHeaderSize = 64;
+static_assert(sizeof(SharedMemoryHeader) <= kHeaderSize, "Shared memory header is too large");
+
+// Counter to make the names of the shared memory objects created in this process unique.
+std::atomic<uint64_t> g_shared_memory_count{0};
+
+// Function called with the names of the shared memory objects unlinked by this process. See SetSharedMemoryUnlinkHook().
+std::function<void(const std::string&)> g_unlink_hook{};
+
+std::string GetErrorMessage() { return std::strerror(errno); }
+
+// Deleter of the buffers in shared memory, which also identifies them.
+class SharedMemoryDeleter {
+public:
+    SharedMemoryDeleter(std::string name, void* base, size_t mapped_size)
+        : name_{std::move(name)}, base_{base}, mapped_size_{mapped_size} {}
+
+    void operator()(void* /*ptr*/) {
+        if (header().ref_count.fetch_sub(1) == 1) {
+            shm_unlink(name_.c_str());
+            if (g_unlink_hook) {
+                g_unlink_hook(name_);
+            }
+        }
+        munmap(base_, mapped_size_);
+    }
+
+    const std::string& name() const { return name_; }
+
+    SharedMemoryHeader& header() const { return *static_cast<SharedMemoryHeader*>(base_); }
+
+private:
+    std::string name_;
+    void* base_;
+    size_t mapped_size_;
+};
+
+const SharedMemoryDeleter& GetSharedMemoryDeleter(const std::shared_ptr<void>& data) {
+    const auto* deleter = std::get_deleter<SharedMemoryDeleter>(data);
+    if (deleter == nullptr) {
+        throw ChainerxError{"The buffer is not in shared memory."};
+    }
+    return *deleter;
+}
+
+// Maps the whole shared memory object and returns the address of the header. The file descriptor is closed.
+void* MapSharedMemory(const std::string& name, int fd, size_t mapped_size) {
+    void* base = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+        std::string message = GetErrorMessage();
+        close(fd);
+        throw ChainerxError{"Failed to map shared memory ", name, ": ", message};
+    }
+    close(fd);
+    return base;
+}
+
+// Makes a buffer releasing a reference held by the caller.
+std::shared_ptr<void> MakeSharedMemoryBuffer(std::string name, void* base, size_t mapped_size) {
+    void* ptr = static_cast<uint8_t*>(base) + kHeaderSize;
+    return std::shared_ptr<void>{ptr, SharedMemoryDeleter{std::move(name), base, mapped_size}};
+}
+
+// Acquires a reference for a new buffer, taking over a reference added by RetainSharedMemory() if any.
+// Otherwise a new reference is added unless the object has already been released.
+bool AcquireSharedMemory(SharedMemoryHeader& header) {
+    int64_t pending_count = header.pending_count.load();
+    while (pending_count > 0) {
+        if (header.pending_count.compare_exchange_weak(pending_count, pending_count - 1)) {
+            return true;
+        }
+    }
+    int64_t ref_count = header.ref_count.load();
+    while (ref_count > 0) {
+        if (header.ref_count.compare_exchange_weak(ref_count, ref_count + 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+std::shared_ptr<void> AllocateSharedMemory(size_t bytesize) {
+    std::string name = "/chainerx_" + std::to_string(getpid()) + '_' + std::to_string(g_shared_memory_count++);
+    int fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        throw ChainerxError{"Failed to create shared memory ", name, ": ", GetErrorMessage()};
+    }
+    size_t mapped_size = kHeaderSize + bytesize;
+    if (ftruncate(fd, static_cast<off_t>(mapped_size)) != 0) {
+        std::string message = GetErrorMessage();
+        close(fd);
+        shm_unlink(name.c_str());
+        throw ChainerxError{"Failed to allocate shared memory ", name, ": ", message};
+    }
+
+    void* base{};
+    try {
+        base = MapSharedMemory(name, fd, mapped_size);
+    } catch (...) {
+        shm_unlink(name.c_str());
+        throw;
+    }
+    new (base) SharedMemoryHeader{{1}, {0}, bytesize};
+    return MakeSharedMemoryBuffer(std::move(name), base, mapped_size);
+}
+
+nonstd::optional<std::string> GetSharedMemoryName(const std::shared_ptr<void>& data) {
+    if (const auto* deleter = std::get_deleter<SharedMemoryDeleter>(data)) {
+        return deleter->name();
+    }
+    return nonstd::nullopt;
+}
+
+size_t GetSharedMemoryByteSize(const std::shared_ptr<void>& data) {
+    return static_cast<size_t>(GetSharedMemoryDeleter(data).header().bytesize);
+}
+
+void RetainSharedMemory(const std::shared_ptr<void>& data) {
+    SharedMemoryHeader& header = GetSharedMemoryDeleter(data).header();
+    // The reference is added before it is marked as pending, so that the count never drops to zero while it is pending.
+    ++header.ref_count;
+    ++header.pending_count;
+}
+
+void SetSharedMemoryUnlinkHook(std::function<void(const std::string& name)> hook) { g_unlink_hook = std::move(hook); }
+
+std::shared_ptr<void> OpenSharedMemory(const std::string& name) {
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        throw ChainerxError{"Failed to open shared memory ", name, ": ", GetErrorMessage()};
+    }
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < kHeaderSize) {
+        close(fd);
+        throw ChainerxError{"Invalid shared memory ", name, '.'};
+    }
+    auto mapped_size = static_cast<size_t>(st.st_size);
+    void* base = MapSharedMemory(name, fd, mapped_size);
+    if (!AcquireSharedMemory(*static_cast<SharedMemoryHeader*>(base))) {
+        munmap(base, mapped_size);
+        throw ChainerxError{"Shared memory ", name, " has already been released."};
+    }
+    return MakeSharedMemoryBuffer(name, base, mapped_size);
+}
+
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <nonstd/optional.hpp>
+
+namespace chainerx {
+namespace native {
+
+// Buffers placed in POSIX shared memory objects, which can be mapped by other processes without copying.
+//
+// A shared memory object holds a reference count shared among processes. Each buffer returned by AllocateSharedMemory() and
+// OpenSharedMemory() holds a reference, and the object is unlinked when the last reference is released.
+// Objects whose references are not released, e.g. because a process is killed, remain in the system until they are unlinked manually
+// or by a tracker notified through SetSharedMemoryUnlinkHook().
+
+// Allocates a buffer in a new shared memory object.
+std::shared_ptr<void> AllocateSharedMemory(size_t bytesize);
+
+// Returns the name of the shared memory object the buffer belongs to, or nullopt if the buffer is not in shared memory.
+nonstd::optional<std::string> GetSharedMemoryName(const std::shared_ptr<void>& data);
+
+// Returns the size of the buffer in the shared memory object. The buffer must be in shared memory.
+size_t GetSharedMemoryByteSize(const std::shared_ptr<void>& data);
+
+// Adds a pending reference to the shared memory object of the buffer, which is taken over by a following call to OpenSharedMemory(),
+// possibly in another process. This keeps the object alive while its name is sent to another process.
+// A pending reference which is never taken over keeps the object alive until it is unlinked manually or by a tracker.
+void RetainSharedMemory(const std::shared_ptr<void>& data);
+
+// Sets a function called with the name of each shared memory object unlinked by this process, e.g. to stop tracking the object for
+// cleanup. The function is called in the thread releasing the last reference and must not throw. It must be set before any buffer is
+// allocated or opened.
+void SetSharedMemoryUnlinkHook(std::function<void(const std::string& name)> hook);
+
+// Maps the shared memory object with the given name.
+// The returned buffer takes over a pending reference added by RetainSharedMemory() if any, or holds a new reference otherwise, so that
+// opening a name more than once, e.g. unpickling the same state twice, does not release the object early.
+// Throws ChainerxError if the object has already been released.
+std::shared_ptr<void> OpenSharedMemory(const std::string& name);
+
+}  // namespace native
+}  // namespace chainerx
@@ -0,0 +1,124 @@
+#include "chainerx/native/shared_memory.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <nonstd/optional.hpp>
+
+#include "chainerx/error.h"
+
+namespace chainerx {
+namespace native {
+namespace {
+
+TEST(SharedMemoryTest, Allocate) {
+    std::shared_ptr<void> data = AllocateSharedMemory(16);
+    ASSERT_NE(nullptr, data);
+    EXPECT_EQ(size_t{16}, GetSharedMemoryByteSize(data));
+    EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(data.get()) % 64);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+    nonstd::optional<std::string> name = GetSharedMemoryName(data);
+    ASSERT_TRUE(name.has_value());
+    EXPECT_EQ(name, GetSharedMemoryName(std::shared_ptr<void>{data, static_cast<uint8_t*>(data.get()) + 4}));
+    std::memset(data.get(), 1, 16);
+}
+
+TEST(SharedMemoryTest, AllocateZero) {
+    std::shared_ptr<void> data = AllocateSharedMemory(0);
+    EXPECT_EQ(size_t{0}, GetSharedMemoryByteSize(data));
+    EXPECT_TRUE(GetSharedMemoryName(data).has_value());
+}
+
+TEST(SharedMemoryTest, NotSharedMemory) {
+    std::shared_ptr<void> data = std::make_unique<uint8_t[]>(16);
+    EXPECT_FALSE(GetSharedMemoryName(data).has_value());
+    EXPECT_THROW(GetSharedMemoryByteSize(data), ChainerxError);
+    EXPECT_THROW(RetainSharedMemory(data), ChainerxError);
+}
+
+TEST(SharedMemoryTest, Open) {
+    std::shared_ptr<void> data = AllocateSharedMemory(sizeof(int32_t));
+    *static_cast<int32_t*>(data.get()) = 42;
+    std::string name = *GetSharedMemoryName(data);
+
+    RetainSharedMemory(data);
+    std::shared_ptr<void> opened = OpenSharedMemory(name);
+    EXPECT_NE(data.get(), opened.get());  // Mapped twice.
+    EXPECT_EQ(name, GetSharedMemoryName(opened));
+    EXPECT_EQ(sizeof(int32_t), GetSharedMemoryByteSize(opened));
+    EXPECT_EQ(42, *static_cast<int32_t*>(opened.get()));
+
+    *static_cast<int32_t*>(opened.get()) = 7;
+    EXPECT_EQ(7, *static_cast<int32_t*>(data.get()));
+
+    // The object is alive while any buffer refers to it.
+    data.reset();
+    EXPECT_EQ(7, *static_cast<int32_t*>(opened.get()));
+    RetainSharedMemory(opened);
+    std::shared_ptr<void> reopened = OpenSharedMemory(name);
+    EXPECT_EQ(7, *static_cast<int32_t*>(reopened.get()));
+}
+
+TEST(SharedMemoryTest, OpenMoreThanRetained) {
+    std::shared_ptr<void> data = AllocateSharedMemory(sizeof(int32_t));
+    *static_cast<int32_t*>(data.get()) = 42;
+    std::string name = *GetSharedMemoryName(data);
+
+    // Opens beyond the pending references hold their own references.
+    RetainSharedMemory(data);
+    std::shared_ptr<void> opened1 = OpenSharedMemory(name);
+    std::shared_ptr<void> opened2 = OpenSharedMemory(name);
+    data.reset();
+    opened1.reset();
+    EXPECT_EQ(42, *static_cast<int32_t*>(opened2.get()));
+    std::shared_ptr<void> opened3 = OpenSharedMemory(name);
+    EXPECT_EQ(42, *static_cast<int32_t*>(opened3.get()));
+
+    // The object is unlinked when the last buffer is released.
+    opened2.reset();
+    opened3.reset();
+    EXPECT_THROW(OpenSharedMemory(name), ChainerxError);
+}
+
+TEST(SharedMemoryTest, PendingReferenceKeepsAlive) {
+    std::shared_ptr<void> data = AllocateSharedMemory(8);
+    std::string name = *GetSharedMemoryName(data);
+    RetainSharedMemory(data);
+    data.reset();
+
+    std::shared_ptr<void> opened = OpenSharedMemory(name);
+    opened.reset();
+    EXPECT_THROW(OpenSharedMemory(name), ChainerxError);
+}
+
+TEST(SharedMemoryTest, UnlinkedByLastReference) {
+    std::shared_ptr<void> data = AllocateSharedMemory(8);
+    std::string name = *GetSharedMemoryName(data);
+    data.reset();
+    EXPECT_THROW(OpenSharedMemory(name), ChainerxError);
+}
+
+TEST(SharedMemoryTest, UnlinkHook) {
+    std::vector<std::string> unlinked{};
+    SetSharedMemoryUnlinkHook([&unlinked](const std::string& name) { unlinked.emplace_back(name); });
+
+    std::shared_ptr<void> data = AllocateSharedMemory(8);
+    std::string name = *GetSharedMemoryName(data);
+    std::shared_ptr<void> opened = OpenSharedMemory(name);
+    data.reset();
+    EXPECT_TRUE(unlinked.empty());
+    opened.reset();
+    EXPECT_EQ(std::vector<std::string>{name}, unlinked);
+
+    SetSharedMemoryUnlinkHook(nullptr);
+}
+
+TEST(SharedMemoryTest, OpenInvalidName) { EXPECT_THROW(OpenSharedMemory("/chainerx_invalid_name"), ChainerxError); }
+
+}  // namespace
+}  // namespace native
+}  // namespace chainerx
@@ -13,6 +13,7 @@
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
 #include "chainerx/macro.h"
+#include "chainerx/strides.h"
 
 namespace chainerx {
 namespace internal {
@@ -21,6 +22,12 @@ ArrayProps::ArrayProps(const Array& array) : shape{array.shape()}, dtype{array.d
 ArrayProps::ArrayProps(const ArrayNode& array_node) : shape{array_node.shape()}, dtype{array_node.dtype()}, device{array_node.device()} {}
 ArrayProps::ArrayProps(const ArrayBody& array_body) : shape{array_body.shape()}, dtype{array_body.dtype()}, device{array_body.device()} {}
 
+RetainedBuffer::RetainedBuffer(const ArrayBody& array_body) : data{array_body.data().get()}, extent{0} {
+    if (array_body.GetTotalSize() > 0) {
+        extent = array_body.offset() + std::get<1>(GetDataRange(array_body.shape(), array_body.strides(), array_body.GetItemSize()));
+    }
+}
+
 OpNodeBackwardEntry::OpNodeBackwardEntry(OpNode& op_node, std::vector<size_t> input_array_node_indices, BackwardFunction backward_func)
     : op_node_{op_node}, input_array_node_indices_{std::move(input_array_node_indices)}, backward_func_{std::move(backward_func)} {}
 
@@ -165,34 +172,25 @@ const std::vector<std::shared_ptr<ArrayNode>>& OpNode::input_array_nodes() const
 }
 
 OpNodeBackwardEntry& OpNode::RegisterBackwardFunction(
-        std::vector<std::tuple<size_t, std::shared_ptr<ArrayNode>>> input_array_nodes, BackwardFunction backward_func) {
+        std::vector<size_t> input_array_node_indices,
+        const std::vector<const std::shared_ptr<ArrayNode>*>& input_array_nodes,
+        BackwardFunction backward_func) {
     AssertConsistency();
-    CHAINERX_ASSERT(!input_array_nodes.empty());
-    CHAINERX_ASSERT(std::all_of(input_array_nodes.begin(), input_array_nodes.end(), [this](const auto& tup) {
-        const std::shared_ptr<ArrayNode>& input_array_node = std::get<1>(tup);
-        // input_array_node could be nullptr, if the corresponding input array does not require grad.
-        return input_array_node == nullptr || input_array_node->backprop_id() == backprop_id_;
-    }));
-
-    // Update the rank of op node
-    for (const auto& tup : input_array_nodes) {
-        const std::shared_ptr<ArrayNode>& input_array_node = std::get<1>(tup);
-        if (input_array_node != nullptr) {
-            rank_ = std::max(rank_, input_array_node->rank() + 1);
-        }
-    }
-
-    // Store input nodes and record indices of them
-    std::vector<size_t> input_array_node_indices;
-    input_array_node_indices.reserve(input_array_nodes.size());
-    for (auto& tup : input_array_nodes) {
-        size_t input_index = std::get<0>(tup);
-        std::shared_ptr<ArrayNode>& input_array_node = std::get<1>(tup);
+    CHAINERX_ASSERT(!input_array_node_indices.empty());
+    CHAINERX_ASSERT(input_array_nodes.size() == input_array_nodes_.size());
+    CHAINERX_ASSERT(
+            std::all_of(input_array_nodes.begin(), input_array_nodes.end(), [this](const std::shared_ptr<ArrayNode>* input_array_node) {
+                // input_array_node could be nullptr, if the corresponding input array does not require grad.
+                return input_array_node == nullptr || (*input_array_node)->backprop_id() == backprop_id_;
+            }));
 
-        input_array_node_indices.emplace_back(input_index);
+    // Update the rank of op node and store input nodes
+    for (size_t input_index : input_array_node_indices) {
+        const std::shared_ptr<ArrayNode>* input_array_node = gsl::at(input_array_nodes, input_index);
         if (input_array_node != nullptr) {
+            rank_ = std::max(rank_, (*input_array_node)->rank() + 1);
             CHAINERX_ASSERT(gsl::at(input_array_nodes_, input_index) == nullptr);
-            gsl::at(input_array_nodes_, input_index) = std::move(input_array_node);
+            gsl::at(input_array_nodes_, input_index) = *input_array_node;
         }
     }
 
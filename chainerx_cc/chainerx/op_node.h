@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -41,6 +43,16 @@ struct ArrayProps {
     Device& device;
 };
 
+// Buffer of an input array retained by the backward functions of an op node, which keep the buffer alive.
+struct RetainedBuffer {
+    explicit RetainedBuffer(const ArrayBody& array_body);
+
+    const void* data;
+
+    // Bytes from the head of the buffer to the end of the array viewing it.
+    int64_t extent;
+};
+
 class OpNodeBackwardEntry {
 public:
     OpNodeBackwardEntry(OpNode& op_node, std::vector<size_t> input_array_node_indices, BackwardFunction backward_func);
@@ -81,8 +93,13 @@ public:
     OpNode& operator=(const OpNode&) = delete;
     OpNode& operator=(OpNode&&) = delete;
 
+    // Registers a backward function that computes the gradients of the inputs at the given indices.
+    // `input_array_nodes` points to the array nodes of all the inputs on this graph, or is null for inputs without one. The vectors of the
+    // caller are used as they are to avoid allocations in every op.
     OpNodeBackwardEntry& RegisterBackwardFunction(
-            std::vector<std::tuple<size_t, std::shared_ptr<ArrayNode>>> input_array_nodes, BackwardFunction backward_func);
+            std::vector<size_t> input_array_node_indices,
+            const std::vector<const std::shared_ptr<ArrayNode>*>& input_array_nodes,
+            BackwardFunction backward_func);
 
     // Adds links to input array nodes of other graphs.
     // The size of the vector must be equal to the number of inputs.
@@ -94,8 +111,27 @@ public:
     void AddEdgesToOutputArrayNodesOfOuterGraph(
             const BackpropId& outer_backprop_id, std::vector<std::shared_ptr<ArrayNode>> outer_graphs_output_array_nodes);
 
-    void Unchain() {
+    // Sets the binary flags of the inputs and outputs retained by the backward functions, so that the memory held by graphs can be
+    // inspected. Each vector of flags is either empty or of the size of the inputs/outputs.
+    // The buffers of the retained inputs are given in the order of the inputs, since inputs which do not require grad on this graph are
+    // otherwise not reachable from the op node.
+    void SetRetentionFlags(std::vector<int8_t> input_flags, std::vector<int8_t> output_flags, std::vector<RetainedBuffer> input_buffers) {
+        CHAINERX_ASSERT(input_buffers.size() == static_cast<size_t>(std::count(input_flags.begin(), input_flags.end(), int8_t{1})));
+        retained_input_flags_ = std::move(input_flags);
+        retained_output_flags_ = std::move(output_flags);
+        retained_input_buffers_ = std::move(input_buffers);
+    }
+
+    // Releases the backward functions together with the arrays retained by them.
+    void ReleaseBackwardEntries() {
         backward_entries_.clear();
+        retained_input_flags_.clear();
+        retained_output_flags_.clear();
+        retained_input_buffers_.clear();
+    }
+
+    void Unchain() {
+        ReleaseBackwardEntries();
         std::fill(input_array_nodes_.begin(), input_array_nodes_.end(), std::shared_ptr<ArrayNode>{});
         AssertConsistency();
     }
@@ -112,6 +148,17 @@ public:
 
     gsl::span<const OpNodeBackwardEntry> backward_entries() const { return backward_entries_; }
 
+    bool IsInputRetained(size_t input_index) const {
+        return !retained_input_flags_.empty() && static_cast<bool>(retained_input_flags_[input_index]);
+    }
+
+    bool IsOutputRetained(size_t output_index) const {
+        return !retained_output_flags_.empty() && static_cast<bool>(retained_output_flags_[output_index]);
+    }
+
+    // Returns the buffers of the retained inputs in the order of the inputs. They are valid until the backward functions are released.
+    const std::vector<RetainedBuffer>& retained_input_buffers() const { return retained_input_buffers_; }
+
     size_t input_array_node_count() const { return input_array_nodes_.size(); }
 
     size_t output_array_node_count() const { return output_array_props_.size(); }
@@ -171,6 +218,10 @@ private:
     std::vector<ArrayProps> output_array_props_;
 
     std::vector<OpNodeBackwardEntry> backward_entries_;
+
+    std::vector<int8_t> retained_input_flags_;
+    std::vector<int8_t> retained_output_flags_;
+    std::vector<RetainedBuffer> retained_input_buffers_;
 };
 
 }  // namespace internal
@@ -0,0 +1,281 @@
+#include "chainerx/profiler.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <initializer_list>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "chainerx/array.h"
+#include "chainerx/error.h"
+#include "chainerx/macro.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+namespace {
+
+std::atomic<Profiler*> g_active_profiler{nullptr};
+
+// Guards the activation of profilers and their reference counts, so that no reference to a profiler is acquired after its scope ends.
+std::mutex g_profiler_mutex;
+
+// Notified when the last reference to a profiler is released.
+std::condition_variable g_profiler_released;
+
+// Innermost active range in the current thread.
+thread_local ProfileRange* t_current_range{nullptr};
+
+int64_t GetThreadId() {
+    static std::atomic<int64_t> next_thread_id{0};
+    thread_local int64_t t_thread_id{next_thread_id++};
+    return t_thread_id;
+}
+
+void WriteJsonString(std::ostream& os, const std::string& str) {
+    os << '"';
+    for (char c : str) {
+        switch (c) {
+            case '"':
+                os << "\\\"";
+                break;
+            case '\\':
+                os << "\\\\";
+                break;
+            case '\n':
+                os << "\\n";
+                break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+                } else {
+                    os << c;
+                }
+        }
+    }
+    os << '"';
+}
+
+// Activates a profiler if the environment variable CHAINERX_PROFILE is set, and writes its trace to the specified file at exit.
+class EnvironmentProfiler {
+public:
+    EnvironmentProfiler() {
+        const char* path = std::getenv("CHAINERX_PROFILE");
+        if (path == nullptr || *path == '\0') {
+            return;
+        }
+        path_ = path;
+        profiler_ = std::make_unique<Profiler>();
+        std::lock_guard<std::mutex> lock{g_profiler_mutex};
+        g_active_profiler = profiler_.get();
+    }
+
+    EnvironmentProfiler(const EnvironmentProfiler&) = delete;
+    EnvironmentProfiler(EnvironmentProfiler&&) = delete;
+    EnvironmentProfiler& operator=(const EnvironmentProfiler&) = delete;
+    EnvironmentProfiler& operator=(EnvironmentProfiler&&) = delete;
+
+    ~EnvironmentProfiler() {
+        if (profiler_ == nullptr) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock{g_profiler_mutex};
+            Profiler* expected = profiler_.get();
+            g_active_profiler.compare_exchange_strong(expected, nullptr);
+        }
+        try {
+            profiler_->WriteChromeTrace(path_);
+        } catch (const ChainerxError& e) {
+            std::cerr << "Failed to write the ChainerX profile: " << e.what() << std::endl;
+        }
+        // The ranges still running at exit, e.g. in worker threads, are not waited for. The profiler is leaked for them instead.
+        profiler_.release();
+    }
+
+private:
+    std::string path_;
+    std::unique_ptr<Profiler> profiler_;
+};
+
+EnvironmentProfiler g_environment_profiler{};
+
+}  // namespace
+
+Profiler::Profiler() : start_time_{std::chrono::steady_clock::now()} {}
+
+std::vector<ProfileEvent> Profiler::events() const {
+    std::lock_guard<std::mutex> lock{mutex_};
+    return events_;
+}
+
+void Profiler::Clear() {
+    std::lock_guard<std::mutex> lock{mutex_};
+    events_.clear();
+}
+
+void Profiler::WriteChromeTrace(std::ostream& os) const {
+    std::vector<ProfileEvent> events = this->events();
+
+    // Timestamps are in microseconds.
+    os << "{\"traceEvents\":[";
+    for (auto it = events.begin(); it != events.end(); ++it) {
+        const ProfileEvent& event = *it;
+        if (it != events.begin()) {
+            os << ",";
+        }
+        os << "\n{\"name\":";
+        WriteJsonString(os, event.name);
+        os << ",\"cat\":";
+        WriteJsonString(os, event.category);
+        os << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.thread_id;
+        os << std::fixed << std::setprecision(3) << ",\"ts\":" << event.start_ns / 1000.0 << ",\"dur\":" << event.duration_ns / 1000.0;
+        os.unsetf(std::ios_base::floatfield);
+
+        std::string input_shapes{"["};
+        for (auto shape_it = event.input_shapes.begin(); shape_it != event.input_shapes.end(); ++shape_it) {
+            if (shape_it != event.input_shapes.begin()) {
+                input_shapes += ", ";
+            }
+            input_shapes += shape_it->ToString();
+        }
+        input_shapes += "]";
+        os << ",\"args\":{\"input_shapes\":";
+        WriteJsonString(os, input_shapes);
+        os << ",\"allocated_bytes\":" << event.allocated_bytes << "}}";
+    }
+    os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+}
+
+void Profiler::WriteChromeTrace(const std::string& path) const {
+    std::ofstream ofs{path};
+    if (!ofs) {
+        throw ChainerxError{"Failed to open the profile output file: ", path};
+    }
+    WriteChromeTrace(ofs);
+    ofs.close();
+    if (!ofs) {
+        throw ChainerxError{"Failed to write the profile output file: ", path};
+    }
+}
+
+int64_t Profiler::NowNs() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_time_).count();
+}
+
+void Profiler::AddEvent(ProfileEvent event) {
+    std::lock_guard<std::mutex> lock{mutex_};
+    events_.emplace_back(std::move(event));
+}
+
+ProfilerScope::ProfilerScope(Profiler& profiler) {
+    std::lock_guard<std::mutex> lock{g_profiler_mutex};
+    orig_profiler_ = g_active_profiler.exchange(&profiler);
+}
+
+ProfilerScope::~ProfilerScope() {
+    std::unique_lock<std::mutex> lock{g_profiler_mutex};
+    Profiler* profiler = g_active_profiler.exchange(orig_profiler_);
+    if (profiler != nullptr && profiler != orig_profiler_) {
+        g_profiler_released.wait(lock, [profiler]() { return profiler->ref_count_ == 0; });
+    }
+}
+
+namespace internal {
+
+ProfilerRef::ProfilerRef(Profiler* profiler) : profiler_{profiler} {
+    if (profiler_ != nullptr) {
+        ++profiler_->ref_count_;
+    }
+}
+
+ProfilerRef::ProfilerRef(const ProfilerRef& other) : profiler_{other.profiler_} {
+    if (profiler_ != nullptr) {
+        std::lock_guard<std::mutex> lock{g_profiler_mutex};
+        ++profiler_->ref_count_;
+    }
+}
+
+void ProfilerRef::Release() {
+    std::lock_guard<std::mutex> lock{g_profiler_mutex};
+    if (--profiler_->ref_count_ == 0) {
+        g_profiler_released.notify_all();
+    }
+}
+
+ProfilerRef AcquireActiveProfiler() {
+    if (g_active_profiler.load(std::memory_order_relaxed) == nullptr) {
+        return ProfilerRef{};
+    }
+    std::lock_guard<std::mutex> lock{g_profiler_mutex};
+    return ProfilerRef{g_active_profiler.load(std::memory_order_relaxed)};
+}
+
+}  // namespace internal
+
+ProfileRange::ProfileRange(const char* category, const char* name, std::initializer_list<ConstArrayRef> inputs)
+    : profiler_{internal::AcquireActiveProfiler()} {
+    Start(category, name, inputs);
+}
+
+ProfileRange::ProfileRange(internal::ProfilerRef profiler, const char* category, const char* name) : profiler_{std::move(profiler)} {
+    Start(category, name, {});
+}
+
+void ProfileRange::Start(const char* category, const char* name, std::initializer_list<ConstArrayRef> inputs) {
+    if (profiler_.get() == nullptr) {
+        return;
+    }
+    event_ = std::make_unique<ProfileEvent>();
+    event_->category = category;
+    event_->name = name;
+    event_->thread_id = GetThreadId();
+    event_->input_shapes.reserve(inputs.size());
+    for (const Array& input : inputs) {
+        event_->input_shapes.emplace_back(input.shape());
+    }
+
+    parent_ = t_current_range;
+    t_current_range = this;
+
+    // Measure the start time last so that the setup above is excluded.
+    event_->start_ns = profiler_.get()->NowNs();
+}
+
+ProfileRange::~ProfileRange() {
+    Profiler* profiler = profiler_.get();
+    if (profiler == nullptr) {
+        return;
+    }
+    event_->duration_ns = profiler->NowNs() - event_->start_ns;
+    t_current_range = parent_;
+    profiler->AddEvent(std::move(*event_));
+}
+
+void ProfileRange::AddInputShape(const Shape& shape) {
+    CHAINERX_ASSERT(is_active());
+    event_->input_shapes.emplace_back(shape);
+}
+
+void ProfileRange::RecordAllocation(size_t bytesize) {
+    for (ProfileRange* range = t_current_range; range != nullptr; range = range->parent_) {
+        range->event_->allocated_bytes += static_cast<int64_t>(bytesize);
+    }
+}
+
+namespace internal {
+
+Profiler* GetActiveProfiler() { return g_active_profiler; }
+
+}  // namespace internal
+}  // namespace chainerx
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "chainerx/array_fwd.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+
+namespace internal {
+
+class ProfilerRef;
+
+}  // namespace internal
+
+// A time range recorded by Profiler.
+struct ProfileEvent {
+    // Category of the event, e.g. "routine" or "backward".
+    std::string category;
+
+    std::string name;
+
+    // Start time in nanoseconds, relative to the construction of the profiler.
+    int64_t start_ns{};
+
+    int64_t duration_ns{};
+
+    // Sequential ID of the thread in which the event is recorded.
+    int64_t thread_id{};
+
+    std::vector<Shape> input_shapes;
+
+    // Total bytes allocated on devices within the range, including nested ranges.
+    int64_t allocated_bytes{};
+};
+
+// Records the routines, kernels and backward functions executed in all threads while the profiler is active.
+//
+// A profiler is activated with ProfilerScope, or at startup by setting the environment variable CHAINERX_PROFILE to the path of a file
+// to which the Chrome trace is written at exit.
+//
+// Kernels of the native device are recorded in the thread executing them, i.e. in the worker thread of the device in the asynchronous
+// mode. Kernels of the CUDA device are recorded in the calling thread and only cover their launches. Convolution, pooling and batch
+// normalization kernels are recorded in the calling thread on any device, enclosing the ranges of the kernels they call.
+class Profiler {
+public:
+    Profiler();
+
+    Profiler(const Profiler&) = delete;
+    Profiler(Profiler&&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+    Profiler& operator=(Profiler&&) = delete;
+
+    ~Profiler() = default;
+
+    // Returns a copy of the events in the order of their completion.
+    std::vector<ProfileEvent> events() const;
+
+    void Clear();
+
+    // Writes the events in the Chrome trace event format, which can be opened with chrome://tracing or Perfetto.
+    void WriteChromeTrace(std::ostream& os) const;
+
+    // Writes the Chrome trace to a file.
+    // ChainerxError is thrown if the file cannot be written.
+    void WriteChromeTrace(const std::string& path) const;
+
+private:
+    friend class ProfileRange;
+    friend class ProfilerScope;
+    friend class internal::ProfilerRef;
+
+    int64_t NowNs() const;
+
+    void AddEvent(ProfileEvent event);
+
+    std::chrono::steady_clock::time_point start_time_;
+
+    mutable std::mutex mutex_;
+    std::vector<ProfileEvent> events_;
+
+    // Number of ProfilerRef instances referring to this profiler, guarded by the global mutex of the active profiler.
+    int64_t ref_count_{0};
+};
+
+// Makes a profiler active in all threads within the scope.
+//
+// On destruction, waits until all the ranges recorded by the profiler are finished in any thread, including the kernels enqueued to
+// asynchronous devices while the profiler was active, so that the profiler can be destroyed right after the scope.
+class ProfilerScope {
+public:
+    explicit ProfilerScope(Profiler& profiler);
+
+    ProfilerScope(const ProfilerScope&) = delete;
+    ProfilerScope(ProfilerScope&&) = delete;
+    ProfilerScope& operator=(const ProfilerScope&) = delete;
+    ProfilerScope& operator=(ProfilerScope&&) = delete;
+
+    ~ProfilerScope();
+
+private:
+    Profiler* orig_profiler_;
+};
+
+namespace internal {
+
+// A counted reference to a profiler, which defers the end of the ProfilerScope activating it until released.
+class ProfilerRef {
+public:
+    ProfilerRef() = default;
+
+    ProfilerRef(const ProfilerRef& other);
+    ProfilerRef(ProfilerRef&& other) noexcept : profiler_{other.profiler_} { other.profiler_ = nullptr; }
+    ProfilerRef& operator=(const ProfilerRef&) = delete;
+    ProfilerRef& operator=(ProfilerRef&&) = delete;
+
+    ~ProfilerRef() {
+        if (profiler_ != nullptr) {
+            Release();
+        }
+    }
+
+    Profiler* get() const { return profiler_; }
+
+private:
+    friend ProfilerRef AcquireActiveProfiler();
+
+    // Must be called with the global mutex of the active profiler locked.
+    explicit ProfilerRef(Profiler* profiler);
+
+    void Release();
+
+    Profiler* profiler_{nullptr};
+};
+
+// Returns a reference to the active profiler, or a null reference if none is active.
+// Only a single atomic load is made if no profiler is active.
+ProfilerRef AcquireActiveProfiler();
+
+}  // namespace internal
+
+// Records an event covering the lifetime of this object, if a profiler is active on construction.
+// Only a single atomic load is made if no profiler is active.
+//
+// Ranges must be nested within each thread, which is naturally satisfied by local variables.
+// A range must not outlive the ProfilerScope which activated its profiler in the same thread, since the scope waits for the range.
+class ProfileRange {
+public:
+    ProfileRange(const char* category, const char* name) : ProfileRange{category, name, std::initializer_list<ConstArrayRef>{}} {}
+    ProfileRange(const char* category, const char* name, std::initializer_list<ConstArrayRef> inputs);
+
+    // Records the event to the given profiler, e.g. the one which was active when a kernel was enqueued, instead of the active one.
+    ProfileRange(internal::ProfilerRef profiler, const char* category, const char* name);
+
+    ProfileRange(const ProfileRange&) = delete;
+    ProfileRange(ProfileRange&&) = delete;
+    ProfileRange& operator=(const ProfileRange&) = delete;
+    ProfileRange& operator=(ProfileRange&&) = delete;
+
+    ~ProfileRange();
+
+    // Returns whether the range is being recorded.
+    bool is_active() const { return profiler_.get() != nullptr; }
+
+    // Adds an input shape to the event. Must be called only if the range is active.
+    void AddInputShape(const Shape& shape);
+
+    // Adds the bytes allocated on a device to all the ranges in the current thread.
+    static void RecordAllocation(size_t bytesize);
+
+private:
+    void Start(const char* category, const char* name, std::initializer_list<ConstArrayRef> inputs);
+
+    internal::ProfilerRef profiler_;
+    std::unique_ptr<ProfileEvent> event_;
+    ProfileRange* parent_{nullptr};
+};
+
+namespace internal {
+
+// Returns the active profiler, or nullptr if none is active.
+Profiler* GetActiveProfiler();
+
+}  // namespace internal
+}  // namespace chainerx
@@ -0,0 +1,252 @@
+#include "chainerx/profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gsl/gsl>
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/backward.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/native/native_device.h"
+#include "chainerx/routines/connection.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/math.h"
+#include "chainerx/routines/normalization.h"
+#include "chainerx/routines/pooling.h"
+#include "chainerx/shape.h"
+#include "chainerx/testing/context_session.h"
+
+namespace chainerx {
+namespace {
+
+const ProfileEvent& FindEvent(const std::vector<ProfileEvent>& events, const std::string& category, const std::string& name) {
+    auto it = std::find_if(
+            events.begin(), events.end(), [&](const ProfileEvent& event) { return event.category == category && event.name == name; });
+    if (it == events.end()) {
+        throw ChainerxError{"Event not found: ", category, " ", name};
+    }
+    return *it;
+}
+
+TEST(ProfilerTest, Inactive) {
+    testing::ContextSession context_session;
+    Profiler profiler{};
+    ASSERT_EQ(nullptr, internal::GetActiveProfiler());
+
+    ProfileRange range{"user", "range"};
+    EXPECT_FALSE(range.is_active());
+    Array a = Ones({2, 3}, Dtype::kFloat32);
+    Array b = a + a;
+    EXPECT_TRUE(profiler.events().empty());
+}
+
+TEST(ProfilerTest, RoutinesAndBackward) {
+    testing::ContextSession context_session;
+    Profiler profiler{};
+    {
+        ProfilerScope scope{profiler};
+        EXPECT_EQ(&profiler, internal::GetActiveProfiler());
+
+        Array x = Ones({2, 3}, Dtype::kFloat32).RequireGrad();
+        Array y = Ones({2, 3}, Dtype::kFloat32);
+        Array z = Copy(x * y);
+        Backward(z);
+    }
+    EXPECT_EQ(nullptr, internal::GetActiveProfiler());
+
+    std::vector<ProfileEvent> events = profiler.events();
+
+    const ProfileEvent& multiply = FindEvent(events, "routine", "multiply");
+    EXPECT_EQ((std::vector<Shape>{{2, 3}, {2, 3}}), multiply.input_shapes);
+    EXPECT_LE(0, multiply.duration_ns);
+
+    // The output is allocated within the range.
+    const ProfileEvent& copy = FindEvent(events, "routine", "copy");
+    EXPECT_EQ(int64_t{2 * 3 * sizeof(float)}, copy.allocated_bytes);
+
+    const ProfileEvent& multiply_backward = FindEvent(events, "backward", "multiply");
+    EXPECT_EQ((std::vector<Shape>{{2, 3}}), multiply_backward.input_shapes);
+    EXPECT_LE(multiply.start_ns + multiply.duration_ns, multiply_backward.start_ns);
+    FindEvent(events, "backward", "copy");
+}
+
+TEST(ProfilerTest, OutputAllocation) {
+    testing::ContextSession context_session;
+    Profiler profiler{};
+    {
+        ProfilerScope scope{profiler};
+        Array a = Ones({2, 3}, Dtype::kFloat32);
+        Array b = a + a;
+    }
+
+    // Routines allocate their outputs within their ranges.
+    const ProfileEvent& add = FindEvent(profiler.events(), "routine", "add");
+    EXPECT_EQ(int64_t{2 * 3 * sizeof(float)}, add.allocated_bytes);
+}
+
+TEST(ProfilerTest, NativeKernels) {
+    testing::ContextSession context_session;
+    auto& device = dynamic_cast<native::NativeDevice&>(GetDefaultDevice());
+    bool orig_async = device.is_async();
+    auto restore_async = gsl::finally([&device, orig_async]() { device.SetAsync(orig_async); });
+
+    for (bool async : {false, true}) {
+        device.SetAsync(async);
+        Profiler profiler{};
+        {
+            ProfilerScope scope{profiler};
+            Array a = Ones({2, 3}, Dtype::kFloat32);
+            Array b = a + a;
+            device.Synchronize();
+        }
+
+        std::vector<ProfileEvent> events = profiler.events();
+        const ProfileEvent& kernel = FindEvent(events, "kernel", "Add");
+        const ProfileEvent& routine = FindEvent(events, "routine", "add");
+        EXPECT_EQ(1, std::count_if(events.begin(), events.end(), [](const ProfileEvent& event) {
+                      return event.category == "kernel" && event.name == "Add";
+                  }));
+        if (async) {
+            // The kernel runs in the worker thread of the device.
+            EXPECT_NE(routine.thread_id, kernel.thread_id);
+        } else {
+            EXPECT_EQ(routine.thread_id, kernel.thread_id);
+            EXPECT_LE(routine.start_ns, kernel.start_ns);
+            EXPECT_LE(kernel.start_ns + kernel.duration_ns, routine.start_ns + routine.duration_ns);
+        }
+    }
+}
+
+TEST(ProfilerTest, ScopeWaitsForAsyncKernels) {
+    testing::ContextSession context_session;
+    auto& device = dynamic_cast<native::NativeDevice&>(GetDefaultDevice());
+    bool orig_async = device.is_async();
+    auto restore_async = gsl::finally([&device, orig_async]() { device.SetAsync(orig_async); });
+    device.SetAsync(true);
+
+    // Blocks the worker thread until the scope ends, or for a while if the scope waits for the kernels.
+    std::promise<void> release_promise{};
+    std::shared_future<void> release = release_promise.get_future().share();
+    device.Launch([release]() { release.wait_for(std::chrono::milliseconds{100}); });
+
+    constexpr int64_t kKernelCount = 10;
+    auto profiler = std::make_unique<Profiler>();
+    Array a = Ones({2, 3}, Dtype::kFloat32);
+    {
+        ProfilerScope scope{*profiler};
+        for (int64_t i = 0; i < kKernelCount; ++i) {
+            a = a + a;
+        }
+    }
+    release_promise.set_value();
+
+    // The kernels enqueued within the scope are all recorded without synchronizing the device, and the profiler can be destroyed.
+    std::vector<ProfileEvent> events = profiler->events();
+    profiler.reset();
+    EXPECT_EQ(kKernelCount, std::count_if(events.begin(), events.end(), [](const ProfileEvent& event) {
+                  return event.category == "kernel" && event.name == "Add";
+              }));
+    device.Synchronize();
+}
+
+TEST(ProfilerTest, ConvPoolingAndBatchNormKernels) {
+    testing::ContextSession context_session;
+    Profiler profiler{};
+    {
+        ProfilerScope scope{profiler};
+        Array x = Ones({2, 3, 4, 4}, Dtype::kFloat32).RequireGrad();
+        Array w = Ones({2, 3, 3, 3}, Dtype::kFloat32).RequireGrad();
+        Array h = MaxPool(Conv(x, w, nonstd::nullopt, {1, 1}, {1, 1}), {2, 2}, {2, 2}, {0, 0});
+        Array gamma = Ones({2, 2, 2}, Dtype::kFloat32);
+        Array beta = Zeros({2, 2, 2}, Dtype::kFloat32);
+        Array running_mean = Zeros({2, 2, 2}, Dtype::kFloat32);
+        Array running_var = Ones({2, 2, 2}, Dtype::kFloat32);
+        Backward(Sum(BatchNorm(h, gamma, beta, running_mean, running_var)));
+    }
+
+    std::vector<ProfileEvent> events = profiler.events();
+    const ProfileEvent& conv = FindEvent(events, "kernel", "Conv");
+    const ProfileEvent& conv_routine = FindEvent(events, "routine", "conv");
+    EXPECT_EQ(conv_routine.thread_id, conv.thread_id);
+    EXPECT_LE(conv_routine.start_ns, conv.start_ns);
+    EXPECT_LE(conv.start_ns + conv.duration_ns, conv_routine.start_ns + conv_routine.duration_ns);
+    for (const char* name :
+         {"MaxPoolForward", "BatchNormForward", "BatchNormBackward", "MaxPoolBackward", "ConvTranspose", "ConvGradWeight"}) {
+        FindEvent(events, "kernel", name);
+    }
+}
+
+TEST(ProfilerTest, NestedRanges) {
+    testing::ContextSession context_session;
+    Profiler profiler{};
+    ProfilerScope scope{profiler};
+    {
+        ProfileRange outer{"user", "outer"};
+        EXPECT_TRUE(outer.is_active());
+        {
+            ProfileRange inner{"user", "inner"};
+            ProfileRange::RecordAllocation(10);
+        }
+        ProfileRange::RecordAllocation(5);
+    }
+    ProfileRange::RecordAllocation(100);
+
+    std::vector<ProfileEvent> events = profiler.events();
+    ASSERT_EQ(size_t{2}, events.size());
+    const ProfileEvent& inner = events[0];
+    const ProfileEvent& outer = events[1];
+    EXPECT_EQ("inner", inner.name);
+    EXPECT_EQ("outer", outer.name);
+    EXPECT_EQ(10, inner.allocated_bytes);
+    EXPECT_EQ(15, outer.allocated_bytes);
+    EXPECT_LE(outer.start_ns, inner.start_ns);
+    EXPECT_LE(inner.start_ns + inner.duration_ns, outer.start_ns + outer.duration_ns);
+
+    profiler.Clear();
+    EXPECT_TRUE(profiler.events().empty());
+}
+
+TEST(ProfilerTest, MultipleThreads) {
+    Profiler profiler{};
+    ProfilerScope scope{profiler};
+    { ProfileRange range{"user", "main"}; }
+    std::thread thread{[]() { ProfileRange range{"user", "worker"}; }};
+    thread.join();
+
+    std::vector<ProfileEvent> events = profiler.events();
+    ASSERT_EQ(size_t{2}, events.size());
+    EXPECT_NE(FindEvent(events, "user", "main").thread_id, FindEvent(events, "user", "worker").thread_id);
+}
+
+TEST(ProfilerTest, WriteChromeTrace) {
+    testing::ContextSession context_session;
+    Profiler profiler{};
+    {
+        ProfilerScope scope{profiler};
+        Array a = Ones({2, 3}, Dtype::kFloat32);
+        ProfileRange range{"user", "quote\"d", {a}};
+    }
+
+    std::ostringstream os;
+    profiler.WriteChromeTrace(os);
+    std::string trace = os.str();
+    EXPECT_EQ(0U, trace.find("{\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"quote\\\"d\",\"cat\":\"user\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, trace.find("\"args\":{\"input_shapes\":\"[(2, 3)]\",\"allocated_bytes\":0}"));
+
+    EXPECT_THROW(profiler.WriteChromeTrace("/nonexistent-directory/trace.json"), ChainerxError);
+}
+
+}  // namespace
+}  // namespace chainerx
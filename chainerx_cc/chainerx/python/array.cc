@@ -3,8 +3,13 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <memory>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 #include <pybind11/operators.h>
@@ -24,10 +29,13 @@
 #include "chainerx/indexable_array.h"
 #include "chainerx/indexer.h"
 #include "chainerx/native/native_backend.h"
+#include "chainerx/native/native_stream.h"
+#include "chainerx/native/shared_memory.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/indexing.h"
 #include "chainerx/routines/manipulation.h"
 #include "chainerx/routines/sorting.h"
+#include "chainerx/scalar.h"
 #include "chainerx/shape.h"
 #include "chainerx/slice.h"
 #include "chainerx/strides.h"
@@ -43,13 +51,34 @@
 namespace chainerx {
 namespace python {
 namespace python_internal {
+
+namespace py = pybind11;
+
 namespace {
 
 using internal::MoveArrayBody;
 
+// Type object of chainerx.ndarray, set on initialization of the module and used for fast type checks.
+PyTypeObject* g_ndarray_type{};
+
+// Type object of numpy.generic, the base of the NumPy scalar types, set on initialization of the module.
+PyTypeObject* g_numpy_generic_type{};
+
+// Returns a pointer to data owned by the given Python object, which is kept alive while the data is referred to.
+std::shared_ptr<void> MakeDataOwnedByPyObject(void* data, py::object owner) {
+    return std::shared_ptr<void>{data, [owner = owner.release()](void*) { CallWithGil([owner]() { owner.dec_ref(); }); }};
+}
+
 }  // namespace
 
-namespace py = pybind11;
+ArrayBodyPtr ToArrayBody(py::handle handle) { return py::cast<ArrayBodyPtr>(handle); }
+
+void CallWithGil(std::function<void()> func) {
+    native::NativeStream::CallOutsideWorkerThread([func = std::move(func)]() {
+        py::gil_scoped_acquire acquire;
+        func();
+    });
+}
 
 ArrayBodyPtr MakeArrayFromNumpyArray(py::array array, Device& device) {
     Shape shape{array.shape(), array.shape() + array.ndim()};
@@ -62,16 +91,210 @@ ArrayBodyPtr MakeArrayFromNumpyArray(py::array array, Device& device) {
     py::buffer_info info = array.request();
 
     // Some backends may perform zero copy, so increment refcount of numpy ndarray not to be released in user codes.
-    // Note that inc_ref() / dec_ref() is performed by the lambda capture.
-    std::shared_ptr<void> data{static_cast<char*>(info.ptr) + first, [array](void*) {}};
+    std::shared_ptr<void> data = MakeDataOwnedByPyObject(static_cast<char*>(info.ptr) + first, array);
 
     return MoveArrayBody(internal::FromHostData(shape, dtype, data, strides, -first, device));
 }
 
 namespace {
 
+// Kinds of Python scalars, in the order of promotion used to infer the dtype of nested sequences.
+enum class PyScalarKind { kBool = 0, kInt, kFloat };
+
+bool IsPySequence(PyObject* ptr) { return PyList_Check(ptr) || PyTuple_Check(ptr); }
+
+// Returns the kind of a Python scalar, or nullopt if the object is not a scalar or is an integer not representable as int64.
+nonstd::optional<PyScalarKind> GetPyScalarKind(PyObject* ptr) {
+    if (PyBool_Check(ptr)) {
+        return PyScalarKind::kBool;
+    }
+    if (PyLong_Check(ptr)) {
+        int overflow{};
+        PyLong_AsLongLongAndOverflow(ptr, &overflow);
+        if (overflow != 0) {
+            return nonstd::nullopt;
+        }
+        return PyScalarKind::kInt;
+    }
+    if (PyFloat_Check(ptr)) {
+        return PyScalarKind::kFloat;
+    }
+    return nonstd::nullopt;
+}
+
+// Checks that the object is a nested sequence of the given shape with scalar leaves and promotes the kind by the leaves.
+bool CheckNestedSequence(PyObject* ptr, const Shape& shape, int8_t depth, nonstd::optional<PyScalarKind>& kind) {
+    if (depth == shape.ndim()) {
+        nonstd::optional<PyScalarKind> leaf_kind = GetPyScalarKind(ptr);
+        if (!leaf_kind.has_value()) {
+            return false;
+        }
+        kind = kind.has_value() ? std::max(*kind, *leaf_kind) : *leaf_kind;
+        return true;
+    }
+    if (!IsPySequence(ptr) || PySequence_Fast_GET_SIZE(ptr) != shape[depth]) {
+        return false;
+    }
+    for (Py_ssize_t i = 0; i < shape[depth]; ++i) {
+        if (!CheckNestedSequence(PySequence_Fast_GET_ITEM(ptr, i), shape, depth + 1, kind)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename T>
+void FillFromNestedSequence(PyObject* ptr, int8_t ndim, T*& out) {
+    if (ndim == 0) {
+        if (PyBool_Check(ptr)) {
+            *out = static_cast<T>(ptr == Py_True);
+        } else if (PyLong_Check(ptr)) {
+            *out = static_cast<T>(PyLong_AsLongLong(ptr));
+        } else {
+            *out = static_cast<T>(PyFloat_AS_DOUBLE(ptr));
+        }
+        ++out;
+        return;
+    }
+    for (Py_ssize_t i = 0; i < PySequence_Fast_GET_SIZE(ptr); ++i) {
+        FillFromNestedSequence(PySequence_Fast_GET_ITEM(ptr, i), ndim - 1, out);
+    }
+}
+
+// Makes an array from a Python scalar or a (nested) list or tuple of Python scalars.
+// Returns nullptr if the object cannot be converted without NumPy, e.g. ragged sequences or sequences of other objects.
+ArrayBodyPtr MakeArrayFromPySequence(py::handle object, py::handle dtype, Device& device) {
+    Shape shape{};
+    for (PyObject* ptr = object.ptr(); IsPySequence(ptr); ptr = PySequence_Fast_GET_ITEM(ptr, 0)) {
+        if (shape.ndim() == kMaxNdim) {
+            return nullptr;
+        }
+        shape.emplace_back(PySequence_Fast_GET_SIZE(ptr));
+        if (shape.back() == 0) {
+            break;
+        }
+    }
+
+    nonstd::optional<PyScalarKind> kind{};
+    if (!CheckNestedSequence(object.ptr(), shape, 0, kind)) {
+        return nullptr;
+    }
+
+    Dtype dtype_{};
+    if (!dtype.is_none()) {
+        dtype_ = GetDtype(dtype);
+    } else {
+        // Follows the dtypes NumPy infers. Empty sequences are float64.
+        switch (kind.value_or(PyScalarKind::kFloat)) {
+            case PyScalarKind::kBool:
+                dtype_ = Dtype::kBool;
+                break;
+            case PyScalarKind::kInt:
+                dtype_ = Dtype::kInt64;
+                break;
+            case PyScalarKind::kFloat:
+                dtype_ = Dtype::kFloat64;
+                break;
+        }
+    }
+
+    std::shared_ptr<void> data = VisitDtype(dtype_, [&object, &shape](auto pt) {
+        using T = typename decltype(pt)::type;
+        std::unique_ptr<T[]> buffer = std::make_unique<T[]>(shape.GetTotalSize());
+        T* out = buffer.get();
+        FillFromNestedSequence(object.ptr(), shape.ndim(), out);
+        return std::shared_ptr<void>{std::move(buffer)};
+    });
+    return MoveArrayBody(FromContiguousHostData(shape, dtype_, data, device));
+}
+
+// Returns the dtype corresponding to a format string of the buffer protocol, or nullopt if it is not supported.
+nonstd::optional<Dtype> GetDtypeFromBufferFormat(const std::string& format, int64_t item_size) {
+    // Only the native byte order is supported.
+    std::string code = format;
+    if (!code.empty() && (code.front() == '@' || code.front() == '=')) {
+        code.erase(0, 1);
+    }
+    if (code.size() != 1) {
+        return nonstd::nullopt;
+    }
+    switch (code.front()) {
+        case '?':
+            return Dtype::kBool;
+        case 'b':
+        case 'h':
+        case 'i':
+        case 'l':
+        case 'q':
+        case 'n':
+            switch (item_size) {
+                case 1:
+                    return Dtype::kInt8;
+                case 2:
+                    return Dtype::kInt16;
+                case 4:
+                    return Dtype::kInt32;
+                case 8:
+                    return Dtype::kInt64;
+                default:
+                    return nonstd::nullopt;
+            }
+        case 'B':
+            return Dtype::kUInt8;
+        case 'f':
+            return Dtype::kFloat32;
+        case 'd':
+            return Dtype::kFloat64;
+        default:
+            return nonstd::nullopt;
+    }
+}
+
+// Makes an array from an object supporting the buffer protocol, including NumPy arrays.
+// The buffer is shared if possible. Returns nullptr if the format of the buffer is not supported.
+ArrayBodyPtr MakeArrayFromPyBuffer(py::handle object, py::handle dtype, bool copy, Device& device) {
+    auto info = std::make_unique<py::buffer_info>(py::reinterpret_borrow<py::buffer>(object).request());
+    nonstd::optional<Dtype> buffer_dtype = GetDtypeFromBufferFormat(info->format, info->itemsize);
+    if (!buffer_dtype.has_value() || info->ndim > kMaxNdim || GetItemSize(*buffer_dtype) != info->itemsize) {
+        return nullptr;
+    }
+
+    Shape shape{info->shape.begin(), info->shape.end()};
+    Strides strides{info->strides.begin(), info->strides.end()};
+    int64_t first{};
+    int64_t last{};
+    std::tie(first, last) = GetDataRange(shape, strides, info->itemsize);
+
+    // The buffer is kept exported, hence not resized or released by the exporter, while it is referred to by any array.
+    void* ptr = static_cast<char*>(info->ptr) + first;
+    std::shared_ptr<void> data{ptr, [info = info.release()](void*) { CallWithGil([info]() { delete info; }); }};
+
+    Array array = internal::FromHostData(shape, *buffer_dtype, data, strides, -first, device);
+    Dtype dtype_ = dtype.is_none() ? array.dtype() : GetDtype(dtype);
+    if (array.dtype() != dtype_) {
+        return MoveArrayBody(array.AsType(dtype_, true));
+    }
+    if (copy) {
+        return MoveArrayBody(array.Copy());
+    }
+    return MoveArrayBody(std::move(array));
+}
+
+// Returns the array itself if it is on a native device, or a copy on the native:0 device otherwise.
+// The returned array is synchronized so that its data can be read in the host.
+Array GetHostAccessibleArray(const ArrayBodyPtr& self) {
+    Array array{self};
+    Device& device = array.device();
+    if (dynamic_cast<native::NativeBackend*>(&device.backend()) == nullptr) {
+        return array.ToNative();
+    }
+    device.Synchronize();
+    return array;
+}
+
+// Makes a NumPy array from an array. Unless copied, the NumPy array shares the buffer of native arrays and keeps the array alive.
 py::array MakeNumpyArrayFromArray(const ArrayBodyPtr& self, bool copy) {
-    Array array = Array{self}.ToNative();
+    Array array = GetHostAccessibleArray(self);
 
     py::dtype dtype{GetDtypeName(array.dtype())};
     const Shape& shape = array.shape();
@@ -84,6 +307,277 @@ py::array MakeNumpyArrayFromArray(const ArrayBodyPtr& self, bool copy) {
     return py::array{dtype, shape, strides, ptr, py::cast(internal::MoveArrayBody(std::move(array)))};
 }
 
+#if PY_VERSION_HEX >= 0x03080000
+// Shared memory objects created by to_shared_memory() are registered with the resource tracker of multiprocessing, which unlinks the
+// objects still left when all the processes sharing the tracker have exited, e.g. those kept by pickled states never unpickled.
+// The objects are unregistered when unlinked by any of the processes. Python older than 3.8 has no tracker for shared memory.
+constexpr const char* kResourceTrackerType = "shared_memory";
+
+void RegisterSharedMemory(const std::string& name) {
+    py::module::import("multiprocessing.resource_tracker").attr("register")(name, kResourceTrackerType);
+}
+
+void UnregisterSharedMemory(const std::string& name) {
+    // Buffers may be released after the interpreter is finalized.
+    if (Py_IsInitialized() == 0) {
+        return;
+    }
+    CallWithGil([name]() {
+        try {
+            py::module::import("multiprocessing.resource_tracker").attr("unregister")(name, kResourceTrackerType);
+        } catch (const py::error_already_set&) {
+            // The tracker will fail to unlink the object, which is harmless.
+        }
+    });
+}
+#endif  // PY_VERSION_HEX >= 0x03080000
+
+// Returns the state of an array for pickling: (device name, dtype name, shape, strides, offset, data).
+// The data is the name of the shared memory object if the array is in shared memory, or the C-contiguous data in bytes otherwise.
+// Arrays are pickled without graphs.
+py::tuple GetArrayState(const ArrayBodyPtr& self) {
+    Array array{self};
+    Device& device = array.device();
+    py::str dtype_name{GetDtypeName(array.dtype())};
+    if (nonstd::optional<std::string> name = native::GetSharedMemoryName(array.data())) {
+        // A reference is added for the receiver. If the state is never unpickled, the object is left to the resource tracker.
+        device.Synchronize();
+        native::RetainSharedMemory(array.data());
+        return py::make_tuple(device.name(), dtype_name, ToTuple(array.shape()), ToTuple(array.strides()), array.offset(), *name);
+    }
+
+    Array native_array = internal::AsContiguous(array.AsGradStopped()).ToNative();
+    py::bytes data{internal::GetRawOffsetData<const char>(native_array), static_cast<size_t>(native_array.GetNBytes())};
+    return py::make_tuple(device.name(), dtype_name, ToTuple(array.shape()), py::none(), 0, data);
+}
+
+ArrayBodyPtr MakeArrayFromState(const py::tuple& state) {
+    if (state.size() != 6) {
+        throw ChainerxError{"Invalid state of ndarray."};
+    }
+    Device& device = GetDefaultContext().GetDevice(state[0].cast<std::string>());
+    Dtype dtype = GetDtype(state[1]);
+    Shape shape = ToShape(state[2].cast<py::tuple>());
+    py::object data = state[5];
+
+    if (py::isinstance<py::str>(data)) {
+        std::shared_ptr<void> shared_data = native::OpenSharedMemory(data.cast<std::string>());
+        Strides strides = ToStrides(state[3].cast<py::tuple>());
+        auto offset = state[4].cast<int64_t>();
+        int64_t first{};
+        int64_t last{};
+        std::tie(first, last) = GetDataRange(shape, strides, GetItemSize(dtype));
+        if (offset + first < 0 || offset + last > static_cast<int64_t>(native::GetSharedMemoryByteSize(shared_data))) {
+            throw ChainerxError{"Invalid state of ndarray: the array exceeds the shared memory."};
+        }
+        return MoveArrayBody(FromData(shape, dtype, shared_data, strides, offset, device));
+    }
+
+    auto bytes = data.cast<py::bytes>();
+    char* buffer{};
+    Py_ssize_t size{};
+    if (PyBytes_AsStringAndSize(bytes.ptr(), &buffer, &size) != 0) {
+        throw py::error_already_set{};
+    }
+    auto nbytes = static_cast<size_t>(shape.GetTotalSize() * GetItemSize(dtype));
+    if (static_cast<size_t>(size) != nbytes) {
+        throw ChainerxError{"Invalid state of ndarray: expected ", nbytes, " bytes but got ", size, " bytes."};
+    }
+    // Python bytes are immutable, hence copied.
+    std::shared_ptr<void> host_data = std::make_unique<uint8_t[]>(nbytes);
+    std::memcpy(host_data.get(), buffer, nbytes);
+    return MoveArrayBody(FromContiguousHostData(shape, dtype, host_data, device));
+}
+
+// Returns the type string of the array interface protocol, e.g. "<f4".
+std::string GetArrayInterfaceTypestr(Dtype dtype) {
+    int64_t item_size = GetItemSize(dtype);
+    char byte_order = '|';
+    if (item_size > 1) {
+        const uint16_t one{1};
+        byte_order = *reinterpret_cast<const uint8_t*>(&one) == 1 ? '<' : '>';  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+    return std::string{byte_order, GetDtypeKindChar(GetKind(dtype))} + std::to_string(item_size);
+}
+
+// Implements the NumPy array interface protocol (version 3) for native arrays.
+py::dict MakeArrayInterface(const ArrayBodyPtr& self) {
+    Array array{self};
+    Device& device = array.device();
+    if (dynamic_cast<native::NativeBackend*>(&device.backend()) == nullptr) {
+        // Lets NumPy fall back to __array__.
+        PyErr_SetString(PyExc_AttributeError, "__array_interface__ is only available for arrays on native devices");
+        throw py::error_already_set{};
+    }
+    device.Synchronize();
+
+    py::dict array_interface{};
+    array_interface["version"] = 3;
+    array_interface["shape"] = ToTuple(array.shape());
+    array_interface["typestr"] = GetArrayInterfaceTypestr(array.dtype());
+    array_interface["strides"] = ToTuple(array.strides());
+    auto ptr = reinterpret_cast<intptr_t>(internal::GetRawOffsetData<void>(array));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    array_interface["data"] = py::make_tuple(ptr, false);
+    return array_interface;
+}
+
+// Format, shape and strides of a buffer exported through the buffer protocol, which are referred to by the Py_buffer until it is
+// released.
+struct ExportedBufferInfo {
+    std::string format;
+    std::vector<Py_ssize_t> shape;
+    std::vector<Py_ssize_t> strides;
+};
+
+bool IsFortranContiguous(const Shape& shape, const Strides& strides, int64_t item_size) {
+    if (shape.GetTotalSize() == 0) {
+        return true;
+    }
+    int64_t expected_stride = item_size;
+    for (int8_t i = 0; i < shape.ndim(); ++i) {
+        if (shape[i] == 1) {
+            continue;
+        }
+        if (strides[i] != expected_stride) {
+            return false;
+        }
+        expected_stride *= shape[i];
+    }
+    return true;
+}
+
+// Implements bf_getbuffer of the buffer protocol for native arrays. Arrays are exported as writable buffers without copying.
+// Replaces the implementation of pybind11, which exports strided buffers even to consumers that require contiguous ones.
+int GetArrayBuffer(PyObject* obj, Py_buffer* view, int flags) {
+    view->obj = nullptr;
+    try {
+        Array array{ToArrayBody(obj)};
+        Device& device = array.device();
+        if (dynamic_cast<native::NativeBackend*>(&device.backend()) == nullptr) {
+            PyErr_SetString(PyExc_BufferError, "Only arrays on native devices support the buffer protocol");
+            return -1;
+        }
+
+        const Shape& shape = array.shape();
+        const Strides& strides = array.strides();
+        int64_t item_size = array.GetItemSize();
+        bool c_contiguous = array.IsContiguous();
+        if (!c_contiguous && ((flags & PyBUF_STRIDES) != PyBUF_STRIDES || (flags & PyBUF_C_CONTIGUOUS) == PyBUF_C_CONTIGUOUS)) {
+            PyErr_SetString(PyExc_BufferError, "ndarray is not C-contiguous");
+            return -1;
+        }
+        if ((flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS && !IsFortranContiguous(shape, strides, item_size)) {
+            PyErr_SetString(PyExc_BufferError, "ndarray is not Fortran contiguous");
+            return -1;
+        }
+        if ((flags & PyBUF_ANY_CONTIGUOUS) == PyBUF_ANY_CONTIGUOUS && !c_contiguous && !IsFortranContiguous(shape, strides, item_size)) {
+            PyErr_SetString(PyExc_BufferError, "ndarray is not contiguous");
+            return -1;
+        }
+
+        device.Synchronize();
+
+        auto info = std::make_unique<ExportedBufferInfo>();
+        info->format = VisitDtype(array.dtype(), [](auto pt) {
+            using T = typename decltype(pt)::type;
+            return py::format_descriptor<T>::format();
+        });
+        info->shape.assign(shape.begin(), shape.end());
+        info->strides.assign(strides.begin(), strides.end());
+
+        view->buf = internal::GetRawOffsetData<void>(array);
+        view->len = static_cast<Py_ssize_t>(shape.GetTotalSize() * item_size);
+        view->readonly = 0;
+        view->itemsize = static_cast<Py_ssize_t>(item_size);
+        view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? &info->format[0] : nullptr;
+        view->ndim = static_cast<int>(shape.ndim());
+        view->shape = (flags & PyBUF_ND) == PyBUF_ND ? info->shape.data() : nullptr;
+        view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? info->strides.data() : nullptr;
+        view->suboffsets = nullptr;
+        view->internal = info.release();
+    } catch (py::error_already_set& e) {
+        e.restore();
+        return -1;
+    } catch (const std::exception& e) {
+        PyErr_SetString(PyExc_BufferError, e.what());
+        return -1;
+    }
+
+    // The Python object keeps the array, hence its data, alive while the buffer is exported.
+    Py_INCREF(obj);
+    view->obj = obj;
+    return 0;
+}
+
+void ReleaseArrayBuffer(PyObject* /*obj*/, Py_buffer* view) { delete static_cast<ExportedBufferInfo*>(view->internal); }
+
+bool IsArray(py::handle handle) { return Py_TYPE(handle.ptr()) == g_ndarray_type || py::isinstance<ArrayBody>(handle); }
+
+// Converts a Python scalar to a Scalar in the same way as the implicit conversion registered for the Scalar class, without calling
+// its constructor from Python.
+nonstd::optional<Scalar> GetScalar(py::handle handle) {
+    PyObject* ptr = handle.ptr();
+    if (PyBool_Check(ptr)) {
+        return Scalar{ptr == Py_True};
+    }
+    if (PyLong_Check(ptr)) {
+        // Integers not representable as int64 raise OverflowError.
+        int64_t value = PyLong_AsLongLong(ptr);
+        if (value == -1 && PyErr_Occurred() != nullptr) {
+            throw py::error_already_set{};
+        }
+        return Scalar{value};
+    }
+    if (PyFloat_Check(ptr)) {
+        return Scalar{PyFloat_AS_DOUBLE(ptr)};
+    }
+    if (py::isinstance<Scalar>(handle)) {
+        return py::cast<Scalar>(handle);
+    }
+    // NumPy scalars other than numpy.float64, e.g. numpy.float32 and numpy.int64, are not Python scalars. They are converted through the
+    // Python scalars of the same kinds.
+    if (PyObject_TypeCheck(ptr, g_numpy_generic_type)) {
+        return GetScalar(handle.attr("item")());
+    }
+    return nonstd::nullopt;
+}
+
+// Dispatches a binary operator by checking the type of the other operand manually, which is much cheaper than the overload resolution
+// of pybind11 for tiny arrays. Returns NotImplemented for unsupported operands so that Python can try the reflected operator.
+template <typename ArrayOp, typename ScalarOp>
+py::object DispatchBinaryOperator(py::handle self, py::handle other, ArrayOp&& array_op, ScalarOp&& scalar_op) {
+    Array self_array{ToArrayBody(self)};
+    if (IsArray(other)) {
+        Array other_array{ToArrayBody(other)};
+        return py::cast(MoveArrayBody(array_op(self_array, other_array)));
+    }
+    if (nonstd::optional<Scalar> other_scalar = GetScalar(other)) {
+        return py::cast(MoveArrayBody(scalar_op(self_array, *other_scalar)));
+    }
+    return py::reinterpret_borrow<py::object>(Py_NotImplemented);
+}
+
+// Defines a binary operator of ndarray taking either an array or a scalar as the other operand.
+template <typename ArrayOp, typename ScalarOp>
+void DefBinaryOperator(py::class_<ArrayBody, ArrayBodyPtr>& c, const char* name, ArrayOp array_op, ScalarOp scalar_op) {
+    c.def(name,
+          [array_op, scalar_op](py::handle self, py::handle other) { return DispatchBinaryOperator(self, other, array_op, scalar_op); },
+          py::is_operator());
+}
+
+// Defines a reflected binary operator of ndarray, which is only called with a scalar as the other operand.
+template <typename ScalarOp>
+void DefReflectedBinaryOperator(py::class_<ArrayBody, ArrayBodyPtr>& c, const char* name, ScalarOp scalar_op) {
+    c.def(name,
+          [scalar_op](py::handle self, py::handle other) -> py::object {
+              if (nonstd::optional<Scalar> other_scalar = GetScalar(other)) {
+                  return py::cast(MoveArrayBody(scalar_op(*other_scalar, Array{ToArrayBody(self)})));
+              }
+              return py::reinterpret_borrow<py::object>(Py_NotImplemented);
+          },
+          py::is_operator());
+}
+
 }  // namespace
 
 ArrayBodyPtr MakeArray(py::handle object, py::handle dtype, bool copy, py::handle device) {
@@ -107,8 +601,19 @@ ArrayBodyPtr MakeArray(py::handle object, py::handle dtype, bool copy, py::handl
         return MoveArrayBody(a.Copy());
     }
 
-    // Convert object to NumPy array using numpy.array()
-    // TODO(sonots): Remove dependency on numpy
+    // Python scalars, lists and tuples, and objects supporting the buffer protocol are converted without NumPy.
+    // Bytes are left to NumPy since they are not sequences of integers there.
+    if (PyBool_Check(object.ptr()) || PyLong_Check(object.ptr()) || PyFloat_Check(object.ptr()) || IsPySequence(object.ptr())) {
+        if (ArrayBodyPtr body = MakeArrayFromPySequence(object, dtype, dev)) {
+            return body;
+        }
+    } else if (PyObject_CheckBuffer(object.ptr()) != 0 && !PyBytes_Check(object.ptr())) {
+        if (ArrayBodyPtr body = MakeArrayFromPyBuffer(object, dtype, copy, dev)) {
+            return body;
+        }
+    }
+
+    // Otherwise, convert object to NumPy array using numpy.array()
     py::object array_func = py::module::import("numpy").attr("array");
     py::object dtype_name = py::none();
     if (!dtype.is_none()) {
@@ -122,6 +627,13 @@ ArrayBodyPtr MakeArray(py::handle object, py::handle dtype, bool copy, py::handl
 
 void InitChainerxArray(pybind11::module& m) {
     py::class_<ArrayBody, ArrayBodyPtr> c{m, "ndarray", py::buffer_protocol()};
+    g_ndarray_type = reinterpret_cast<PyTypeObject*>(c.ptr());  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    g_ndarray_type->tp_as_buffer->bf_getbuffer = &GetArrayBuffer;
+    g_ndarray_type->tp_as_buffer->bf_releasebuffer = &ReleaseArrayBuffer;
+    g_numpy_generic_type = reinterpret_cast<PyTypeObject*>(py::module::import("numpy").attr("generic").release().ptr());  // NOLINT
+#if PY_VERSION_HEX >= 0x03080000
+    native::SetSharedMemoryUnlinkHook(&UnregisterSharedMemory);
+#endif  // PY_VERSION_HEX >= 0x03080000
     // TODO(hvy): Support all arguments in the constructor of numpy.ndarray.
     c.def(py::init([](const py::tuple& shape, py::handle dtype, py::handle device) {
               return MoveArrayBody(Empty(ToShape(shape), GetDtype(dtype), GetDevice(device)));
@@ -129,7 +641,40 @@ void InitChainerxArray(pybind11::module& m) {
           py::arg("shape"),
           py::arg("dtype"),
           py::arg("device") = nullptr);
-    m.def("to_numpy", &MakeNumpyArrayFromArray, py::arg("array"), py::arg("copy") = true);
+    m.def("to_numpy", &MakeNumpyArrayFromArray, py::arg("array"), py::arg("copy") = false);
+    c.def("__array__",
+          [](const ArrayBodyPtr& self, py::handle dtype, py::handle copy) -> py::object {
+              py::array np_array = MakeNumpyArrayFromArray(self, !copy.is_none() && copy.cast<bool>());
+              if (dtype.is_none()) {
+                  return std::move(np_array);
+              }
+              return np_array.attr("astype")(dtype, py::arg("copy") = false);
+          },
+          py::arg("dtype") = py::none(),
+          py::arg("copy") = py::none());
+    c.def_property_readonly("__array_interface__", &MakeArrayInterface);
+    c.def(py::pickle(&GetArrayState, &MakeArrayFromState));
+    // Copies do not share the data even if it is in shared memory, unlike unpickled arrays. Graphs are not copied as in pickling.
+    c.def("__copy__", [](const ArrayBodyPtr& self) { return MoveArrayBody(Array{self}.AsGradStopped(CopyKind::kCopy)); });
+    c.def("__deepcopy__", [](const ArrayBodyPtr& self, const py::dict& /*memo*/) {
+        return MoveArrayBody(Array{self}.AsGradStopped(CopyKind::kCopy));
+    });
+    m.def("to_shared_memory",
+          [](const ArrayBodyPtr& self) {
+              Array array{self};
+              Device& device = array.device();
+              if (dynamic_cast<native::NativeBackend*>(&device.backend()) == nullptr) {
+                  throw DeviceError{"Only arrays on native devices can be placed in shared memory: ", device.name()};
+              }
+              std::shared_ptr<void> data = native::AllocateSharedMemory(array.GetNBytes());
+#if PY_VERSION_HEX >= 0x03080000
+              RegisterSharedMemory(*native::GetSharedMemoryName(data));
+#endif  // PY_VERSION_HEX >= 0x03080000
+              Array out = FromData(array.shape(), array.dtype(), data, nonstd::nullopt, 0, device);
+              device.Copy(array, out);
+              return MoveArrayBody(std::move(out));
+          },
+          py::arg("array"));
     // This is currently for internal use (from Chainer) to support CuPy.
     // TODO(niboshi): Remove this once it will be possible to import cupy.ndarray using chx.array / chx.asarray.
     m.def("_fromrawpointer",
@@ -142,8 +687,7 @@ void InitChainerxArray(pybind11::module& m) {
              py::object base) -> ArrayBodyPtr {
               // TODO(niboshi): Expose `base` as `ndarray.base` attribute.
               void* c_ptr = reinterpret_cast<void*>(ptr);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
-              // Note that inc_ref() / dec_ref() is performed by the lambda capture.
-              std::shared_ptr<void> data{c_ptr, [base](void*) {}};
+              std::shared_ptr<void> data = MakeDataOwnedByPyObject(c_ptr, std::move(base));
               return MoveArrayBody(FromData(ToShape(shape), GetDtype(dtype), data, ToStrides(strides), offset, GetDevice(device)));
           });
     c.def("__len__", [](const ArrayBodyPtr& self) -> size_t {
@@ -158,11 +702,17 @@ void InitChainerxArray(pybind11::module& m) {
     c.def("__float__", [](const ArrayBodyPtr& self) -> double { return static_cast<double>(AsScalar(Array{self})); });
     c.def("view", [](const ArrayBodyPtr& self) { return MoveArrayBody(Array{self}.MakeView()); });
     c.def("__repr__", [](const ArrayBodyPtr& self) { return Array{self}.ToString(); });
-    c.def("to_device", [](const ArrayBodyPtr& self, py::handle device) { return MoveArrayBody(Array{self}.ToDevice(GetDevice(device))); });
-    c.def("to_device", [](const ArrayBodyPtr& self, const std::string& backend_name, int index) {
-        Device& device = GetDefaultContext().GetDevice({backend_name, index});
-        return MoveArrayBody(Array{self}.ToDevice(device));
+    c.def("to_device", [](const ArrayBodyPtr& self, py::handle device) {
+        Device& dst_device = GetDevice(device);
+        py::gil_scoped_release release;
+        return MoveArrayBody(Array{self}.ToDevice(dst_device));
     });
+    c.def("to_device",
+          [](const ArrayBodyPtr& self, const std::string& backend_name, int index) {
+              Device& device = GetDefaultContext().GetDevice({backend_name, index});
+              return MoveArrayBody(Array{self}.ToDevice(device));
+          },
+          py::call_guard<py::gil_scoped_release>());
     c.def("as_grad_stopped",
           [](const ArrayBodyPtr& self, bool copy) {
               return MoveArrayBody(Array{self}.AsGradStopped(copy ? CopyKind::kCopy : CopyKind::kView));
@@ -178,7 +728,7 @@ void InitChainerxArray(pybind11::module& m) {
           [](const ArrayBodyPtr& self, py::handle dtype, bool copy) { return MoveArrayBody(Array{self}.AsType(GetDtype(dtype), copy)); },
           py::arg("dtype"),
           py::arg("copy") = true);
-    c.def("copy", [](const ArrayBodyPtr& self) { return MoveArrayBody(Array{self}.Copy()); });
+    c.def("copy", [](const ArrayBodyPtr& self) { return MoveArrayBody(Array{self}.Copy()); }, py::call_guard<py::gil_scoped_release>());
     c.def("__getitem__", [](const ArrayBodyPtr& self, py::handle key) { return MoveArrayBody(Array{self}.At(MakeArrayIndices(key))); });
     c.def("take",
           [](const ArrayBodyPtr& self, const ArrayBodyPtr& indices, const nonstd::optional<int8_t>& axis) {
@@ -211,112 +761,113 @@ void InitChainerxArray(pybind11::module& m) {
           },
           py::arg("axis") = nullptr);
     c.def("squeeze", [](const ArrayBodyPtr& self, int8_t axis) { return MoveArrayBody(Array{self}.Squeeze(Axes{axis})); }, py::arg("axis"));
-    c.def("__eq__",
-          [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(Array{self} == Array{rhs}); },
-          py::is_operator());
-    c.def("__eq__",
-          [](const ArrayBodyPtr& self, Scalar rhs) {
-              // TODO(niboshi): More efficient implementation
-              Array self_array{self};
-              return MoveArrayBody(self_array == FullLike(self_array, rhs, self->device()));
-          },
-          py::is_operator());
-    c.def("__ne__",
-          [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(Array{self} != Array{rhs}); },
-          py::is_operator());
-    c.def("__ne__",
-          [](const ArrayBodyPtr& self, Scalar rhs) {
-              // TODO(niboshi): More efficient implementation
-              Array self_array{self};
-              return MoveArrayBody(self_array != FullLike(self_array, rhs, self->device()));
-          },
-          py::is_operator());
-    c.def("__gt__",
-          [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(Array{self} > Array{rhs}); },
-          py::is_operator());
-    c.def("__gt__",
-          [](const ArrayBodyPtr& self, Scalar rhs) {
-              // TODO(niboshi): More efficient implementation
-              Array self_array{self};
-              return MoveArrayBody(self_array > FullLike(self_array, rhs, self->device()));
-          },
-          py::is_operator());
-    c.def("__ge__",
-          [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(Array{self} >= Array{rhs}); },
-          py::is_operator());
-    c.def("__lt__",
-          [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(Array{self} < Array{rhs}); },
-          py::is_operator());
-    c.def("__lt__",
-          [](const ArrayBodyPtr& self, Scalar rhs) {
-              // TODO(niboshi): More efficient implementation
-              Array self_array{self};
-              return MoveArrayBody(self_array < FullLike(self_array, rhs, self->device()));
-          },
-          py::is_operator());
-    c.def("__le__",
-          [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(Array{self} <= Array{rhs}); },
-          py::is_operator());
-    c.def("__neg__", [](const ArrayBodyPtr& self) { return MoveArrayBody(-Array{self}); });
-    c.def("__iadd__",
-          [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(std::move(Array{self} += Array{rhs})); },
-          py::is_operator());
-    c.def("__iadd__", [](const ArrayBodyPtr& self, Scalar rhs) { return MoveArrayBody(std::move(Array{self} += rhs)); }, py::is_operator());
-    c.def("__isub__",
-          [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(std::move(Array{self} -= Array{rhs})); },
-          py::is_operator());
-    c.def("__isub__", [](const ArrayBodyPtr& self, Scalar rhs) { return MoveArrayBody(std::move(Array{self} -= rhs)); }, py::is_operator());
-    c.def("__imul__",
-          [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(std::move(Array{self} *= Array{rhs})); },
-          py::is_operator());
-    c.def("__imul__", [](const ArrayBodyPtr& self, Scalar rhs) { return MoveArrayBody(std::move(Array{self} *= rhs)); }, py::is_operator());
-    c.def("__itruediv__",
-          [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(std::move(Array{self} /= Array{rhs})); },
-          py::is_operator());
-    c.def("__itruediv__", [](const ArrayBodyPtr& self, Scalar rhs) { return MoveArrayBody(std::move(Array{self} /= rhs)); });
-    c.def("__add__",
-          [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(Array{self} + Array{rhs}); },
-          py::is_operator());
-    c.def("__add__", [](const ArrayBodyPtr& self, Scalar rhs) { return MoveArrayBody(Array{self} + rhs); }, py::is_operator());
-    c.def("__radd__", [](const ArrayBodyPtr& self, Scalar lhs) { return MoveArrayBody(lhs + Array{self}); }, py::is_operator());
-    c.def("__sub__",
-          [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(Array{self} - Array{rhs}); },
-          py::is_operator());
-    c.def("__sub__", [](const ArrayBodyPtr& self, Scalar rhs) { return MoveArrayBody(Array{self} - rhs); }, py::is_operator());
-    c.def("__rsub__", [](const ArrayBodyPtr& self, Scalar lhs) { return MoveArrayBody(lhs - Array{self}); }, py::is_operator());
-    c.def("__mul__",
-          [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(Array{self} * Array{rhs}); },
-          py::is_operator());
-    c.def("__mul__", [](const ArrayBodyPtr& self, Scalar rhs) { return MoveArrayBody(Array{self} * rhs); }, py::is_operator());
-    c.def("__rmul__", [](const ArrayBodyPtr& self, Scalar lhs) { return MoveArrayBody(lhs * Array{self}); }, py::is_operator());
-    c.def("__truediv__",
-          [](const ArrayBodyPtr& self, const ArrayBodyPtr& rhs) { return MoveArrayBody(Array{self} / Array{rhs}); },
-          py::is_operator());
-    c.def("__truediv__", [](const ArrayBodyPtr& self, Scalar rhs) { return MoveArrayBody(Array{self} / rhs); }, py::is_operator());
+    // TODO(niboshi): More efficient implementation of comparisons with scalars
+    DefBinaryOperator(
+            c,
+            "__eq__",
+            [](const Array& self, const Array& rhs) { return self == rhs; },
+            [](const Array& self, Scalar rhs) { return self == FullLike(self, rhs, self.device()); });
+    DefBinaryOperator(
+            c,
+            "__ne__",
+            [](const Array& self, const Array& rhs) { return self != rhs; },
+            [](const Array& self, Scalar rhs) { return self != FullLike(self, rhs, self.device()); });
+    DefBinaryOperator(
+            c,
+            "__gt__",
+            [](const Array& self, const Array& rhs) { return self > rhs; },
+            [](const Array& self, Scalar rhs) { return self > FullLike(self, rhs, self.device()); });
+    DefBinaryOperator(
+            c,
+            "__ge__",
+            [](const Array& self, const Array& rhs) { return self >= rhs; },
+            [](const Array& self, Scalar rhs) { return self >= FullLike(self, rhs, self.device()); });
+    DefBinaryOperator(
+            c,
+            "__lt__",
+            [](const Array& self, const Array& rhs) { return self < rhs; },
+            [](const Array& self, Scalar rhs) { return self < FullLike(self, rhs, self.device()); });
+    DefBinaryOperator(
+            c,
+            "__le__",
+            [](const Array& self, const Array& rhs) { return self <= rhs; },
+            [](const Array& self, Scalar rhs) { return self <= FullLike(self, rhs, self.device()); });
+    c.def("__neg__", [](py::handle self) { return MoveArrayBody(-Array{ToArrayBody(self)}); });
+    DefBinaryOperator(
+            c,
+            "__iadd__",
+            [](Array& self, const Array& rhs) { return self += rhs; },
+            [](Array& self, Scalar rhs) { return self += rhs; });
+    DefBinaryOperator(
+            c,
+            "__isub__",
+            [](Array& self, const Array& rhs) { return self -= rhs; },
+            [](Array& self, Scalar rhs) { return self -= rhs; });
+    DefBinaryOperator(
+            c,
+            "__imul__",
+            [](Array& self, const Array& rhs) { return self *= rhs; },
+            [](Array& self, Scalar rhs) { return self *= rhs; });
+    DefBinaryOperator(
+            c,
+            "__itruediv__",
+            [](Array& self, const Array& rhs) { return self /= rhs; },
+            [](Array& self, Scalar rhs) { return self /= rhs; });
+    DefBinaryOperator(
+            c,
+            "__add__",
+            [](const Array& self, const Array& rhs) { return self + rhs; },
+            [](const Array& self, Scalar rhs) { return self + rhs; });
+    DefReflectedBinaryOperator(c, "__radd__", [](Scalar lhs, const Array& self) { return lhs + self; });
+    DefBinaryOperator(
+            c,
+            "__sub__",
+            [](const Array& self, const Array& rhs) { return self - rhs; },
+            [](const Array& self, Scalar rhs) { return self - rhs; });
+    DefReflectedBinaryOperator(c, "__rsub__", [](Scalar lhs, const Array& self) { return lhs - self; });
+    DefBinaryOperator(
+            c,
+            "__mul__",
+            [](const Array& self, const Array& rhs) { return self * rhs; },
+            [](const Array& self, Scalar rhs) { return self * rhs; });
+    DefReflectedBinaryOperator(c, "__rmul__", [](Scalar lhs, const Array& self) { return lhs * self; });
+    DefBinaryOperator(
+            c,
+            "__truediv__",
+            [](const Array& self, const Array& rhs) { return self / rhs; },
+            [](const Array& self, Scalar rhs) { return self / rhs; });
     c.def("sum",
           [](const ArrayBodyPtr& self, int8_t axis, bool keepdims) { return MoveArrayBody(Array{self}.Sum(Axes{axis}, keepdims)); },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("axis"),
           py::arg("keepdims") = false);
     c.def("sum",
           [](const ArrayBodyPtr& self, const nonstd::optional<std::vector<int8_t>>& axis, bool keepdims) {
               return MoveArrayBody(Array{self}.Sum(ToAxes(axis), keepdims));
           },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("axis") = nullptr,
           py::arg("keepdims") = false);
     c.def("max",
           [](const ArrayBodyPtr& self, int8_t axis, bool keepdims) { return MoveArrayBody(Array{self}.Max(Axes{axis}, keepdims)); },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("axis"),
           py::arg("keepdims") = false);
     c.def("max",
           [](const ArrayBodyPtr& self, const nonstd::optional<std::vector<int8_t>>& axis, bool keepdims) {
               return MoveArrayBody(Array{self}.Max(ToAxes(axis), keepdims));
           },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("axis") = nullptr,
           py::arg("keepdims") = false);
     c.def("argmax",
           [](const ArrayBodyPtr& self, const nonstd::optional<int8_t>& axis) { return MoveArrayBody(ArgMax(Array{self}, ToAxes(axis))); },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("axis") = nullptr);
-    c.def("dot", [](const ArrayBodyPtr& self, const ArrayBodyPtr& b) { return MoveArrayBody(Array{self}.Dot(Array{b})); }, py::arg("b"));
+    c.def("dot",
+          [](const ArrayBodyPtr& self, const ArrayBodyPtr& b) { return MoveArrayBody(Array{self}.Dot(Array{b})); },
+          py::call_guard<py::gil_scoped_release>(),
+          py::arg("b"));
     c.def("fill",
           [](const ArrayBodyPtr& self, Scalar value) {
               Array{self}.Fill(value);
@@ -365,6 +916,7 @@ void InitChainerxArray(pybind11::module& m) {
               auto double_backprop = enable_double_backprop ? DoubleBackpropOption::kEnable : DoubleBackpropOption::kDisable;
               Backward(Array{self}, backprop_id, double_backprop);
           },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("backprop_id") = nullptr,
           py::arg("enable_double_backprop") = false);
     c.def("_debug_dump_computational_graph",
@@ -394,7 +946,12 @@ void InitChainerxArray(pybind11::module& m) {
           py::arg("backprop_id") = nullptr);
     c.def_property_readonly(
             "device", [](const ArrayBodyPtr& self) -> Device& { return self->device(); }, py::return_value_policy::reference);
-    c.def_property_readonly("dtype", [m](const ArrayBodyPtr& self) { return GetNumpyDtypeFromModule(m, self->dtype()); });
+    // NumPy dtype objects are looked up once, since dtype is frequently queried, e.g. by type checks in Chainer.
+    std::vector<py::object> numpy_dtypes(static_cast<size_t>(Dtype::kFloat64) + 1);
+    for (Dtype dtype : GetAllDtypes()) {
+        numpy_dtypes[static_cast<size_t>(dtype)] = GetNumpyDtypeFromModule(m, dtype);
+    }
+    c.def_property_readonly("dtype", [numpy_dtypes](const ArrayBodyPtr& self) { return numpy_dtypes[static_cast<size_t>(self->dtype())]; });
     c.def_property_readonly("itemsize", [](const ArrayBodyPtr& self) { return self->GetItemSize(); });
     c.def_property_readonly("is_contiguous", [](const ArrayBodyPtr& self) { return self->IsContiguous(); });
     c.def_property_readonly("ndim", [](const ArrayBodyPtr& self) { return self->ndim(); });
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include <pybind11/numpy.h>
@@ -22,9 +23,18 @@ using ConstArrayBodyPtr = std::shared_ptr<const ArrayBody>;
 
 ArrayBodyPtr MakeArray(pybind11::handle object, pybind11::handle dtype, bool copy, pybind11::handle device);
 
+// Returns the array body of a chainerx.ndarray object. Throws pybind11::cast_error if the object is not an ndarray.
+ArrayBodyPtr ToArrayBody(pybind11::handle handle);
+
 // Makes an array from a NumPy array. Shape, dtype, strides will be kept.
 ArrayBodyPtr MakeArrayFromNumpyArray(pybind11::array array, Device& device);
 
+// Calls the function with the GIL acquired. This is used to release Python objects owning array data, which may be released in a thread
+// without the GIL, e.g. in backward.
+// Calls from a worker thread of an asynchronous native device are deferred to the next thread using the device, since the thread holding
+// the GIL may be waiting for the worker thread.
+void CallWithGil(std::function<void()> func);
+
 void InitChainerxArray(pybind11::module&);
 
 }  // namespace python_internal
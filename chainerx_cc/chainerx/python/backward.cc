@@ -29,6 +29,7 @@ void InitChainerxBackward(pybind11::module& m) {
               auto double_backprop = enable_double_backprop ? DoubleBackpropOption::kEnable : DoubleBackpropOption::kDisable;
               Backward(array, backprop_id, double_backprop);
           },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg(),
           py::arg("backprop_id") = nullptr,
           py::arg("enable_double_backprop") = false);
@@ -42,6 +43,7 @@ void InitChainerxBackward(pybind11::module& m) {
               auto double_backprop = enable_double_backprop ? DoubleBackpropOption::kEnable : DoubleBackpropOption::kDisable;
               Backward({arrays.begin(), arrays.end()}, backprop_id, double_backprop);
           },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg(),
           py::arg("backprop_id") = nullptr,
           py::arg("enable_double_backprop") = false);
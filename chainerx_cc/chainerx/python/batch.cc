@@ -0,0 +1,471 @@
+#include "chainerx/python/batch.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/axes.h"
+#include "chainerx/constant.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/macro.h"
+#include "chainerx/routines/connection.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/linalg.h"
+#include "chainerx/routines/manipulation.h"
+#include "chainerx/routines/math.h"
+#include "chainerx/routines/normalization.h"
+#include "chainerx/routines/pooling.h"
+#include "chainerx/scalar.h"
+#include "chainerx/shape.h"
+#include "chainerx/stack_vector.h"
+
+#include "chainerx/python/array.h"
+#include "chainerx/python/common.h"
+#include "chainerx/python/dtype.h"
+
+namespace chainerx {
+namespace python {
+namespace python_internal {
+
+namespace py = pybind11;
+
+namespace {
+
+using internal::MoveArrayBodies;
+
+// A routine bound to the attributes of an operation. It is called with the input arrays without the GIL.
+using BoundRoutine = std::function<std::vector<Array>(const std::vector<Array>&)>;
+
+// An integer or a tuple of integers given for each spatial dimension, e.g. the stride of convolution.
+// Integers are expanded when the number of dimensions is known, i.e. when the routine is called.
+struct SpatialParam {
+    StackVector<int64_t, kMaxNdim> values;
+    bool expand;
+
+    StackVector<int64_t, kMaxNdim> Get(int8_t ndim) const {
+        if (!expand) {
+            return values;
+        }
+        StackVector<int64_t, kMaxNdim> out;
+        std::fill_n(std::back_inserter(out), ndim, values.front());
+        return out;
+    }
+};
+
+// An operation of a batch being bound to its routine, which gives the number of inputs and the attributes to the binder.
+class OpBinding {
+public:
+    OpBinding(std::string routine, size_t n_args, py::handle attrs)
+        : routine_{std::move(routine)}, n_args_{n_args}, attrs_{attrs.is_none() ? py::dict{} : py::cast<py::dict>(attrs)} {}
+
+    const std::string& routine() const { return routine_; }
+
+    size_t n_args() const { return n_args_; }
+
+    size_t n_outputs() const { return n_outputs_; }
+
+    void set_n_outputs(size_t n_outputs) { n_outputs_ = n_outputs; }
+
+    void CheckArgCount(size_t min_count, size_t max_count) const {
+        if (n_args_ < min_count || n_args_ > max_count) {
+            throw py::type_error{routine_ + "() got an invalid number of inputs: " + std::to_string(n_args_)};
+        }
+    }
+
+    void CheckArgCount(size_t count) const { CheckArgCount(count, count); }
+
+    // Returns the attribute, or nullopt if it is not given or None.
+    template <typename T>
+    nonstd::optional<T> Get(const char* name) {
+        py::handle value = Find(name);
+        if (value.is_none()) {
+            return nonstd::nullopt;
+        }
+        return py::cast<T>(value);
+    }
+
+    template <typename T>
+    T Get(const char* name, T default_value) {
+        return Get<T>(name).value_or(std::move(default_value));
+    }
+
+    template <typename T>
+    T GetRequired(const char* name) {
+        if (nonstd::optional<T> value = Get<T>(name)) {
+            return std::move(*value);
+        }
+        throw py::type_error{routine_ + "() missing required attribute: '" + name + "'"};
+    }
+
+    OptionalAxes GetAxes(const char* name) {
+        py::handle value = Find(name);
+        if (value.is_none()) {
+            return nonstd::nullopt;
+        }
+        if (py::isinstance<py::int_>(value)) {
+            return Axes{py::cast<int8_t>(value)};
+        }
+        auto axes = py::cast<std::vector<int8_t>>(value);
+        return Axes{axes.begin(), axes.end()};
+    }
+
+    Shape GetShape(const char* name) {
+        py::handle value = Find(name);
+        if (value.is_none()) {
+            throw py::type_error{routine_ + "() missing required attribute: '" + name + "'"};
+        }
+        if (py::isinstance<py::int_>(value)) {
+            return Shape{py::cast<int64_t>(value)};
+        }
+        auto shape = py::cast<std::vector<int64_t>>(value);
+        return Shape{shape.begin(), shape.end()};
+    }
+
+    nonstd::optional<SpatialParam> GetSpatialParam(const char* name) {
+        py::handle value = Find(name);
+        if (value.is_none()) {
+            return nonstd::nullopt;
+        }
+        if (py::isinstance<py::int_>(value)) {
+            return SpatialParam{StackVector<int64_t, kMaxNdim>{py::cast<int64_t>(value)}, true};
+        }
+        auto values = py::cast<std::vector<int64_t>>(value);
+        return SpatialParam{StackVector<int64_t, kMaxNdim>{values.begin(), values.end()}, false};
+    }
+
+    SpatialParam GetSpatialParam(const char* name, int64_t default_value) {
+        return GetSpatialParam(name).value_or(SpatialParam{StackVector<int64_t, kMaxNdim>{default_value}, true});
+    }
+
+    // Checks that all the given attributes are consumed by the binder.
+    void CheckUnknownAttrs() const {
+        for (const auto& item : attrs_) {
+            auto name = py::cast<std::string>(item.first);
+            if (std::find(names_.begin(), names_.end(), name) == names_.end()) {
+                throw py::type_error{routine_ + "() got an unexpected attribute '" + name + "'"};
+            }
+        }
+    }
+
+private:
+    py::handle Find(const char* name) {
+        names_.emplace_back(name);
+        PyObject* value = PyDict_GetItemString(attrs_.ptr(), name);
+        return py::handle{value == nullptr ? Py_None : value};
+    }
+
+    std::string routine_;
+    size_t n_args_;
+    py::dict attrs_;
+    size_t n_outputs_{1};
+    std::vector<std::string> names_;
+};
+
+using RoutineBinder = BoundRoutine (*)(OpBinding&);
+
+BoundRoutine BindUnary(OpBinding& op, Array (*func)(const Array&)) {
+    op.CheckArgCount(1);
+    return [func](const std::vector<Array>& xs) { return std::vector<Array>{func(xs[0])}; };
+}
+
+// Binary routines take two inputs, or one input and a scalar given as the attribute x1 or x2.
+BoundRoutine BindBinary(
+        OpBinding& op,
+        Array (*array_array)(const Array&, const Array&),
+        Array (*array_scalar)(const Array&, Scalar),
+        Array (*scalar_array)(Scalar, const Array&)) {
+    op.CheckArgCount(1, array_array == nullptr ? 1 : 2);
+    if (op.n_args() == 2) {
+        return [array_array](const std::vector<Array>& xs) { return std::vector<Array>{array_array(xs[0], xs[1])}; };
+    }
+    nonstd::optional<Scalar> x1 = op.Get<Scalar>("x1");
+    nonstd::optional<Scalar> x2 = op.Get<Scalar>("x2");
+    if (x1.has_value() == x2.has_value()) {
+        throw py::type_error{op.routine() + "() requires either of the attributes 'x1' or 'x2' with one input"};
+    }
+    if (x2.has_value()) {
+        return [array_scalar, x2 = *x2](const std::vector<Array>& xs) { return std::vector<Array>{array_scalar(xs[0], x2)}; };
+    }
+    return [scalar_array, x1 = *x1](const std::vector<Array>& xs) { return std::vector<Array>{scalar_array(x1, xs[0])}; };
+}
+
+// In-place routines update the first input by the second input or the scalar given as the attribute x2, and output the first input.
+BoundRoutine BindInplace(
+        OpBinding& op, const Array& (Array::*array_op)(const Array&) const, const Array& (Array::*scalar_op)(Scalar) const) {
+    op.CheckArgCount(1, 2);
+    if (op.n_args() == 2) {
+        return [array_op](const std::vector<Array>& xs) { return std::vector<Array>{(xs[0].*array_op)(xs[1])}; };
+    }
+    auto x2 = op.GetRequired<Scalar>("x2");
+    return [scalar_op, x2](const std::vector<Array>& xs) { return std::vector<Array>{(xs[0].*scalar_op)(x2)}; };
+}
+
+// Binds a routine taking an array and reduction axes.
+BoundRoutine BindReduction(OpBinding& op, Array (*func)(const Array&, const OptionalAxes&, bool)) {
+    op.CheckArgCount(1);
+    OptionalAxes axis = op.GetAxes("axis");
+    auto keepdims = op.Get<bool>("keepdims", false);
+    return [func, axis, keepdims](const std::vector<Array>& xs) { return std::vector<Array>{func(xs[0], axis, keepdims)}; };
+}
+
+nonstd::optional<Array> GetOptionalArg(const std::vector<Array>& xs, size_t index) {
+    return xs.size() > index ? nonstd::optional<Array>{xs[index]} : nonstd::nullopt;
+}
+
+// Routines available in batches. Their inputs and attributes follow the arguments of the corresponding Python functions.
+const std::unordered_map<std::string, RoutineBinder>& GetRoutineBinders() {
+    static const std::unordered_map<std::string, RoutineBinder> binders{
+            // math
+            {"negative", [](OpBinding& op) { return BindUnary(op, &Negative); }},
+            {"exp", [](OpBinding& op) { return BindUnary(op, &Exp); }},
+            {"log", [](OpBinding& op) { return BindUnary(op, &Log); }},
+            {"sqrt", [](OpBinding& op) { return BindUnary(op, &Sqrt); }},
+            {"tanh", [](OpBinding& op) { return BindUnary(op, &Tanh); }},
+            {"add", [](OpBinding& op) { return BindBinary(op, &Add, &Add, &Add); }},
+            {"subtract", [](OpBinding& op) { return BindBinary(op, &Subtract, &Subtract, &Subtract); }},
+            {"multiply", [](OpBinding& op) { return BindBinary(op, &Multiply, &Multiply, &Multiply); }},
+            {"divide", [](OpBinding& op) { return BindBinary(op, &Divide, &Divide, &Divide); }},
+            {"maximum", [](OpBinding& op) { return BindBinary(op, nullptr, &Maximum, &Maximum); }},
+            {"iadd", [](OpBinding& op) { return BindInplace(op, &Array::operator+=, &Array::operator+=); }},
+            {"isubtract", [](OpBinding& op) { return BindInplace(op, &Array::operator-=, &Array::operator-=); }},
+            {"imultiply", [](OpBinding& op) { return BindInplace(op, &Array::operator*=, &Array::operator*=); }},
+            {"idivide", [](OpBinding& op) { return BindInplace(op, &Array::operator/=, &Array::operator/=); }},
+            {"sum", [](OpBinding& op) { return BindReduction(op, &Sum); }},
+            {"amax", [](OpBinding& op) { return BindReduction(op, &AMax); }},
+            {"logsumexp", [](OpBinding& op) { return BindReduction(op, &LogSumExp); }},
+            {"log_softmax",
+             [](OpBinding& op) -> BoundRoutine {
+                 op.CheckArgCount(1);
+                 OptionalAxes axis = op.GetAxes("axis");
+                 return [axis](const std::vector<Array>& xs) { return std::vector<Array>{LogSoftmax(xs[0], axis)}; };
+             }},
+            // activation
+            {"relu",
+             [](OpBinding& op) -> BoundRoutine {
+                 op.CheckArgCount(1);
+                 return [](const std::vector<Array>& xs) { return std::vector<Array>{Maximum(Scalar{int64_t{0}}, xs[0])}; };
+             }},
+            {"sigmoid",
+             [](OpBinding& op) -> BoundRoutine {
+                 op.CheckArgCount(1);
+                 return [](const std::vector<Array>& xs) {
+                     return std::vector<Array>{Divide(Add(Tanh(Divide(xs[0], Scalar{2.0})), Scalar{1.0}), Scalar{2.0})};
+                 };
+             }},
+            // creation and manipulation
+            {"copy", [](OpBinding& op) { return BindUnary(op, &Copy); }},
+            {"astype",
+             [](OpBinding& op) -> BoundRoutine {
+                 op.CheckArgCount(1);
+                 Dtype dtype = GetDtype(op.GetRequired<py::object>("dtype"));
+                 auto copy = op.Get<bool>("copy", true);
+                 return [dtype, copy](const std::vector<Array>& xs) { return std::vector<Array>{xs[0].AsType(dtype, copy)}; };
+             }},
+            {"reshape",
+             [](OpBinding& op) -> BoundRoutine {
+                 op.CheckArgCount(1);
+                 Shape newshape = op.GetShape("newshape");
+                 return [newshape](const std::vector<Array>& xs) { return std::vector<Array>{Reshape(xs[0], newshape)}; };
+             }},
+            {"transpose",
+             [](OpBinding& op) -> BoundRoutine {
+                 op.CheckArgCount(1);
+                 OptionalAxes axes = op.GetAxes("axes");
+                 return [axes](const std::vector<Array>& xs) { return std::vector<Array>{Transpose(xs[0], axes)}; };
+             }},
+            {"squeeze",
+             [](OpBinding& op) -> BoundRoutine {
+                 op.CheckArgCount(1);
+                 OptionalAxes axis = op.GetAxes("axis");
+                 return [axis](const std::vector<Array>& xs) { return std::vector<Array>{Squeeze(xs[0], axis)}; };
+             }},
+            {"broadcast_to",
+             [](OpBinding& op) -> BoundRoutine {
+                 op.CheckArgCount(1);
+                 Shape shape = op.GetShape("shape");
+                 return [shape](const std::vector<Array>& xs) { return std::vector<Array>{BroadcastTo(xs[0], shape)}; };
+             }},
+            {"concatenate",
+             [](OpBinding& op) -> BoundRoutine {
+                 op.CheckArgCount(1, std::numeric_limits<size_t>::max());
+                 auto axis = op.Get<int8_t>("axis", 0);
+                 return [axis](const std::vector<Array>& xs) { return std::vector<Array>{Concatenate(xs, axis)}; };
+             }},
+            {"stack",
+             [](OpBinding& op) -> BoundRoutine {
+                 op.CheckArgCount(1, std::numeric_limits<size_t>::max());
+                 auto axis = op.Get<int8_t>("axis", 0);
+                 return [axis](const std::vector<Array>& xs) { return std::vector<Array>{Stack(xs, axis)}; };
+             }},
+            {"split",
+             [](OpBinding& op) -> BoundRoutine {
+                 op.CheckArgCount(1);
+                 auto axis = op.Get<int8_t>("axis", 0);
+                 auto indices_or_sections = op.GetRequired<py::object>("indices_or_sections");
+                 if (py::isinstance<py::int_>(indices_or_sections)) {
+                     auto sections = py::cast<int64_t>(indices_or_sections);
+                     op.set_n_outputs(static_cast<size_t>(std::max(sections, int64_t{0})));
+                     return [sections, axis](const std::vector<Array>& xs) { return Split(xs[0], sections, axis); };
+                 }
+                 auto indices = py::cast<std::vector<int64_t>>(indices_or_sections);
+                 op.set_n_outputs(indices.size() + 1);
+                 return [indices, axis](const std::vector<Array>& xs) { return Split(xs[0], indices, axis); };
+             }},
+            // linalg and connection
+            {"dot",
+             [](OpBinding& op) -> BoundRoutine {
+                 op.CheckArgCount(2);
+                 return [](const std::vector<Array>& xs) { return std::vector<Array>{Dot(xs[0], xs[1])}; };
+             }},
+            {"linear",
+             [](OpBinding& op) -> BoundRoutine {
+                 op.CheckArgCount(2, 3);
+                 auto n_batch_axes = op.Get<uint8_t>("n_batch_axes", 1);
+                 return [n_batch_axes](const std::vector<Array>& xs) {
+                     return std::vector<Array>{Linear(xs[0], xs[1], GetOptionalArg(xs, 2), n_batch_axes)};
+                 };
+             }},
+            {"conv",
+             [](OpBinding& op) -> BoundRoutine {
+                 op.CheckArgCount(2, 3);
+                 SpatialParam stride = op.GetSpatialParam("stride", 1);
+                 SpatialParam pad = op.GetSpatialParam("pad", 0);
+                 auto cover_all = op.Get<bool>("cover_all", false);
+                 return [stride, pad, cover_all](const std::vector<Array>& xs) {
+                     int8_t ndim = xs[0].ndim() - 2;
+                     return std::vector<Array>{Conv(xs[0], xs[1], GetOptionalArg(xs, 2), stride.Get(ndim), pad.Get(ndim), cover_all)};
+                 };
+             }},
+            // normalization and pooling
+            {"batch_norm",
+             [](OpBinding& op) -> BoundRoutine {
+                 op.CheckArgCount(5);
+                 auto eps = op.Get<Scalar>("eps", Scalar{2e-5});
+                 auto decay = op.Get<Scalar>("decay", Scalar{0.9});
+                 OptionalAxes axis = op.GetAxes("axis");
+                 return [eps, decay, axis](const std::vector<Array>& xs) {
+                     return std::vector<Array>{BatchNorm(xs[0], xs[1], xs[2], xs[3], xs[4], eps, decay, axis)};
+                 };
+             }},
+            {"max_pool",
+             [](OpBinding& op) -> BoundRoutine {
+                 op.CheckArgCount(1);
+                 nonstd::optional<SpatialParam> ksize = op.GetSpatialParam("ksize");
+                 if (!ksize.has_value()) {
+                     throw py::type_error{"max_pool() missing required attribute: 'ksize'"};
+                 }
+                 SpatialParam stride = op.GetSpatialParam("stride").value_or(*ksize);
+                 SpatialParam pad = op.GetSpatialParam("pad", 0);
+                 auto cover_all = op.Get<bool>("cover_all", false);
+                 return [ksize = *ksize, stride, pad, cover_all](const std::vector<Array>& xs) {
+                     int8_t ndim = xs[0].ndim() - 2;
+                     return std::vector<Array>{MaxPool(xs[0], ksize.Get(ndim), stride.Get(ndim), pad.Get(ndim), cover_all)};
+                 };
+             }},
+    };
+    return binders;
+}
+
+// An operation bound to its routine, with the handles of its inputs and the number of outputs predicted from its arguments.
+struct BoundOp {
+    std::string name;
+    BoundRoutine routine;
+    std::vector<size_t> args;
+    size_t n_outputs;
+};
+
+// Executes a list of operations in a single call.
+//
+// Each operation is a tuple (routine, args, attrs) of the name of a routine, the handles of its inputs and an optional dict of the other
+// arguments of the routine. Handles are indices of the values: the given inputs come first, followed by the outputs of each operation in
+// order. All operations are validated before any of them is executed. They are executed without the GIL, recording the computational
+// graphs as usual.
+//
+// Returns the outputs of all operations, i.e. the values except the given inputs.
+std::vector<ArrayBodyPtr> ExecuteBatch(const py::sequence& ops, const py::sequence& inputs) {
+    const std::unordered_map<std::string, RoutineBinder>& binders = GetRoutineBinders();
+
+    std::vector<Array> values;
+    values.reserve(inputs.size());
+    for (py::handle input : inputs) {
+        values.emplace_back(ToArrayBody(input));
+    }
+    size_t n_inputs = values.size();
+
+    std::vector<BoundOp> bound_ops;
+    bound_ops.reserve(ops.size());
+    size_t n_values = n_inputs;
+    for (py::handle op : ops) {
+        if (!py::isinstance<py::sequence>(op)) {
+            throw py::type_error{"Each operation must be a tuple of (routine, args) or (routine, args, attrs)."};
+        }
+        auto op_tuple = py::reinterpret_borrow<py::sequence>(op);
+        if (op_tuple.size() != 2 && op_tuple.size() != 3) {
+            throw py::value_error{"Each operation must be a tuple of (routine, args) or (routine, args, attrs)."};
+        }
+        auto routine = py::cast<std::string>(op_tuple[0]);
+        auto it = binders.find(routine);
+        if (it == binders.end()) {
+            throw py::value_error{"Unknown routine in batch: " + routine};
+        }
+
+        auto arg_handles = py::cast<std::vector<int64_t>>(op_tuple[1]);
+        std::vector<size_t> args;
+        args.reserve(arg_handles.size());
+        for (int64_t handle : arg_handles) {
+            if (handle < 0 || static_cast<size_t>(handle) >= n_values) {
+                throw py::index_error{routine + "() refers to an undefined handle: " + std::to_string(handle)};
+            }
+            args.emplace_back(static_cast<size_t>(handle));
+        }
+
+        OpBinding binding{routine, args.size(), op_tuple.size() == 3 ? py::object{op_tuple[2]} : py::none()};
+        BoundRoutine bound_routine = it->second(binding);
+        binding.CheckUnknownAttrs();
+        bound_ops.push_back(BoundOp{routine, std::move(bound_routine), std::move(args), binding.n_outputs()});
+        n_values += binding.n_outputs();
+    }
+
+    {
+        py::gil_scoped_release release;
+        values.reserve(n_values);
+        std::vector<Array> args;
+        for (const BoundOp& op : bound_ops) {
+            args.clear();
+            for (size_t handle : op.args) {
+                args.emplace_back(values[handle]);
+            }
+            std::vector<Array> outs = op.routine(args);
+            // The handles of the succeeding operations are resolved with the predicted number of outputs.
+            if (outs.size() != op.n_outputs) {
+                throw DimensionError{op.name, "() returned ", outs.size(), " outputs in batch. Expected: ", op.n_outputs, "."};
+            }
+            for (Array& out : outs) {
+                values.emplace_back(std::move(out));
+            }
+        }
+        CHAINERX_ASSERT(values.size() == n_values);
+    }
+
+    return MoveArrayBodies(std::vector<Array>{std::make_move_iterator(values.begin() + n_inputs), std::make_move_iterator(values.end())});
+}
+
+}  // namespace
+
+void InitChainerxBatch(pybind11::module& m) { m.def("execute_batch", &ExecuteBatch, py::arg("ops"), py::arg("inputs")); }
+
+}  // namespace python_internal
+}  // namespace python
+}  // namespace chainerx
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <pybind11/pybind11.h>
+
+namespace chainerx {
+namespace python {
+namespace python_internal {
+
+void InitChainerxBatch(pybind11::module&);
+
+}  // namespace python_internal
+}  // namespace python
+}  // namespace chainerx
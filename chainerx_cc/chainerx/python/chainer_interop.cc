@@ -16,6 +16,7 @@
 #include "chainerx/backward_builder.h"
 #include "chainerx/backward_context.h"
 
+#include "chainerx/python/array.h"
 #include "chainerx/python/common.h"
 
 namespace chainerx {
@@ -26,6 +27,20 @@ namespace py = pybind11;
 
 using ArrayBodyPtr = std::shared_ptr<internal::ArrayBody>;
 
+namespace {
+
+// Converts a vector to a tuple. Null array bodies are converted to None.
+template <typename T>
+py::tuple ToTuple(const std::vector<T>& values) {
+    py::tuple tuple{values.size()};
+    for (size_t i = 0; i < values.size(); ++i) {
+        tuple[i] = py::cast(values[i]);
+    }
+    return tuple;
+}
+
+}  // namespace
+
 void InitChainerxChainerInterop(pybind11::module& m) {
     m.def("_function_node_forward",
           [](py::object function_node,
@@ -68,10 +83,13 @@ void InitChainerxChainerInterop(pybind11::module& m) {
               // Insert backward function
               BackwardBuilder bb{"chainer_function", std::move(input_array_refs), std::move(output_array_refs)};
               if (BackwardBuilder::Target bt = bb.CreateTarget()) {
-                  auto function_node_ptr = std::make_shared<py::object>(std::move(function_node), [](py::object* ptr) {
-                      py::gil_scoped_acquire acquire;
-                      delete ptr;
-                  });
+                  // The bound method is looked up once here instead of on every backward.
+                  // It is released with the GIL acquired since the op node may be released in a thread without it.
+                  py::object backward_func = function_node.attr("_backward_chainerx");
+                  std::shared_ptr<py::object> backward_func_ptr{new py::object{std::move(backward_func)}, [](py::object* ptr) {
+                                                                    py::gil_scoped_acquire acquire;
+                                                                    delete ptr;
+                                                                }};
 
                   // Retain inputs
                   std::vector<RetainedInputToken> retained_input_tokens;
@@ -91,7 +109,7 @@ void InitChainerxChainerInterop(pybind11::module& m) {
                       }
                   }
 
-                  bt.Define([function_node_ptr = std::move(function_node_ptr),
+                  bt.Define([backward_func_ptr = std::move(backward_func_ptr),
                              output_index_map = std::move(output_index_map),
                              in_toks = std::move(retained_input_tokens),
                              out_toks = std::move(retained_output_tokens)](BackwardContext& bctx) {
@@ -125,25 +143,33 @@ void InitChainerxChainerInterop(pybind11::module& m) {
                       std::vector<ArrayBodyPtr> retained_inputs;
                       retained_inputs.reserve(in_toks.size());
                       for (const RetainedInputToken& tok : in_toks) {
-                          retained_inputs.emplace_back(internal::GetArrayBody(bctx.GetRetainedInput(tok)));
+                          retained_inputs.emplace_back(internal::MoveArrayBody(bctx.GetRetainedInput(tok)));
                       }
                       std::vector<ArrayBodyPtr> retained_outputs;
                       retained_outputs.reserve(out_toks.size());
                       for (const nonstd::optional<RetainedOutputToken>& tok : out_toks) {
                           if (tok.has_value()) {
-                              retained_outputs.emplace_back(internal::GetArrayBody(bctx.GetRetainedOutput(*tok)));
+                              retained_outputs.emplace_back(internal::MoveArrayBody(bctx.GetRetainedOutput(*tok)));
                           } else {
                               retained_outputs.emplace_back(nullptr);
                           }
                       }
 
                       // Call FunctionNode._backward_chainerx()
+                      // All the Python objects are created and released within a single acquisition of the GIL. Tuples are passed so that
+                      // they are not converted again in Python.
                       std::vector<ArrayBodyPtr> grad_inputs;
+                      grad_inputs.reserve(target_input_indexes.size());
                       {
                           py::gil_scoped_acquire acquire;
-                          py::object func_backward = function_node_ptr->attr("_backward_chainerx");
-                          py::object py_grad_inputs = func_backward(target_input_indexes, grad_outputs, retained_inputs, retained_outputs);
-                          grad_inputs = py::cast<std::vector<ArrayBodyPtr>>(py_grad_inputs);
+                          py::object py_grad_inputs = (*backward_func_ptr)(
+                                  ToTuple(target_input_indexes),
+                                  ToTuple(grad_outputs),
+                                  ToTuple(retained_inputs),
+                                  ToTuple(retained_outputs));
+                          for (py::handle gx : py_grad_inputs) {
+                              grad_inputs.emplace_back(ToArrayBody(gx));
+                          }
                       }
                       CHAINERX_ASSERT(grad_inputs.size() == target_input_indexes.size());
 
@@ -152,7 +178,7 @@ void InitChainerxChainerInterop(pybind11::module& m) {
                           size_t i_in = gsl::at(target_input_indexes, i);
                           ArrayBodyPtr& gx = gsl::at(grad_inputs, i);
 
-                          bctx.input_grad(i_in) = Array{gx};
+                          bctx.input_grad(i_in) = Array{std::move(gx)};
                       }
                   });
               }
@@ -9,11 +9,13 @@
 #include "chainerx/python/backend.h"
 #include "chainerx/python/backprop_mode.h"
 #include "chainerx/python/backward.h"
+#include "chainerx/python/batch.h"
 #include "chainerx/python/chainer_interop.h"
 #include "chainerx/python/check_backward.h"
 #include "chainerx/python/common.h"
 #include "chainerx/python/context.h"
 #include "chainerx/python/device.h"
+#include "chainerx/python/dlpack.h"
 #include "chainerx/python/dtype.h"
 #include "chainerx/python/error.h"
 #include "chainerx/python/graph.h"
@@ -47,9 +49,11 @@ void InitChainerxModule(pybind11::module& m) {
     InitChainerxScalar(m);
     InitChainerxArrayIndex(m);
     InitChainerxArray(m);
+    InitChainerxDlpack(m);
     InitChainerxBackward(m);
     InitChainerxCheckBackward(m);
     InitChainerxRoutines(m);
+    InitChainerxBatch(m);
     InitChainerxChainerInterop(m);
 
     // chainerx.testing (chainerx._testing)
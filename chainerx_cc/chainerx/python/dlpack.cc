@@ -0,0 +1,195 @@
+#include "chainerx/python/dlpack.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <dlpack/dlpack.h>
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/array_body.h"
+#include "chainerx/backend.h"
+#include "chainerx/context.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/shape.h"
+#include "chainerx/strides.h"
+
+#include "chainerx/python/array.h"
+#include "chainerx/python/common.h"
+
+namespace chainerx {
+namespace python {
+namespace python_internal {
+namespace {
+
+namespace py = pybind11;
+
+// Names of PyCapsule objects holding DLManagedTensor, defined by the DLPack protocol.
+// A consumer renames the capsule when it takes the ownership of the tensor.
+constexpr const char* kDlpackCapsuleName = "dltensor";
+constexpr const char* kUsedDlpackCapsuleName = "used_dltensor";
+
+// Owns an exported tensor and keeps the source array, hence its buffer, alive.
+struct DlpackExport {
+    explicit DlpackExport(Array array) : array{std::move(array)} {}
+
+    Array array;
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+    DLManagedTensor tensor{};
+};
+
+DLDataType GetDlpackDataType(Dtype dtype) {
+    DLDataType data_type{};
+    data_type.bits = static_cast<uint8_t>(GetItemSize(dtype) * 8);
+    data_type.lanes = 1;
+    switch (GetKind(dtype)) {
+        case DtypeKind::kInt:
+            data_type.code = kDLInt;
+            break;
+        case DtypeKind::kUInt:
+            data_type.code = kDLUInt;
+            break;
+        case DtypeKind::kFloat:
+            data_type.code = kDLFloat;
+            break;
+        default:
+            throw DtypeError{"DLPack does not support dtype: ", GetDtypeName(dtype)};
+    }
+    return data_type;
+}
+
+Dtype GetDtypeFromDlpackDataType(const DLDataType& data_type) {
+    if (data_type.lanes != 1) {
+        throw DtypeError{"DLPack tensors with vector types are not supported. Lanes: ", int{data_type.lanes}};
+    }
+    for (Dtype dtype : {Dtype::kInt8, Dtype::kInt16, Dtype::kInt32, Dtype::kInt64, Dtype::kUInt8, Dtype::kFloat32, Dtype::kFloat64}) {
+        DLDataType candidate = GetDlpackDataType(dtype);
+        if (candidate.code == data_type.code && candidate.bits == data_type.bits) {
+            return dtype;
+        }
+    }
+    throw DtypeError{"Unsupported DLPack data type. Code: ", int{data_type.code}, ", bits: ", int{data_type.bits}};
+}
+
+DLContext GetDlpackContext(const Device& device) {
+    DLContext context{};
+    std::string backend_name = device.backend().GetName();
+    if (backend_name == "native") {
+        context.device_type = kDLCPU;
+    } else if (backend_name == "cuda") {
+        context.device_type = kDLGPU;
+    } else {
+        throw DeviceError{"DLPack does not support device: ", device.name()};
+    }
+    context.device_id = device.index();
+    return context;
+}
+
+Device& GetDeviceFromDlpackContext(const DLContext& context) {
+    switch (context.device_type) {
+        case kDLCPU:
+            return GetDefaultContext().GetDevice({"native", context.device_id});
+        case kDLGPU:
+            return GetDefaultContext().GetDevice({"cuda", context.device_id});
+        default:
+            throw DeviceError{"Unsupported DLPack device type: ", static_cast<int>(context.device_type)};
+    }
+}
+
+void DeleteDlpackExport(DLManagedTensor* tensor) { delete static_cast<DlpackExport*>(tensor->manager_ctx); }
+
+void DeleteDlpackCapsule(PyObject* capsule) {
+    // The tensor is owned by the capsule unless it has been consumed.
+    if (PyCapsule_IsValid(capsule, kDlpackCapsuleName) == 0) {
+        return;
+    }
+    auto* tensor = static_cast<DLManagedTensor*>(PyCapsule_GetPointer(capsule, kDlpackCapsuleName));
+    tensor->deleter(tensor);
+}
+
+// Exports the array as a DLPack capsule which shares the buffer of the array.
+py::capsule ToDlpack(const ArrayBodyPtr& self) {
+    Array array{self};
+    int64_t item_size = array.GetItemSize();
+
+    auto dlpack_export = std::make_unique<DlpackExport>(array.AsGradStopped());
+    dlpack_export->shape.assign(array.shape().begin(), array.shape().end());
+    for (int64_t stride : array.strides()) {
+        // DLPack strides are in elements.
+        if (stride % item_size != 0) {
+            throw DimensionError{"DLPack does not support strides that are not multiples of the item size: ", array.strides()};
+        }
+        dlpack_export->strides.emplace_back(stride / item_size);
+    }
+
+    // Consumers access the buffer without synchronizing the device.
+    array.device().Synchronize();
+
+    DLTensor& dl_tensor = dlpack_export->tensor.dl_tensor;
+    dl_tensor.data = array.raw_data();
+    dl_tensor.ctx = GetDlpackContext(array.device());
+    dl_tensor.ndim = array.ndim();
+    dl_tensor.dtype = GetDlpackDataType(array.dtype());
+    dl_tensor.shape = dlpack_export->shape.data();
+    dl_tensor.strides = dlpack_export->strides.data();
+    dl_tensor.byte_offset = static_cast<uint64_t>(array.offset());
+    dlpack_export->tensor.manager_ctx = dlpack_export.get();
+    dlpack_export->tensor.deleter = &DeleteDlpackExport;
+
+    py::capsule capsule{&dlpack_export->tensor, kDlpackCapsuleName, &DeleteDlpackCapsule};
+    dlpack_export.release();
+    return capsule;
+}
+
+// Imports a DLPack capsule as an array which shares the buffer of the tensor.
+ArrayBodyPtr FromDlpack(const py::capsule& capsule) {
+    if (PyCapsule_IsValid(capsule.ptr(), kDlpackCapsuleName) == 0) {
+        throw py::value_error{"The capsule is not a DLPack tensor or has already been consumed."};
+    }
+    auto* tensor = static_cast<DLManagedTensor*>(PyCapsule_GetPointer(capsule.ptr(), kDlpackCapsuleName));
+    const DLTensor& dl_tensor = tensor->dl_tensor;
+
+    Device& device = GetDeviceFromDlpackContext(dl_tensor.ctx);
+    Dtype dtype = GetDtypeFromDlpackDataType(dl_tensor.dtype);
+    Shape shape{dl_tensor.shape, dl_tensor.shape + dl_tensor.ndim};
+    nonstd::optional<Strides> strides{};
+    if (dl_tensor.strides != nullptr) {
+        strides = Strides{};
+        int64_t item_size = GetItemSize(dtype);
+        for (int i = 0; i < dl_tensor.ndim; ++i) {
+            strides->emplace_back(dl_tensor.strides[i] * item_size);
+        }
+    }
+
+    // Take the ownership of the tensor. From here on, the tensor is released when the buffer is no longer referred to by any array.
+    PyCapsule_SetName(capsule.ptr(), kUsedDlpackCapsuleName);
+
+    // The deleter may be called from a thread without the GIL, e.g. a worker thread of backward, and the producer may require the GIL.
+    std::shared_ptr<void> data{dl_tensor.data, [tensor](void*) {
+                                   CallWithGil([tensor]() {
+                                       if (tensor->deleter != nullptr) {
+                                           tensor->deleter(tensor);
+                                       }
+                                   });
+                               }};
+
+    return internal::MoveArrayBody(FromData(shape, dtype, data, strides, static_cast<int64_t>(dl_tensor.byte_offset), device));
+}
+
+}  // namespace
+
+void InitChainerxDlpack(pybind11::module& m) {
+    m.def("to_dlpack", &ToDlpack, py::arg("array"));
+    m.def("from_dlpack", &FromDlpack, py::arg("capsule"));
+}
+
+}  // namespace python_internal
+}  // namespace python
+}  // namespace chainerx
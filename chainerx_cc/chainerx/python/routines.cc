@@ -219,7 +219,10 @@ void InitChainerxCreation(pybind11::module& m) {
           [](const ArrayBodyPtr& a, py::handle device) { return MoveArrayBody(OnesLike(Array{a}, GetDevice(device))); },
           py::arg("a"),
           py::arg("device") = nullptr);
-    m.def("copy", [](const ArrayBodyPtr& a) { return MoveArrayBody(Copy(Array{a})); }, py::arg("a"));
+    m.def("copy",
+          [](const ArrayBodyPtr& a) { return MoveArrayBody(Copy(Array{a})); },
+          py::call_guard<py::gil_scoped_release>(),
+          py::arg("a"));
     m.def("frombuffer",
           &MakeArrayFromBuffer,
           py::arg("buffer"),
@@ -291,9 +294,17 @@ void InitChainerxIndexing(pybind11::module& m) {
 void InitChainerxLinalg(pybind11::module& m) {
     // linalg routines
     m.def("dot",
-          [](const ArrayBodyPtr& a, const ArrayBodyPtr& b) { return MoveArrayBody(Dot(Array{a}, Array{b})); },
+          [](const ArrayBodyPtr& a, const ArrayBodyPtr& b, const nonstd::optional<ArrayBodyPtr>& out) {
+              if (out.has_value()) {
+                  Dot(Array{a}, Array{b}, Array{*out});
+                  return *out;
+              }
+              return MoveArrayBody(Dot(Array{a}, Array{b}));
+          },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("a"),
-          py::arg("b"));
+          py::arg("b"),
+          py::arg("out") = nullptr);
 }
 
 void InitChainerxLogic(pybind11::module& m) {
@@ -502,59 +513,157 @@ void InitChainerxMath(pybind11::module& m) {
     // math routines
     m.def("negative", [](const ArrayBodyPtr& x) { return MoveArrayBody(Negative(Array{x})); }, py::arg("x"));
     m.def("add",
-          [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2) { return MoveArrayBody(Array{x1} + Array{x2}); },
+          [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2, const nonstd::optional<ArrayBodyPtr>& out) {
+              if (out.has_value()) {
+                  Add(Array{x1}, Array{x2}, Array{*out});
+                  return *out;
+              }
+              return MoveArrayBody(Array{x1} + Array{x2});
+          },
           py::arg("x1"),
-          py::arg("x2"));
-    m.def("add", [](const ArrayBodyPtr& x1, Scalar x2) { return MoveArrayBody(Add(Array{x1}, x2)); }, py::arg("x1"), py::arg("x2"));
+          py::arg("x2"),
+          py::arg("out") = nullptr);
+    m.def("add",
+          [](const ArrayBodyPtr& x1, Scalar x2, const nonstd::optional<ArrayBodyPtr>& out) {
+              if (out.has_value()) {
+                  Add(Array{x1}, x2, Array{*out});
+                  return *out;
+              }
+              return MoveArrayBody(Add(Array{x1}, x2));
+          },
+          py::arg("x1"),
+          py::arg("x2"),
+          py::arg("out") = nullptr);
     m.def("add", [](Scalar x1, const ArrayBodyPtr& x2) { return MoveArrayBody(Add(x1, Array{x2})); }, py::arg("x1"), py::arg("x2"));
     m.def("subtract",
-          [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2) { return MoveArrayBody(Array{x1} - Array{x2}); },
+          [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2, const nonstd::optional<ArrayBodyPtr>& out) {
+              if (out.has_value()) {
+                  Subtract(Array{x1}, Array{x2}, Array{*out});
+                  return *out;
+              }
+              return MoveArrayBody(Array{x1} - Array{x2});
+          },
           py::arg("x1"),
-          py::arg("x2"));
+          py::arg("x2"),
+          py::arg("out") = nullptr);
     m.def("subtract",
-          [](const ArrayBodyPtr& x1, Scalar x2) { return MoveArrayBody(Subtract(Array{x1}, x2)); },
+          [](const ArrayBodyPtr& x1, Scalar x2, const nonstd::optional<ArrayBodyPtr>& out) {
+              if (out.has_value()) {
+                  Subtract(Array{x1}, x2, Array{*out});
+                  return *out;
+              }
+              return MoveArrayBody(Subtract(Array{x1}, x2));
+          },
           py::arg("x1"),
-          py::arg("x2"));
+          py::arg("x2"),
+          py::arg("out") = nullptr);
     m.def("subtract",
           [](Scalar x1, const ArrayBodyPtr& x2) { return MoveArrayBody(Subtract(x1, Array{x2})); },
           py::arg("x1"),
           py::arg("x2"));
     m.def("multiply",
-          [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2) { return MoveArrayBody(Array{x1} * Array{x2}); },
+          [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2, const nonstd::optional<ArrayBodyPtr>& out) {
+              if (out.has_value()) {
+                  Multiply(Array{x1}, Array{x2}, Array{*out});
+                  return *out;
+              }
+              return MoveArrayBody(Array{x1} * Array{x2});
+          },
           py::arg("x1"),
-          py::arg("x2"));
+          py::arg("x2"),
+          py::arg("out") = nullptr);
     m.def("multiply",
-          [](const ArrayBodyPtr& x1, Scalar x2) { return MoveArrayBody(Multiply(Array{x1}, x2)); },
+          [](const ArrayBodyPtr& x1, Scalar x2, const nonstd::optional<ArrayBodyPtr>& out) {
+              if (out.has_value()) {
+                  Multiply(Array{x1}, x2, Array{*out});
+                  return *out;
+              }
+              return MoveArrayBody(Multiply(Array{x1}, x2));
+          },
           py::arg("x1"),
-          py::arg("x2"));
+          py::arg("x2"),
+          py::arg("out") = nullptr);
     m.def("multiply",
           [](Scalar x1, const ArrayBodyPtr& x2) { return MoveArrayBody(Multiply(x1, Array{x2})); },
           py::arg("x1"),
           py::arg("x2"));
     m.def("divide",
-          [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2) { return MoveArrayBody(Array{x1} / Array{x2}); },
+          [](const ArrayBodyPtr& x1, const ArrayBodyPtr& x2, const nonstd::optional<ArrayBodyPtr>& out) {
+              if (out.has_value()) {
+                  Divide(Array{x1}, Array{x2}, Array{*out});
+                  return *out;
+              }
+              return MoveArrayBody(Array{x1} / Array{x2});
+          },
           py::arg("x1"),
-          py::arg("x2"));
-    m.def("divide", [](const ArrayBodyPtr& x1, Scalar x2) { return MoveArrayBody(Divide(Array{x1}, x2)); }, py::arg("x1"), py::arg("x2"));
+          py::arg("x2"),
+          py::arg("out") = nullptr);
+    m.def("divide",
+          [](const ArrayBodyPtr& x1, Scalar x2, const nonstd::optional<ArrayBodyPtr>& out) {
+              if (out.has_value()) {
+                  Divide(Array{x1}, x2, Array{*out});
+                  return *out;
+              }
+              return MoveArrayBody(Divide(Array{x1}, x2));
+          },
+          py::arg("x1"),
+          py::arg("x2"),
+          py::arg("out") = nullptr);
     m.def("divide", [](Scalar x1, const ArrayBodyPtr& x2) { return MoveArrayBody(Divide(x1, Array{x2})); }, py::arg("x1"), py::arg("x2"));
     m.def("sum",
-          [](const ArrayBodyPtr& a, int8_t axis, bool keepdims) { return MoveArrayBody(Sum(Array{a}, Axes{axis}, keepdims)); },
+          [](const ArrayBodyPtr& a, int8_t axis, bool keepdims, const nonstd::optional<ArrayBodyPtr>& out) {
+              if (out.has_value()) {
+                  Sum(Array{a}, Axes{axis}, keepdims, Array{*out});
+                  return *out;
+              }
+              return MoveArrayBody(Sum(Array{a}, Axes{axis}, keepdims));
+          },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("a"),
           py::arg("axis"),
-          py::arg("keepdims") = false);
+          py::arg("keepdims") = false,
+          py::arg("out") = nullptr);
     m.def("sum",
-          [](const ArrayBodyPtr& a, const nonstd::optional<std::vector<int8_t>>& axis, bool keepdims) {
+          [](const ArrayBodyPtr& a,
+             const nonstd::optional<std::vector<int8_t>>& axis,
+             bool keepdims,
+             const nonstd::optional<ArrayBodyPtr>& out) {
+              if (out.has_value()) {
+                  Sum(Array{a}, ToAxes(axis), keepdims, Array{*out});
+                  return *out;
+              }
               return MoveArrayBody(Sum(Array{a}, ToAxes(axis), keepdims));
           },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("a"),
           py::arg("axis") = nullptr,
-          py::arg("keepdims") = false);
+          py::arg("keepdims") = false,
+          py::arg("out") = nullptr);
     m.def("maximum", [](const ArrayBodyPtr& x1, Scalar x2) { return MoveArrayBody(Maximum(Array{x1}, x2)); }, py::arg("x1"), py::arg("x2"));
     m.def("maximum", [](Scalar x1, const ArrayBodyPtr& x2) { return MoveArrayBody(Maximum(x1, Array{x2})); }, py::arg("x1"), py::arg("x2"));
-    m.def("exp", [](const ArrayBodyPtr& x) { return MoveArrayBody(Exp(Array{x})); }, py::arg("x"));
-    m.def("log", [](const ArrayBodyPtr& x) { return MoveArrayBody(Log(Array{x})); }, py::arg("x"));
+    m.def("exp",
+          [](const ArrayBodyPtr& x, const nonstd::optional<ArrayBodyPtr>& out) {
+              if (out.has_value()) {
+                  Exp(Array{x}, Array{*out});
+                  return *out;
+              }
+              return MoveArrayBody(Exp(Array{x}));
+          },
+          py::arg("x"),
+          py::arg("out") = nullptr);
+    m.def("log",
+          [](const ArrayBodyPtr& x, const nonstd::optional<ArrayBodyPtr>& out) {
+              if (out.has_value()) {
+                  Log(Array{x}, Array{*out});
+                  return *out;
+              }
+              return MoveArrayBody(Log(Array{x}));
+          },
+          py::arg("x"),
+          py::arg("out") = nullptr);
     m.def("logsumexp",
           [](const ArrayBodyPtr& x, int8_t axis, bool keepdims) { return MoveArrayBody(LogSumExp(Array{x}, Axes{axis}, keepdims)); },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("x"),
           py::arg("axis"),
           py::arg("keepdims") = false);
@@ -562,17 +671,20 @@ void InitChainerxMath(pybind11::module& m) {
           [](const ArrayBodyPtr& x, const nonstd::optional<std::vector<int8_t>>& axis, bool keepdims) {
               return MoveArrayBody(LogSumExp(Array{x}, ToAxes(axis), keepdims));
           },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("x"),
           py::arg("axis") = nullptr,
           py::arg("keepdims") = false);
     m.def("log_softmax",
           [](const ArrayBodyPtr& x, int8_t axis) { return MoveArrayBody(LogSoftmax(Array{x}, Axes{axis})); },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("x"),
           py::arg("axis"));
     m.def("log_softmax",
           [](const ArrayBodyPtr& x, const nonstd::optional<std::vector<int8_t>>& axis) {
               return MoveArrayBody(LogSoftmax(Array{x}, ToAxes(axis)));
           },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("x"),
           py::arg("axis") = nullptr);
     m.def("sqrt", [](const ArrayBodyPtr& x) { return MoveArrayBody(Sqrt(Array{x})); }, py::arg("x"));
@@ -585,6 +697,7 @@ void InitChainerxSorting(pybind11::module& m) {
     // sorting routines
     m.def("argmax",
           [](const ArrayBodyPtr& a, const nonstd::optional<int8_t>& axis) { return MoveArrayBody(ArgMax(Array{a}, ToAxes(axis))); },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("a"),
           py::arg("axis") = nullptr);
 }
@@ -593,6 +706,7 @@ void InitChainerxStatistics(pybind11::module& m) {
     // statistics routines
     m.def("amax",
           [](const ArrayBodyPtr& a, int8_t axis, bool keepdims) { return MoveArrayBody(AMax(Array{a}, Axes{axis}, keepdims)); },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("a"),
           py::arg("axis"),
           py::arg("keepdims") = false);
@@ -600,6 +714,7 @@ void InitChainerxStatistics(pybind11::module& m) {
           [](const ArrayBodyPtr& a, const nonstd::optional<std::vector<int8_t>>& axis, bool keepdims) {
               return MoveArrayBody(AMax(Array{a}, ToAxes(axis), keepdims));
           },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("a"),
           py::arg("axis") = nullptr,
           py::arg("keepdims") = false);
@@ -618,12 +733,16 @@ void InitChainerxConnection(pybind11::module& m) {
               // Create an Array from x to compute the image dimensions and the expected number of stride and padding elements.
               Array x_array{x};
               int8_t ndim = x_array.ndim() - 2;
+              StackVector<int64_t, kMaxNdim> stride_vector = ToStackVector<int64_t>(stride, ndim);
+              StackVector<int64_t, kMaxNdim> pad_vector = ToStackVector<int64_t>(pad, ndim);
+
+              py::gil_scoped_release release;
               return MoveArrayBody(
                       Conv(x_array,
                            Array{w},
                            b.has_value() ? nonstd::optional<Array>{Array{*b}} : nonstd::nullopt,
-                           ToStackVector<int64_t>(stride, ndim),
-                           ToStackVector<int64_t>(pad, ndim),
+                           stride_vector,
+                           pad_vector,
                            cover_all));
           },
           py::arg("x"),
@@ -642,14 +761,20 @@ void InitChainerxConnection(pybind11::module& m) {
               // Create an Array from x to compute the image dimensions and the expected number of stride and padding elements.
               Array x_array{x};
               int8_t ndim = x_array.ndim() - 2;
+              StackVector<int64_t, kMaxNdim> stride_vector = ToStackVector<int64_t>(stride, ndim);
+              StackVector<int64_t, kMaxNdim> pad_vector = ToStackVector<int64_t>(pad, ndim);
+              nonstd::optional<StackVector<int64_t, kMaxNdim>> outsize_vector =
+                      outsize.has_value() ? nonstd::optional<StackVector<int64_t, kMaxNdim>>{ToStackVector<int64_t>(*outsize, ndim)}
+                                          : nonstd::nullopt;
+
+              py::gil_scoped_release release;
               return MoveArrayBody(ConvTranspose(
                       x_array,
                       Array{w},
                       b.has_value() ? nonstd::optional<Array>{Array{*b}} : nonstd::nullopt,
-                      ToStackVector<int64_t>(stride, ndim),
-                      ToStackVector<int64_t>(pad, ndim),
-                      outsize.has_value() ? nonstd::optional<StackVector<int64_t, kMaxNdim>>{ToStackVector<int64_t>(*outsize, ndim)}
-                                          : nonstd::nullopt));
+                      stride_vector,
+                      pad_vector,
+                      outsize_vector));
           },
           py::arg("x"),
           py::arg("w"),
@@ -662,6 +787,7 @@ void InitChainerxConnection(pybind11::module& m) {
               return MoveArrayBody(
                       Linear(Array{x}, Array{w}, b.has_value() ? nonstd::optional<Array>{Array{*b}} : nonstd::nullopt, n_batch_axes));
           },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("x"),
           py::arg("w"),
           py::arg("b") = nullptr,
@@ -682,6 +808,7 @@ void InitChainerxNormalization(pybind11::module& m) {
               return MoveArrayBody(
                       BatchNorm(Array{x}, Array{gamma}, Array{beta}, Array{running_mean}, Array{running_var}, eps, decay, ToAxes(axis)));
           },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("x"),
           py::arg("gamma"),
           py::arg("beta"),
@@ -700,6 +827,7 @@ void InitChainerxNormalization(pybind11::module& m) {
              const nonstd::optional<std::vector<int8_t>>& axis) {
               return MoveArrayBody(FixedBatchNorm(Array{x}, Array{gamma}, Array{beta}, Array{mean}, Array{var}, eps, ToAxes(axis)));
           },
+          py::call_guard<py::gil_scoped_release>(),
           py::arg("x"),
           py::arg("gamma"),
           py::arg("beta"),
@@ -716,12 +844,12 @@ void InitChainerxPooling(pybind11::module& m) {
           [](const ArrayBodyPtr& x, py::handle ksize, py::handle stride, py::handle pad, bool cover_all) {
               Array x_array{x};
               int8_t ndim = x_array.ndim() - 2;
-              return MoveArrayBody(
-                      MaxPool(x_array,
-                              ToStackVector<int64_t>(ksize, ndim),
-                              stride.is_none() ? ToStackVector<int64_t>(ksize, ndim) : ToStackVector<int64_t>(stride, ndim),
-                              ToStackVector<int64_t>(pad, ndim),
-                              cover_all));
+              StackVector<int64_t, kMaxNdim> ksize_vector = ToStackVector<int64_t>(ksize, ndim);
+              StackVector<int64_t, kMaxNdim> stride_vector = stride.is_none() ? ksize_vector : ToStackVector<int64_t>(stride, ndim);
+              StackVector<int64_t, kMaxNdim> pad_vector = ToStackVector<int64_t>(pad, ndim);
+
+              py::gil_scoped_release release;
+              return MoveArrayBody(MaxPool(x_array, ksize_vector, stride_vector, pad_vector, cover_all));
           },
           py::arg("x"),
           py::arg("ksize"),
@@ -742,12 +870,12 @@ void InitChainerxPooling(pybind11::module& m) {
                   throw py::value_error{"pad_mode must be either of 'zero' or 'ignore'"};
               }
 
-              return MoveArrayBody(AveragePool(
-                      x_array,
-                      ToStackVector<int64_t>(ksize, ndim),
-                      stride.is_none() ? ToStackVector<int64_t>(ksize, ndim) : ToStackVector<int64_t>(stride, ndim),
-                      ToStackVector<int64_t>(pad, ndim),
-                      mode));
+              StackVector<int64_t, kMaxNdim> ksize_vector = ToStackVector<int64_t>(ksize, ndim);
+              StackVector<int64_t, kMaxNdim> stride_vector = stride.is_none() ? ksize_vector : ToStackVector<int64_t>(stride, ndim);
+              StackVector<int64_t, kMaxNdim> pad_vector = ToStackVector<int64_t>(pad, ndim);
+
+              py::gil_scoped_release release;
+              return MoveArrayBody(AveragePool(x_array, ksize_vector, stride_vector, pad_vector, mode));
           },
           py::arg("x"),
           py::arg("ksize"),
@@ -0,0 +1,373 @@
+#include "chainerx/recorded_graph.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/axes.h"
+#include "chainerx/backprop_mode.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/macro.h"
+#include "chainerx/routines/linalg.h"
+#include "chainerx/routines/manipulation.h"
+#include "chainerx/routines/math.h"
+#include "chainerx/scalar.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+
+const char* GetGraphOpKindName(GraphOpKind kind) {
+    switch (kind) {
+        case GraphOpKind::kInput:
+            return "input";
+        case GraphOpKind::kConstant:
+            return "constant";
+        case GraphOpKind::kNegative:
+            return "negative";
+        case GraphOpKind::kExp:
+            return "exp";
+        case GraphOpKind::kLog:
+            return "log";
+        case GraphOpKind::kAdd:
+            return "add";
+        case GraphOpKind::kSubtract:
+            return "subtract";
+        case GraphOpKind::kMultiply:
+            return "multiply";
+        case GraphOpKind::kDivide:
+            return "divide";
+        case GraphOpKind::kAddScalar:
+            return "add_scalar";
+        case GraphOpKind::kMultiplyScalar:
+            return "multiply_scalar";
+        case GraphOpKind::kDot:
+            return "dot";
+        case GraphOpKind::kSum:
+            return "sum";
+        case GraphOpKind::kTranspose:
+            return "transpose";
+        case GraphOpKind::kReshape:
+            return "reshape";
+    }
+    CHAINERX_NEVER_REACH();
+}
+
+GraphNodeId RecordedGraph::AddInput(const Shape& shape, Dtype dtype) {
+    GraphNode node{};
+    node.kind = GraphOpKind::kInput;
+    node.shape = shape;
+    node.dtype = dtype;
+    node.input_index = input_count_++;
+    return AddNode(std::move(node));
+}
+
+GraphNodeId RecordedGraph::AddConstant(const Array& value) {
+    GraphNode node{};
+    node.kind = GraphOpKind::kConstant;
+    node.shape = value.shape();
+    node.dtype = value.dtype();
+    node.value = value.AsGradStopped();
+    return AddNode(std::move(node));
+}
+
+GraphNodeId RecordedGraph::Negative(GraphNodeId x) { return AddUnary(GraphOpKind::kNegative, x); }
+
+GraphNodeId RecordedGraph::Exp(GraphNodeId x) { return AddUnary(GraphOpKind::kExp, x); }
+
+GraphNodeId RecordedGraph::Log(GraphNodeId x) { return AddUnary(GraphOpKind::kLog, x); }
+
+GraphNodeId RecordedGraph::Add(GraphNodeId x1, GraphNodeId x2) { return AddBinary(GraphOpKind::kAdd, x1, x2); }
+
+GraphNodeId RecordedGraph::Subtract(GraphNodeId x1, GraphNodeId x2) { return AddBinary(GraphOpKind::kSubtract, x1, x2); }
+
+GraphNodeId RecordedGraph::Multiply(GraphNodeId x1, GraphNodeId x2) { return AddBinary(GraphOpKind::kMultiply, x1, x2); }
+
+GraphNodeId RecordedGraph::Divide(GraphNodeId x1, GraphNodeId x2) { return AddBinary(GraphOpKind::kDivide, x1, x2); }
+
+GraphNodeId RecordedGraph::AddScalar(GraphNodeId x1, Scalar x2) {
+    GraphNodeId id = AddUnary(GraphOpKind::kAddScalar, x1);
+    nodes_[id].scalar = x2;
+    return id;
+}
+
+GraphNodeId RecordedGraph::MultiplyScalar(GraphNodeId x1, Scalar x2) {
+    GraphNodeId id = AddUnary(GraphOpKind::kMultiplyScalar, x1);
+    nodes_[id].scalar = x2;
+    return id;
+}
+
+GraphNodeId RecordedGraph::Dot(GraphNodeId a, GraphNodeId b) {
+    const GraphNode& a_node = GetInputNode(a);
+    const GraphNode& b_node = GetInputNode(b);
+    if (a_node.shape.ndim() == 0 || b_node.shape.ndim() == 0) {
+        return AddBinary(GraphOpKind::kMultiply, a, b);
+    }
+    CheckEqual(a_node.dtype, b_node.dtype);
+    if (b_node.shape.ndim() > 2) {
+        throw NotImplementedError{"dot does not support rhs operand with ndim > 2"};
+    }
+    if (b_node.shape[0] != a_node.shape.back()) {
+        throw DimensionError{"Axis dimension mismatch"};
+    }
+
+    GraphNode node{};
+    node.kind = GraphOpKind::kDot;
+    node.inputs = {a, b};
+    std::copy(a_node.shape.begin(), a_node.shape.end() - 1, std::back_inserter(node.shape));
+    std::copy(b_node.shape.begin() + 1, b_node.shape.end(), std::back_inserter(node.shape));
+    node.dtype = a_node.dtype;
+    return AddNode(std::move(node));
+}
+
+GraphNodeId RecordedGraph::Sum(GraphNodeId a, const OptionalAxes& axis, bool keepdims) {
+    const GraphNode& a_node = GetInputNode(a);
+    GraphNode node{};
+    node.kind = GraphOpKind::kSum;
+    node.inputs = {a};
+    node.axes = internal::GetSortedAxesOrAll(axis, a_node.shape.ndim());
+    node.keepdims = keepdims;
+    node.shape = internal::ReduceShape(a_node.shape, node.axes, keepdims);
+    node.dtype = internal::GetSumOutputDtype(a_node.dtype);
+    return AddNode(std::move(node));
+}
+
+GraphNodeId RecordedGraph::Transpose(GraphNodeId a, const OptionalAxes& axes) {
+    const GraphNode& a_node = GetInputNode(a);
+    int8_t ndim = a_node.shape.ndim();
+    GraphNode node{};
+    node.kind = GraphOpKind::kTranspose;
+    node.inputs = {a};
+    if (axes.has_value()) {
+        if (axes->ndim() != ndim || !internal::IsAxesPermutation(internal::GetNormalizedAxes(*axes, ndim), ndim)) {
+            throw DimensionError{"Invalid axes ", *axes, " for transposing an array of shape ", a_node.shape};
+        }
+        node.axes = internal::GetNormalizedAxes(*axes, ndim);
+    } else {
+        for (int8_t i = 0; i < ndim; ++i) {
+            node.axes.emplace_back(ndim - i - 1);
+        }
+    }
+    node.shape = internal::TransposeShape(a_node.shape, node.axes);
+    node.dtype = a_node.dtype;
+    return AddNode(std::move(node));
+}
+
+GraphNodeId RecordedGraph::Reshape(GraphNodeId a, const Shape& newshape) {
+    const GraphNode& a_node = GetInputNode(a);
+    GraphNode node{};
+    node.kind = GraphOpKind::kReshape;
+    node.inputs = {a};
+    node.shape = internal::GetInferredShape(newshape, a_node.shape.GetTotalSize());
+    node.dtype = a_node.dtype;
+    return AddNode(std::move(node));
+}
+
+void RecordedGraph::AddOutput(GraphNodeId node, bool requires_grad) {
+    GetInputNode(node);
+    outputs_.emplace_back(GraphOutput{node, requires_grad});
+}
+
+void RecordedGraph::CheckInputs(const std::vector<Array>& inputs) const {
+    if (inputs.size() != input_count_) {
+        throw DimensionError{"Recorded graph got ", inputs.size(), " inputs. Recorded: ", input_count_, "."};
+    }
+    for (const GraphNode& node : nodes_) {
+        if (node.kind != GraphOpKind::kInput) {
+            continue;
+        }
+        const Array& input = inputs[node.input_index];
+        if (input.shape() != node.shape) {
+            throw DimensionError{"Recorded graph input ",
+                                 node.input_index,
+                                 " has an invalid shape ",
+                                 input.shape(),
+                                 ". Recorded: ",
+                                 node.shape,
+                                 "."};
+        }
+        if (input.dtype() != node.dtype) {
+            throw DtypeError{"Recorded graph input ",
+                             node.input_index,
+                             " has an invalid dtype ",
+                             GetDtypeName(input.dtype()),
+                             ". Recorded: ",
+                             GetDtypeName(node.dtype),
+                             "."};
+        }
+    }
+}
+
+std::vector<Array> RecordedGraph::Execute(const std::vector<Array>& inputs) const {
+    CheckInputs(inputs);
+
+    // Each value is released after its last use.
+    std::vector<size_t> use_counts = GetUseCounts();
+    std::vector<nonstd::optional<Array>> values(nodes_.size());
+    std::vector<Array> node_inputs{};
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+        const GraphNode& node = nodes_[i];
+        if (node.kind == GraphOpKind::kInput) {
+            values[i] = inputs[node.input_index];
+            continue;
+        }
+
+        node_inputs.clear();
+        for (GraphNodeId input_id : node.inputs) {
+            CHAINERX_ASSERT(values[input_id].has_value());
+            node_inputs.emplace_back(*values[input_id]);
+            if (--use_counts[input_id] == 0) {
+                values[input_id].reset();
+            }
+        }
+        if (node.no_backprop) {
+            NoBackpropModeScope scope{};
+            values[i] = Evaluate(node, node_inputs);
+        } else {
+            values[i] = Evaluate(node, node_inputs);
+        }
+    }
+
+    std::vector<Array> outputs{};
+    outputs.reserve(outputs_.size());
+    for (const GraphOutput& output : outputs_) {
+        CHAINERX_ASSERT(values[output.node].has_value());
+        if (nodes_[output.node].kind == GraphOpKind::kConstant) {
+            // Constant values are stored in the graph. Outputs must not share their buffers across calls.
+            outputs.emplace_back(values[output.node]->Copy());
+        } else {
+            outputs.emplace_back(*values[output.node]);
+        }
+    }
+    return outputs;
+}
+
+Array RecordedGraph::Evaluate(const GraphNode& node, const std::vector<Array>& inputs) {
+    switch (node.kind) {
+        case GraphOpKind::kInput:
+            throw ChainerxError{"Input nodes cannot be evaluated."};
+        case GraphOpKind::kConstant:
+            return *node.value;
+        case GraphOpKind::kNegative:
+            return chainerx::Negative(inputs[0]);
+        case GraphOpKind::kExp:
+            return chainerx::Exp(inputs[0]);
+        case GraphOpKind::kLog:
+            return chainerx::Log(inputs[0]);
+        case GraphOpKind::kAdd:
+            return chainerx::Add(inputs[0], inputs[1]);
+        case GraphOpKind::kSubtract:
+            return chainerx::Subtract(inputs[0], inputs[1]);
+        case GraphOpKind::kMultiply:
+            return chainerx::Multiply(inputs[0], inputs[1]);
+        case GraphOpKind::kDivide:
+            return chainerx::Divide(inputs[0], inputs[1]);
+        case GraphOpKind::kAddScalar:
+            return chainerx::Add(inputs[0], node.scalar);
+        case GraphOpKind::kMultiplyScalar:
+            return chainerx::Multiply(inputs[0], node.scalar);
+        case GraphOpKind::kDot:
+            return chainerx::Dot(inputs[0], inputs[1]);
+        case GraphOpKind::kSum:
+            return chainerx::Sum(inputs[0], node.axes, node.keepdims);
+        case GraphOpKind::kTranspose:
+            return chainerx::Transpose(inputs[0], node.axes);
+        case GraphOpKind::kReshape:
+            return chainerx::Reshape(inputs[0], node.shape);
+    }
+    CHAINERX_NEVER_REACH();
+}
+
+void RecordedGraph::ReplaceAllUsesWith(GraphNodeId from, GraphNodeId to) {
+    CHAINERX_ASSERT(to < from);
+    for (GraphNodeId id = from + 1; id < nodes_.size(); ++id) {
+        for (GraphNodeId& input : nodes_[id].inputs) {
+            if (input == from) {
+                input = to;
+            }
+        }
+    }
+    for (GraphOutput& output : outputs_) {
+        if (output.node == from) {
+            output.node = to;
+        }
+    }
+}
+
+void RecordedGraph::RemoveNodes(const std::vector<bool>& is_removed) {
+    CHAINERX_ASSERT(is_removed.size() == nodes_.size());
+    std::vector<GraphNodeId> new_ids(nodes_.size());
+    std::vector<GraphNode> nodes{};
+    for (GraphNodeId id = 0; id < nodes_.size(); ++id) {
+        if (is_removed[id]) {
+            continue;
+        }
+        GraphNode& node = nodes_[id];
+        for (GraphNodeId& input : node.inputs) {
+            CHAINERX_ASSERT(!is_removed[input]);
+            input = new_ids[input];
+        }
+        new_ids[id] = nodes.size();
+        nodes.emplace_back(std::move(node));
+    }
+    for (GraphOutput& output : outputs_) {
+        CHAINERX_ASSERT(!is_removed[output.node]);
+        output.node = new_ids[output.node];
+    }
+    nodes_ = std::move(nodes);
+}
+
+std::vector<size_t> RecordedGraph::GetUseCounts() const {
+    std::vector<size_t> use_counts(nodes_.size());
+    for (const GraphNode& node : nodes_) {
+        for (GraphNodeId input : node.inputs) {
+            ++use_counts[input];
+        }
+    }
+    for (const GraphOutput& output : outputs_) {
+        ++use_counts[output.node];
+    }
+    return use_counts;
+}
+
+GraphNodeId RecordedGraph::AddNode(GraphNode node) {
+    nodes_.emplace_back(std::move(node));
+    return nodes_.size() - 1;
+}
+
+GraphNodeId RecordedGraph::AddUnary(GraphOpKind kind, GraphNodeId x) {
+    const GraphNode& x_node = GetInputNode(x);
+    GraphNode node{};
+    node.kind = kind;
+    node.inputs = {x};
+    node.shape = x_node.shape;
+    node.dtype = x_node.dtype;
+    return AddNode(std::move(node));
+}
+
+GraphNodeId RecordedGraph::AddBinary(GraphOpKind kind, GraphNodeId x1, GraphNodeId x2) {
+    const GraphNode& x1_node = GetInputNode(x1);
+    const GraphNode& x2_node = GetInputNode(x2);
+    CheckEqual(x1_node.dtype, x2_node.dtype);
+    GraphNode node{};
+    node.kind = kind;
+    node.inputs = {x1, x2};
+    node.shape = internal::BroadcastShapes(x1_node.shape, x2_node.shape);
+    node.dtype = x1_node.dtype;
+    return AddNode(std::move(node));
+}
+
+const GraphNode& RecordedGraph::GetInputNode(GraphNodeId id) const {
+    if (id >= nodes_.size()) {
+        throw ChainerxError{"Invalid graph node: ", id};
+    }
+    return nodes_[id];
+}
+
+}  // namespace chainerx
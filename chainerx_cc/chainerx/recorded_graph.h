@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <nonstd/optional.hpp>
+
+#include "chainerx/array.h"
+#include "chainerx/axes.h"
+#include "chainerx/dtype.h"
+#include "chainerx/scalar.h"
+#include "chainerx/shape.h"
+
+namespace chainerx {
+
+enum class GraphOpKind {
+    kInput,
+    kConstant,
+    kNegative,
+    kExp,
+    kLog,
+    kAdd,
+    kSubtract,
+    kMultiply,
+    kDivide,
+    kAddScalar,
+    kMultiplyScalar,
+    kDot,
+    kSum,
+    kTranspose,
+    kReshape,
+};
+
+const char* GetGraphOpKindName(GraphOpKind kind);
+
+// Index of a node in RecordedGraph::nodes().
+using GraphNodeId = size_t;
+
+struct GraphNode {
+    GraphOpKind kind{};
+    std::vector<GraphNodeId> inputs;
+
+    // Shape and dtype of the output.
+    Shape shape;
+    Dtype dtype{};
+
+    // Attributes. Only those of the kind are meaningful.
+    size_t input_index{};  // kInput
+    nonstd::optional<Array> value{};  // kConstant
+    Scalar scalar{0};  // kAddScalar and kMultiplyScalar
+    Axes axes{};  // kSum and kTranspose
+    bool keepdims{false};  // kSum
+
+    // If true, the node is evaluated without building the computation graph since none of the outputs requiring gradients depend on it.
+    bool no_backprop{false};
+};
+
+struct GraphOutput {
+    GraphNodeId node;
+
+    // Whether the output will be backpropped after execution.
+    bool requires_grad;
+};
+
+// Forward computation recorded as a graph of ops with fixed shapes and dtypes, which can be rewritten before being executed repeatedly.
+//
+// Nodes are always kept in a topological order, i.e. each node only takes the preceding nodes as its inputs. Shapes and dtypes are
+// inferred when the ops are recorded, and DimensionError or DtypeError is thrown for invalid ones.
+class RecordedGraph {
+public:
+    GraphNodeId AddInput(const Shape& shape, Dtype dtype);
+
+    // Records an array whose value is fixed. The array is stored without its computation graph.
+    GraphNodeId AddConstant(const Array& value);
+
+    GraphNodeId Negative(GraphNodeId x);
+    GraphNodeId Exp(GraphNodeId x);
+    GraphNodeId Log(GraphNodeId x);
+    GraphNodeId Add(GraphNodeId x1, GraphNodeId x2);
+    GraphNodeId Subtract(GraphNodeId x1, GraphNodeId x2);
+    GraphNodeId Multiply(GraphNodeId x1, GraphNodeId x2);
+    GraphNodeId Divide(GraphNodeId x1, GraphNodeId x2);
+    GraphNodeId AddScalar(GraphNodeId x1, Scalar x2);
+    GraphNodeId MultiplyScalar(GraphNodeId x1, Scalar x2);
+    GraphNodeId Dot(GraphNodeId a, GraphNodeId b);
+    GraphNodeId Sum(GraphNodeId a, const OptionalAxes& axis = nonstd::nullopt, bool keepdims = false);
+    GraphNodeId Transpose(GraphNodeId a, const OptionalAxes& axes = nonstd::nullopt);
+    GraphNodeId Reshape(GraphNodeId a, const Shape& newshape);
+
+    void AddOutput(GraphNodeId node, bool requires_grad = true);
+
+    // Throws DimensionError or DtypeError if the inputs do not match the recorded ones.
+    void CheckInputs(const std::vector<Array>& inputs) const;
+
+    // Runs the recorded ops on the inputs and returns the outputs.
+    // Throws DimensionError or DtypeError if the inputs do not match the recorded ones.
+    std::vector<Array> Execute(const std::vector<Array>& inputs) const;
+
+    // Evaluates a node whose inputs are already evaluated.
+    static Array Evaluate(const GraphNode& node, const std::vector<Array>& inputs);
+
+    const std::vector<GraphNode>& nodes() const { return nodes_; }
+
+    const std::vector<GraphOutput>& outputs() const { return outputs_; }
+
+    size_t input_count() const { return input_count_; }
+
+    // The following functions are for graph rewrites.
+
+    GraphNode& node(GraphNodeId id) { return nodes_.at(id); }
+
+    // Makes all the nodes and the outputs which refer to `from` refer to `to` instead. `to` must precede `from`.
+    void ReplaceAllUsesWith(GraphNodeId from, GraphNodeId to);
+
+    // Removes the flagged nodes, which must not be referred to by the rest, and renumbers the rest.
+    void RemoveNodes(const std::vector<bool>& is_removed);
+
+    // Returns the number of references to each node from the nodes and the outputs.
+    std::vector<size_t> GetUseCounts() const;
+
+private:
+    GraphNodeId AddNode(GraphNode node);
+
+    GraphNodeId AddUnary(GraphOpKind kind, GraphNodeId x);
+
+    GraphNodeId AddBinary(GraphOpKind kind, GraphNodeId x1, GraphNodeId x2);
+
+    const GraphNode& GetInputNode(GraphNodeId id) const;
+
+    std::vector<GraphNode> nodes_;
+    std::vector<GraphOutput> outputs_;
+    size_t input_count_{0};
+};
+
+}  // namespace chainerx
@@ -0,0 +1,107 @@
+#include "chainerx/recorded_graph.h"
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "chainerx/array.h"
+#include "chainerx/backward.h"
+#include "chainerx/device_id.h"
+#include "chainerx/dtype.h"
+#include "chainerx/error.h"
+#include "chainerx/native/native_backend.h"
+#include "chainerx/routines/creation.h"
+#include "chainerx/routines/linalg.h"
+#include "chainerx/routines/manipulation.h"
+#include "chainerx/routines/math.h"
+#include "chainerx/shape.h"
+#include "chainerx/testing/array.h"
+#include "chainerx/testing/array_check.h"
+#include "chainerx/testing/device_session.h"
+
+namespace chainerx {
+namespace {
+
+TEST(RecordedGraphTest, Execute) {
+    testing::DeviceSession device_session{DeviceId{native::NativeBackend::kDefaultName, 0}};
+    Array c = testing::BuildArray({3}).WithLinearData<float>(1.f);
+
+    RecordedGraph graph{};
+    GraphNodeId x = graph.AddInput({2, 3}, Dtype::kFloat32);
+    GraphNodeId w = graph.AddInput({3, 4}, Dtype::kFloat32);
+    GraphNodeId h = graph.Add(graph.MultiplyScalar(graph.Exp(x), 2.f), graph.AddConstant(c));
+    GraphNodeId y = graph.Sum(graph.Reshape(graph.Transpose(graph.Dot(h, w)), {-1, 2}), Axes{0}, true);
+    graph.AddOutput(y);
+    EXPECT_EQ(size_t{2}, graph.input_count());
+    EXPECT_EQ(Shape({1, 2}), graph.nodes()[y].shape);
+    EXPECT_EQ(Dtype::kFloat32, graph.nodes()[y].dtype);
+
+    Array x1 = (*testing::BuildArray({2, 3}).WithLinearData<float>(-1.f, 0.25f)).RequireGrad();
+    Array w1 = (*testing::BuildArray({3, 4}).WithLinearData<float>(0.5f, -0.125f)).RequireGrad();
+    Array x2 = x1.AsGradStopped().RequireGrad();
+    Array w2 = w1.AsGradStopped().RequireGrad();
+
+    std::vector<Array> ys = graph.Execute({x1, w1});
+    ASSERT_EQ(size_t{1}, ys.size());
+    Backward(ys[0]);
+
+    Array expected_y = Sum(Reshape(Transpose(Dot(Exp(x2) * 2.f + c, w2)), {4, 2}), Axes{0}, true);
+    Backward(expected_y);
+
+    EXPECT_ARRAY_ALL_CLOSE(expected_y, ys[0]);
+    EXPECT_ARRAY_ALL_CLOSE(*x2.GetGrad(), *x1.GetGrad());
+    EXPECT_ARRAY_ALL_CLOSE(*w2.GetGrad(), *w1.GetGrad());
+}
+
+TEST(RecordedGraphTest, ConstantOutput) {
+    testing::DeviceSession device_session{DeviceId{native::NativeBackend::kDefaultName, 0}};
+    Array c = testing::BuildArray({3}).WithLinearData<float>(1.f);
+
+    RecordedGraph graph{};
+    graph.AddInput({3}, Dtype::kFloat32);
+    graph.AddOutput(graph.AddConstant(c));
+
+    Array x = Zeros({3}, Dtype::kFloat32);
+    std::vector<Array> ys1 = graph.Execute({x});
+    std::vector<Array> ys2 = graph.Execute({x});
+    EXPECT_ARRAY_EQ(c, ys1[0]);
+    EXPECT_NE(ys1[0].data(), ys2[0].data());
+    EXPECT_NE(c.data(), ys1[0].data());
+
+    // Modifying an output affects neither the graph nor the other outputs.
+    ys1[0] += Ones({3}, Dtype::kFloat32);
+    EXPECT_ARRAY_EQ(c, ys2[0]);
+    EXPECT_ARRAY_EQ(c, graph.Execute({x})[0]);
+}
+
+TEST(RecordedGraphTest, InvalidInputs) {
+    testing::DeviceSession device_session{DeviceId{native::NativeBackend::kDefaultName, 0}};
+    RecordedGraph graph{};
+    GraphNodeId x = graph.AddInput({2, 3}, Dtype::kFloat32);
+    graph.AddOutput(graph.Exp(x));
+
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>();
+    EXPECT_THROW(graph.Execute({}), DimensionError);
+    EXPECT_THROW(graph.Execute({Reshape(a, {3, 2})}), DimensionError);
+    EXPECT_THROW(graph.Execute({a.AsType(Dtype::kFloat64)}), DtypeError);
+}
+
+TEST(RecordedGraphTest, InvalidOps) {
+    RecordedGraph graph{};
+    GraphNodeId x = graph.AddInput({2, 3}, Dtype::kFloat32);
+    GraphNodeId y = graph.AddInput({3, 2}, Dtype::kFloat32);
+    GraphNodeId z = graph.AddInput({2, 3}, Dtype::kFloat64);
+
+    EXPECT_THROW(graph.Add(x, y), DimensionError);
+    EXPECT_THROW(graph.Add(x, z), DtypeError);
+    EXPECT_THROW(graph.Dot(x, x), DimensionError);
+    EXPECT_THROW(graph.Transpose(x, Axes{0, 0}), DimensionError);
+    EXPECT_THROW(graph.Reshape(x, {4, -1}), DimensionError);
+    EXPECT_THROW(graph.Reshape(x, {0, -1}), DimensionError);
+    EXPECT_THROW(graph.Exp(100), ChainerxError);
+    EXPECT_EQ(Shape({3, 2}), graph.nodes()[graph.Reshape(x, {3, -1})].shape);
+    EXPECT_EQ(Dtype::kInt64, graph.nodes()[graph.Sum(graph.AddInput({2}, Dtype::kInt32))].dtype);
+}
+
+}  // namespace
+}  // namespace chainerx
@@ -16,6 +16,7 @@
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
 #include "chainerx/macro.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/linalg.h"
 #include "chainerx/routines/math.h"
@@ -57,6 +58,7 @@ Array ConvGradW(
         const StackVector<int64_t, kMaxNdim>& stride,
         const StackVector<int64_t, kMaxNdim>& pad,
         bool cover_all) {
+    ProfileRange profile_range{"routine", "conv-grad-weight", {x, gy}};
     CHAINERX_ASSERT(w_shape.ndim() > 2);
     CHAINERX_ASSERT(x.ndim() == w_shape.ndim());
     CHAINERX_ASSERT(gy.ndim() == w_shape.ndim());
@@ -121,6 +123,10 @@ Array Conv(
         const StackVector<int64_t, kMaxNdim>& stride,
         const StackVector<int64_t, kMaxNdim>& pad,
         bool cover_all) {
+    ProfileRange profile_range{"routine", "conv", {x, w}};
+    if (profile_range.is_active() && b.has_value()) {
+        profile_range.AddInputShape(b->shape());
+    }
     ConvCheckNdim(x, w, stride, pad);
     if (w.shape()[1] != x.shape()[1]) {
         throw DimensionError{"Mismatched number of input channels in input ", x.shape(), " and weights ", w.shape(), "."};
@@ -187,6 +193,10 @@ Array ConvTranspose(
         const StackVector<int64_t, kMaxNdim>& stride,
         const StackVector<int64_t, kMaxNdim>& pad,
         const nonstd::optional<StackVector<int64_t, kMaxNdim>>& out_size) {
+    ProfileRange profile_range{"routine", "conv_transpose", {x, w}};
+    if (profile_range.is_active() && b.has_value()) {
+        profile_range.AddInputShape(b->shape());
+    }
     ConvCheckNdim(x, w, stride, pad);
     if (x.shape()[1] != w.shape()[0]) {
         throw DimensionError{"Mismatched number of input channels in input ", x.shape(), " and weights ", w.shape(), "."};
@@ -308,6 +318,10 @@ void LinearGradWeight(BackwardBuilder& bb) {
 }  // namespace
 
 Array Linear(const Array& x, const Array& w, const nonstd::optional<Array>& b, uint8_t n_batch_axes) {
+    ProfileRange profile_range{"routine", "linear", {x, w}};
+    if (profile_range.is_active() && b.has_value()) {
+        profile_range.AddInputShape(b->shape());
+    }
     n_batch_axes = internal::NormalizeAxis(n_batch_axes, x.ndim());
 
     // TODO(imanishi): dtype conversion
@@ -18,6 +18,7 @@
 #include "chainerx/dtype.h"
 #include "chainerx/graph.h"
 #include "chainerx/macro.h"
+#include "chainerx/profiler.h"
 #include "chainerx/scalar.h"
 #include "chainerx/shape.h"
 #include "chainerx/strides.h"
@@ -91,6 +92,7 @@ Array Empty(const Shape& shape, Dtype dtype, Device& device) {
 }
 
 Array Full(const Shape& shape, Scalar fill_value, Dtype dtype, Device& device) {
+    ProfileRange profile_range{"routine", "full"};
     Array array = Empty(shape, dtype, device);
     array.Fill(fill_value);
     return array;
@@ -103,6 +105,7 @@ Array Zeros(const Shape& shape, Dtype dtype, Device& device) { return Full(shape
 Array Ones(const Shape& shape, Dtype dtype, Device& device) { return Full(shape, 1, dtype, device); }
 
 Array Arange(Scalar start, Scalar stop, Scalar step, Dtype dtype, Device& device) {
+    ProfileRange profile_range{"routine", "arange"};
     // TODO(hvy): Simplify comparison if Scalar::operator== supports dtype conversion.
     if (step == Scalar{0, step.dtype()}) {
         throw ChainerxError("Cannot create an arange array with 0 step size.");
@@ -151,6 +154,7 @@ Array ZerosLike(const Array& a, Device& device) { return Zeros(a.shape(), a.dtyp
 Array OnesLike(const Array& a, Device& device) { return Ones(a.shape(), a.dtype(), device); }
 
 Array Copy(const Array& a) {
+    ProfileRange profile_range{"routine", "copy", {a}};
     Array out = EmptyLike(a, a.device());
     {
         NoBackpropModeScope scope{};
@@ -169,6 +173,7 @@ Array Copy(const Array& a) {
 
 // Creates the identity array.
 Array Identity(int64_t n, Dtype dtype, Device& device) {
+    ProfileRange profile_range{"routine", "identity"};
     if (n < 0) {
         throw DimensionError{"Negative dimensions are not allowed"};
     }
@@ -182,6 +187,7 @@ Array Identity(int64_t n, Dtype dtype, Device& device) {
 }
 
 Array Eye(int64_t n, nonstd::optional<int64_t> m, nonstd::optional<int64_t> k, nonstd::optional<Dtype> dtype, Device& device) {
+    ProfileRange profile_range{"routine", "eye"};
     if (!m.has_value()) {
         m = n;
     }
@@ -206,6 +212,7 @@ Array Eye(int64_t n, nonstd::optional<int64_t> m, nonstd::optional<int64_t> k, n
 namespace internal {
 
 Array AsContiguous(const Array& a, Dtype dtype) {
+    ProfileRange profile_range{"routine", "ascontiguousarray", {a}};
     if (a.IsContiguous() && a.dtype() == dtype) {
         return a;
     }
@@ -254,6 +261,7 @@ Array AsContiguousArray(const Array& a, const nonstd::optional<Dtype>& dtype) {
 }
 
 Array Diag(const Array& v, int64_t k, Device& device) {
+    ProfileRange profile_range{"routine", "diag", {v}};
     Array out{};
 
     int8_t ndim = v.ndim();
@@ -300,6 +308,7 @@ Array Diag(const Array& v, int64_t k, Device& device) {
 }
 
 Array Diagflat(const Array& v, int64_t k, Device& device) {
+    ProfileRange profile_range{"routine", "diagflat", {v}};
     // TODO(hvy): Use Ravel or Flatten when implemented instead of Reshape.
     return Diag(v.Reshape({v.GetTotalSize()}), k, device);
 }
@@ -312,6 +321,7 @@ Array Linspace(
         bool endpoint,
         const nonstd::optional<Dtype>& dtype,
         Device& device) {
+    ProfileRange profile_range{"routine", "linspace"};
     static const int64_t kDefaultNum = 50;
 
     // TODO(niboshi): Determine dtype_a from both dtypes of start and stop.
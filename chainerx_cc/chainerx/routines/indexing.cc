@@ -18,6 +18,7 @@
 #include "chainerx/dtype.h"
 #include "chainerx/graph.h"
 #include "chainerx/macro.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/shape.h"
 #include "chainerx/slice.h"
@@ -32,6 +33,7 @@ namespace {
 // It is not in-place  operation: the input arrays are not altered.
 // It is differentiable with respect to `a` and `b`.
 Array AddAt(const Array& a, const std::vector<ArrayIndex>& indices, const Array& b) {
+    ProfileRange profile_range{"routine", "add_at", {a, b}};
     // TODO(sonots): dtype conversion
     CheckEqual(a.dtype(), b.dtype());
 
@@ -63,6 +65,7 @@ Array AddAt(const Array& a, const std::vector<ArrayIndex>& indices, const Array&
 }  // namespace
 
 Array At(const Array& a, const std::vector<ArrayIndex>& indices) {
+    ProfileRange profile_range{"routine", "get_item", {a}};
     Shape out_shape{};
     Strides out_strides{};
     int64_t out_offset = a.offset();
@@ -125,6 +128,7 @@ namespace {
 // It is not in-place operation: the input arrays are not altered.
 // It is differentiable with respect to `a` and `b`.
 Array AddAt(const Array& a, const Array& indices, int8_t axis, const Array& b) {
+    ProfileRange profile_range{"routine", "add_at", {a, indices, b}};
     CHAINERX_ASSERT(0 <= axis && axis < a.ndim());
     CHAINERX_ASSERT(b.ndim() == indices.ndim() + a.ndim() - 1);
     CheckEqual(a.dtype(), b.dtype());
@@ -156,6 +160,7 @@ Array AddAt(const Array& a, const Array& indices, int8_t axis, const Array& b) {
 }  // namespace
 
 Array Take(const Array& a, const Array& indices, int8_t axis) {
+    ProfileRange profile_range{"routine", "take", {a, indices}};
     // TODO(niboshi): Support other dtypes by casting
     if (indices.dtype() != Dtype::kInt64) {
         throw DtypeError(
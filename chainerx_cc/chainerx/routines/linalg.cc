@@ -12,16 +12,18 @@
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/creation.h"
+#include "chainerx/routines/math.h"
+#include "chainerx/routines/routines_util.h"
 #include "chainerx/shape.h"
 
 namespace chainerx {
 
-Array Dot(const Array& a, const Array& b) {
-    if (a.ndim() == 0 || b.ndim() == 0) {
-        return a * b;
-    }
+namespace {
 
+// Returns the shape of the result of Dot, checking the operands.
+Shape GetDotOutputShape(const Array& a, const Array& b) {
     // TODO(beam2d): dtype conversion
     CheckEqual(a.dtype(), b.dtype());
 
@@ -34,47 +36,88 @@ Array Dot(const Array& a, const Array& b) {
     std::copy(a.shape().begin(), a.shape().end() - 1, std::back_inserter(out_shape));
     std::copy(b.shape().begin() + 1, b.shape().end(), std::back_inserter(out_shape));
 
-    int64_t k = a.shape()[a.ndim() - 1];
-    if (b.shape()[0] != k) {
+    if (b.shape()[0] != a.shape()[a.ndim() - 1]) {
         throw DimensionError{"Axis dimension mismatch"};
     }
+    return out_shape;
+}
+
+// Computes the matrix product of non-scalar operands a and b into out, which must have the shape returned by GetDotOutputShape.
+void DotImpl(const Array& a, const Array& b, const Array& out) {
+    int64_t k = a.shape()[a.ndim() - 1];
     if (k == 0) {
-        return Zeros(out_shape, a.dtype(), a.device());
+        out.Fill(0);
+        return;
     }
 
     // Make each operand a matrix
     int64_t m = a.GetTotalSize() / k;
     int64_t n = b.GetTotalSize() / k;
-    Array a_matrix = a.Reshape({m, k});
-    Array b_matrix = b.Reshape({k, n});
 
     // Matrix-matrix product
-    Array out_matrix = Empty({m, n}, a.dtype(), a.device());
     {
         NoBackpropModeScope scope{};
-        a.device().Dot(a_matrix, b_matrix, out_matrix);
+        Array a_matrix = a.Reshape({m, k});
+        Array b_matrix = b.Reshape({k, n});
+        if (out.ndim() == 2) {
+            a.device().Dot(a_matrix, b_matrix, out);
+        } else if (out.IsContiguous()) {
+            // Reshaping a contiguous array makes a view, so the result is written directly to out.
+            a.device().Dot(a_matrix, b_matrix, out.Reshape({m, n}));
+        } else {
+            Array out_matrix = Empty({m, n}, out.dtype(), out.device());
+            a.device().Dot(a_matrix, b_matrix, out_matrix);
+            out.device().Copy(out_matrix.Reshape(out.shape()), out);
+        }
     }
 
     {
-        BackwardBuilder bb{"dot", {a_matrix, b_matrix}, out_matrix};
+        BackwardBuilder bb{"dot", {a, b}, out};
         if (BackwardBuilder::Target bt = bb.CreateTarget(0)) {
-            bt.Define([b_matrix_tok = bb.RetainInput(1)](BackwardContext& bctx) {
-                const Array& b_matrix = bctx.GetRetainedInput(b_matrix_tok);
+            bt.Define([b_tok = bb.RetainInput(1), a_shape = a.shape(), m, k, n](BackwardContext& bctx) {
+                const Array& b = bctx.GetRetainedInput(b_tok);
                 const Array& gout = *bctx.output_grad();
-                bctx.input_grad() = Dot(gout, b_matrix.Transpose());
+                bctx.input_grad() = Dot(gout.Reshape({m, n}), b.Reshape({k, n}).Transpose()).Reshape(a_shape);
             });
         }
         if (BackwardBuilder::Target bt = bb.CreateTarget(1)) {
-            bt.Define([a_matrix_tok = bb.RetainInput(0)](BackwardContext& bctx) {
-                const Array& a_matrix = bctx.GetRetainedInput(a_matrix_tok);
+            bt.Define([a_tok = bb.RetainInput(0), b_shape = b.shape(), m, k, n](BackwardContext& bctx) {
+                const Array& a = bctx.GetRetainedInput(a_tok);
                 const Array& gout = *bctx.output_grad();
-                bctx.input_grad() = Dot(a_matrix.Transpose(), gout);
+                bctx.input_grad() = Dot(a.Reshape({m, k}).Transpose(), gout.Reshape({m, n})).Reshape(b_shape);
             });
         }
         bb.Finalize();
     }
+}
+
+}  // namespace
+
+Array Dot(const Array& a, const Array& b) {
+    ProfileRange profile_range{"routine", "dot", {a, b}};
+    if (a.ndim() == 0 || b.ndim() == 0) {
+        return a * b;
+    }
 
-    return out_matrix.Reshape(out_shape);
+    Array out = Empty(GetDotOutputShape(a, b), a.dtype(), a.device());
+    DotImpl(a, b, out);
+    return out;
+}
+
+void Dot(const Array& a, const Array& b, const Array& out) {
+    ProfileRange profile_range{"routine", "dot", {a, b}};
+    if (a.ndim() == 0 || b.ndim() == 0) {
+        Multiply(a, b, out);
+        return;
+    }
+
+    internal::CheckOutput(out, GetDotOutputShape(a, b), a.dtype(), a.device());
+    internal::CheckNoUnsafeInplace(out, {a, b});
+    // The device may overwrite the output before reading all the operands.
+    if (internal::GetArrayBody(out) == internal::GetArrayBody(a) || internal::GetArrayBody(out) == internal::GetArrayBody(b)) {
+        throw ChainerxError{"Output array of dot must not be identical to any of the operands."};
+    }
+    DotImpl(a, b, out);
 }
 
 }  // namespace chainerx
@@ -6,4 +6,8 @@ namespace chainerx {
 
 Array Dot(const Array& a, const Array& b);
 
+// Writes the result to the given output array instead of allocating a new one.
+// The output array must have the shape of the result and the same dtype and device as the operands.
+void Dot(const Array& a, const Array& b, const Array& out);
+
 }  // namespace chainerx
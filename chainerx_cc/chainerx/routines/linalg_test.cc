@@ -77,6 +77,59 @@ TEST_P(LinalgTest, DotAlongZeroLengthAxis) {
     EXPECT_ARRAY_EQ(e, c);
 }
 
+TEST_P(LinalgTest, DotOut) {
+    Array a = testing::BuildArray({2, 3}).WithLinearData(1.f).WithPadding(1);
+    Array b = testing::BuildArray({3, 2}).WithData<float>({1.f, 2.f, -1.f, -3.f, 2.f, 4.f}).WithPadding(2);
+    Array out = Empty({2, 2}, Dtype::kFloat32);
+    Dot(a, b, out);
+    Array e = testing::BuildArray({2, 2}).WithData<float>({5.f, 8.f, 11.f, 17.f});
+    EXPECT_ARRAY_EQ(e, out);
+}
+
+TEST_P(LinalgTest, DotOutMatVec) {
+    Array a = testing::BuildArray({2, 3}).WithLinearData(1.f);
+    Array b = testing::BuildArray({3}).WithLinearData(1.f, 2.f);
+    Array e = testing::BuildArray({2}).WithData<float>({22.f, 49.f});
+    {
+        Array out = Empty({2}, Dtype::kFloat32);
+        Dot(a, b, out);
+        EXPECT_ARRAY_EQ(e, out);
+    }
+    {
+        Array out = testing::BuildArray({2}).WithLinearData<float>().WithPadding(1);
+        ASSERT_FALSE(out.IsContiguous());
+        Dot(a, b, out);
+        EXPECT_ARRAY_EQ(e, out);
+    }
+}
+
+TEST_P(LinalgTest, DotOutInvalid) {
+    Array a = Zeros({2, 3}, Dtype::kFloat32);
+    Array b = Zeros({3, 2}, a.dtype());
+    EXPECT_THROW(Dot(a, b, Empty({3, 2}, a.dtype())), DimensionError);
+    EXPECT_THROW(Dot(a, b, Empty({2, 2}, Dtype::kFloat64)), DtypeError);
+    EXPECT_THROW(Dot(a, Zeros({3, 3}, a.dtype()), a), ChainerxError);
+}
+
+TEST_P(LinalgTest, DotOutBackward) {
+    Array a = (*testing::BuildArray({2, 3}).WithLinearData(1.f)).RequireGrad();
+    Array b = (*testing::BuildArray({3}).WithData<float>({1.f, 2.f, -1.f})).RequireGrad();
+
+    Array go = testing::BuildArray({2}).WithData<float>({-0.1f, 0.1f}).WithPadding(1);
+    Array a_eps = Full(a.shape(), 1e-1f);
+    Array b_eps = Full(b.shape(), 1e-1f);
+
+    CheckBackward(
+            [](const std::vector<Array>& xs) -> std::vector<Array> {
+                Array out = Empty({2}, xs[0].dtype(), xs[0].device());
+                Dot(xs[0], xs[1], out);
+                return {out};
+            },
+            {a, b},
+            {go},
+            {a_eps, b_eps});
+}
+
 TEST_P(LinalgTest, DotBackward) {
     Array a = (*testing::BuildArray({2, 3}).WithLinearData(1.f)).RequireGrad();
     Array b = (*testing::BuildArray({3, 2}).WithData<float>({1.f, 2.f, -1.f, -3.f, 2.f, 4.f})).RequireGrad();
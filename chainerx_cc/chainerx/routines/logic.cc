@@ -4,6 +4,7 @@
 #include "chainerx/backprop_mode.h"
 #include "chainerx/device.h"
 #include "chainerx/dtype.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/manipulation.h"
 #include "chainerx/shape.h"
@@ -39,42 +40,49 @@ Array BroadcastComparison(Impl&& impl, const Array& x1, const Array& x2) {
 }  // namespace
 
 Array Equal(const Array& x1, const Array& x2) {
+    ProfileRange profile_range{"routine", "equal", {x1, x2}};
     CheckEqual(x1.dtype(), x2.dtype());
     auto func = [](const Array& x1, const Array& x2, Array& out) { return x1.device().Equal(x1, x2, out); };
     return BroadcastComparison(func, x1, x2);
 }
 
 Array NotEqual(const Array& x1, const Array& x2) {
+    ProfileRange profile_range{"routine", "not_equal", {x1, x2}};
     CheckEqual(x1.dtype(), x2.dtype());
     auto func = [](const Array& x1, const Array& x2, Array& out) { return x1.device().NotEqual(x1, x2, out); };
     return BroadcastComparison(func, x1, x2);
 }
 
 Array Greater(const Array& x1, const Array& x2) {
+    ProfileRange profile_range{"routine", "greater", {x1, x2}};
     CheckEqual(x1.dtype(), x2.dtype());
     auto func = [](const Array& x1, const Array& x2, Array& out) { return x1.device().Greater(x1, x2, out); };
     return BroadcastComparison(func, x1, x2);
 }
 
 Array GreaterEqual(const Array& x1, const Array& x2) {
+    ProfileRange profile_range{"routine", "greater_equal", {x1, x2}};
     CheckEqual(x1.dtype(), x2.dtype());
     auto func = [](const Array& x1, const Array& x2, Array& out) { return x1.device().GreaterEqual(x1, x2, out); };
     return BroadcastComparison(func, x1, x2);
 }
 
 Array Less(const Array& x1, const Array& x2) {
+    ProfileRange profile_range{"routine", "less", {x1, x2}};
     CheckEqual(x1.dtype(), x2.dtype());
     auto func = [](const Array& x1, const Array& x2, Array& out) { return x1.device().Greater(x2, x1, out); };
     return BroadcastComparison(func, x1, x2);
 }
 
 Array LessEqual(const Array& x1, const Array& x2) {
+    ProfileRange profile_range{"routine", "less_equal", {x1, x2}};
     CheckEqual(x1.dtype(), x2.dtype());
     auto func = [](const Array& x1, const Array& x2, Array& out) { return x1.device().GreaterEqual(x2, x1, out); };
     return BroadcastComparison(func, x1, x2);
 }
 
 Array LogicalNot(const Array& x1) {
+    ProfileRange profile_range{"routine", "logical_not", {x1}};
     Array out = Empty(x1.shape(), Dtype::kBool, x1.device());
     {
         NoBackpropModeScope scope{};
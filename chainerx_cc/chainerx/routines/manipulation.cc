@@ -21,6 +21,7 @@
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
 #include "chainerx/macro.h"
+#include "chainerx/profiler.h"
 #include "chainerx/shape.h"
 #include "chainerx/strides.h"
 
@@ -73,6 +74,7 @@ Array RollAxis(const Array& a, int8_t axis, int8_t start) {
 }
 
 Array Transpose(const Array& a, const OptionalAxes& axes) {
+    ProfileRange profile_range{"routine", "transpose", {a}};
     Axes real_axes;
     if (axes.has_value()) {
         if (axes->ndim() != a.ndim()) {
@@ -111,13 +113,8 @@ Array Transpose(const Array& a, const OptionalAxes& axes) {
     return out;
 }
 
-namespace {
+namespace internal {
 
-// Returns a shape where the length of at most one dimension is inferred from the total size and the remaining dimensions.
-// Such a dimension is given by a negative length, i.e. Shape{2, 3, -1}.
-// If the given shape does not contain such a dimension, this function will return a copy of the given shape.
-// If there exists multiple negative lengths or if the negative length dimension cannot be inferred due to non divisbility, an
-// DimensionError is thrown.
 Shape GetInferredShape(const Shape& shape, int64_t total_size) {
     Shape inferred_shape = shape;
 
@@ -128,6 +125,9 @@ Shape GetInferredShape(const Shape& shape, int64_t total_size) {
         }
         int64_t rest_size = std::accumulate(inferred_shape.begin(), it, int64_t{1}, std::multiplies<>()) *
                             std::accumulate(std::next(it), inferred_shape.end(), int64_t{1}, std::multiplies<>());
+        if (rest_size == 0) {
+            throw DimensionError{"Cannot reshape array of size ", total_size, " into shape ", shape};
+        }
         *it = total_size / rest_size;
     }
 
@@ -137,9 +137,10 @@ Shape GetInferredShape(const Shape& shape, int64_t total_size) {
     return inferred_shape;
 }
 
-}  // namespace
+}  // namespace internal
 
 Array Reshape(const Array& a, const Shape& newshape) {
+    ProfileRange profile_range{"routine", "reshape", {a}};
     const Shape& in_shape = a.shape();
     const Strides& in_strides = a.strides();
 
@@ -150,7 +151,7 @@ Array Reshape(const Array& a, const Shape& newshape) {
 
     // Check for invalid shape.
     int64_t total_size = in_shape.GetTotalSize();
-    Shape out_shape = GetInferredShape(newshape, total_size);
+    Shape out_shape = internal::GetInferredShape(newshape, total_size);
     int64_t item_size = a.GetItemSize();
     Strides strides{};
     if (total_size == 0) {
@@ -247,6 +248,7 @@ Array Reshape(const Array& a, const Shape& newshape) {
 }
 
 Array Squeeze(const Array& a, const OptionalAxes& axis) {
+    ProfileRange profile_range{"routine", "squeeze", {a}};
     const Shape& in_shape = a.shape();
     const Strides& in_strides = a.strides();
 
@@ -303,6 +305,7 @@ Array Squeeze(const Array& a, const OptionalAxes& axis) {
 }
 
 Array BroadcastTo(const Array& array, const Shape& shape) {
+    ProfileRange profile_range{"routine", "broadcast_to", {array}};
     const Shape& in_shape = array.shape();
     const Strides& in_strides = array.strides();
 
@@ -384,6 +387,12 @@ Array BroadcastTo(const Array& array, const Shape& shape) {
 namespace {
 
 Array ConcatenateImpl(const std::vector<Array>& arrays, int8_t axis) {
+    ProfileRange profile_range{"routine", "concatenate"};
+    if (profile_range.is_active()) {
+        for (const Array& array : arrays) {
+            profile_range.AddInputShape(array.shape());
+        }
+    }
     if (arrays.empty()) {
         throw DimensionError{"Need at least one array to concatenate"};
     }
@@ -475,6 +484,7 @@ Array Concatenate(const std::vector<Array>& arrays, nonstd::optional<int8_t> axi
 
 namespace {
 std::vector<Array> StackGrad(const Array& gout, int8_t axis) {
+    ProfileRange profile_range{"routine", "stack-grad", {gout}};
     Shape shape{gout.shape()};
     Strides strides{gout.strides()};
     size_t dim = shape[axis];
@@ -516,6 +526,12 @@ std::vector<Array> StackGrad(const Array& gout, int8_t axis) {
 }  // namespace
 
 Array Stack(const std::vector<Array>& arrays, int8_t axis) {
+    ProfileRange profile_range{"routine", "stack"};
+    if (profile_range.is_active()) {
+        for (const Array& array : arrays) {
+            profile_range.AddInputShape(array.shape());
+        }
+    }
     if (arrays.empty()) {
         throw DimensionError{"Need at least one array to stack"};
     }
@@ -610,6 +626,7 @@ void DefineSplitBackward(const Array& ary, const std::vector<Array>& out, int8_t
 }  // namespace
 
 std::vector<Array> Split(const Array& ary, int64_t sections, int8_t axis) {
+    ProfileRange profile_range{"routine", "split", {ary}};
     if (sections < 1) {
         throw DimensionError("Number of sections must be larger than 0.");
     }
@@ -642,6 +659,7 @@ std::vector<Array> Split(const Array& ary, int64_t sections, int8_t axis) {
 }
 
 std::vector<Array> Split(const Array& ary, std::vector<int64_t> indices, int8_t axis) {
+    ProfileRange profile_range{"routine", "split", {ary}};
     const Shape& in_shape = ary.shape();
     int8_t axis_norm = internal::NormalizeAxis(axis, ary.ndim());
     int64_t in_dim = in_shape[axis_norm];
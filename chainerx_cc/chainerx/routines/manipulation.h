@@ -22,6 +22,15 @@ Array RollAxis(const Array& a, int8_t axis, int8_t start = 0);
 // Returns a transposed view of the array.
 Array Transpose(const Array& a, const OptionalAxes& axes = nonstd::nullopt);
 
+namespace internal {
+
+// Returns a shape where the length of at most one dimension is inferred from the total size and the remaining dimensions.
+// Such a dimension is given by a negative length, i.e. Shape{2, 3, -1}.
+// DimensionError is thrown if the shape cannot be inferred or does not match the total size.
+Shape GetInferredShape(const Shape& shape, int64_t total_size);
+
+}  // namespace internal
+
 // Returns a reshaped array.
 Array Reshape(const Array& a, const Shape& newshape);
 
@@ -16,6 +16,7 @@
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
 #include "chainerx/macro.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/routines/manipulation.h"
 #include "chainerx/routines/routines_util.h"
@@ -67,6 +68,18 @@ void BroadcastBinaryInPlace(Impl&& impl, const Array& x1, const Array& x2) {
     }
 }
 
+// Called from Add, Subtract, Multiply, Divide, etc. to handle broadcasting, writing the result to the given output array.
+template <typename Impl>
+void BroadcastBinaryToOut(Impl&& impl, const Array& x1, const Array& x2, const Array& out) {
+    // TODO(hvy): Use type promotion for output.
+    Shape result_shape = x1.shape() == x2.shape() ? x1.shape() : internal::BroadcastShapes(x1.shape(), x2.shape());
+    internal::CheckOutput(out, result_shape, x1.dtype(), x1.device());
+    internal::CheckNoUnsafeInplace(out, {x1, x2});
+    impl(x1.shape() == result_shape ? x1 : x1.BroadcastTo(result_shape),
+         x2.shape() == result_shape ? x2 : x2.BroadcastTo(result_shape),
+         out);
+}
+
 template <typename Impl>
 Array Binary(Impl&& impl, const Array& x1, Scalar x2) {
     // TODO(hvy): Use type promotion for output.
@@ -75,6 +88,14 @@ Array Binary(Impl&& impl, const Array& x1, Scalar x2) {
     return out;
 }
 
+template <typename Impl>
+void BinaryToOut(Impl&& impl, const Array& x1, Scalar x2, const Array& out) {
+    // TODO(hvy): Use type promotion for output.
+    internal::CheckOutput(out, x1.shape(), x1.dtype(), x1.device());
+    internal::CheckNoUnsafeInplace(out, {x1});
+    impl(x1, x2, out);
+}
+
 template <typename Impl>
 void BinaryInPlace(Impl&& impl, const Array& x1, Scalar x2) {
     internal::CheckNoUnsafeInplace(x1, {x1});
@@ -122,15 +143,37 @@ void AddASImpl(const Array& x1, Scalar x2, const Array& out) {
 
 namespace internal {
 
-void IAdd(const Array& x1, const Array& x2) { BroadcastBinaryInPlace(&AddImpl, x1, x2); }
+void IAdd(const Array& x1, const Array& x2) {
+    ProfileRange profile_range{"routine", "add", {x1, x2}};
+    BroadcastBinaryInPlace(&AddImpl, x1, x2);
+}
 
-void IAdd(const Array& x1, Scalar x2) { BinaryInPlace(&AddASImpl, x1, x2); }
+void IAdd(const Array& x1, Scalar x2) {
+    ProfileRange profile_range{"routine", "add_scalar", {x1}};
+    BinaryInPlace(&AddASImpl, x1, x2);
+}
 
 }  // namespace internal
 
-Array Add(const Array& x1, const Array& x2) { return BroadcastBinary(&AddImpl, x1, x2); }
+Array Add(const Array& x1, const Array& x2) {
+    ProfileRange profile_range{"routine", "add", {x1, x2}};
+    return BroadcastBinary(&AddImpl, x1, x2);
+}
+
+Array Add(const Array& x1, Scalar x2) {
+    ProfileRange profile_range{"routine", "add_scalar", {x1}};
+    return Binary(&AddASImpl, x1, x2);
+}
+
+void Add(const Array& x1, const Array& x2, const Array& out) {
+    ProfileRange profile_range{"routine", "add", {x1, x2}};
+    BroadcastBinaryToOut(&AddImpl, x1, x2, out);
+}
 
-Array Add(const Array& x1, Scalar x2) { return Binary(&AddASImpl, x1, x2); }
+void Add(const Array& x1, Scalar x2, const Array& out) {
+    ProfileRange profile_range{"routine", "add_scalar", {x1}};
+    BinaryToOut(&AddASImpl, x1, x2, out);
+}
 
 Array Add(Scalar x1, const Array& x2) { return Add(x2, x1); }
 
@@ -183,15 +226,37 @@ void SubtractASImpl(const Array& x1, Scalar x2, const Array& out) {
 
 namespace internal {
 
-void ISubtract(const Array& x1, const Array& x2) { BroadcastBinaryInPlace(&SubtractImpl, x1, x2); }
+void ISubtract(const Array& x1, const Array& x2) {
+    ProfileRange profile_range{"routine", "subtract", {x1, x2}};
+    BroadcastBinaryInPlace(&SubtractImpl, x1, x2);
+}
 
-void ISubtract(const Array& x1, Scalar x2) { BinaryInPlace(&SubtractASImpl, x1, x2); }
+void ISubtract(const Array& x1, Scalar x2) {
+    ProfileRange profile_range{"routine", "subtract_scalar", {x1}};
+    BinaryInPlace(&SubtractASImpl, x1, x2);
+}
 
 }  // namespace internal
 
-Array Subtract(const Array& x1, const Array& x2) { return BroadcastBinary(&SubtractImpl, x1, x2); }
+Array Subtract(const Array& x1, const Array& x2) {
+    ProfileRange profile_range{"routine", "subtract", {x1, x2}};
+    return BroadcastBinary(&SubtractImpl, x1, x2);
+}
 
-Array Subtract(const Array& x1, Scalar x2) { return Binary(&SubtractASImpl, x1, x2); }
+Array Subtract(const Array& x1, Scalar x2) {
+    ProfileRange profile_range{"routine", "subtract_scalar", {x1}};
+    return Binary(&SubtractASImpl, x1, x2);
+}
+
+void Subtract(const Array& x1, const Array& x2, const Array& out) {
+    ProfileRange profile_range{"routine", "subtract", {x1, x2}};
+    BroadcastBinaryToOut(&SubtractImpl, x1, x2, out);
+}
+
+void Subtract(const Array& x1, Scalar x2, const Array& out) {
+    ProfileRange profile_range{"routine", "subtract_scalar", {x1}};
+    BinaryToOut(&SubtractASImpl, x1, x2, out);
+}
 
 Array Subtract(Scalar x1, const Array& x2) { return Add(-x2, x1); }
 
@@ -244,15 +309,37 @@ void MultiplyASImpl(const Array& x1, Scalar x2, const Array& out) {
 
 namespace internal {
 
-void IMultiply(const Array& x1, const Array& x2) { BroadcastBinaryInPlace(&MultiplyImpl, x1, x2); }
+void IMultiply(const Array& x1, const Array& x2) {
+    ProfileRange profile_range{"routine", "multiply", {x1, x2}};
+    BroadcastBinaryInPlace(&MultiplyImpl, x1, x2);
+}
 
-void IMultiply(const Array& x1, Scalar x2) { BinaryInPlace(&MultiplyASImpl, x1, x2); }
+void IMultiply(const Array& x1, Scalar x2) {
+    ProfileRange profile_range{"routine", "multiply_scalar", {x1}};
+    BinaryInPlace(&MultiplyASImpl, x1, x2);
+}
 
 }  // namespace internal
 
-Array Multiply(const Array& x1, const Array& x2) { return BroadcastBinary(&MultiplyImpl, x1, x2); }
+Array Multiply(const Array& x1, const Array& x2) {
+    ProfileRange profile_range{"routine", "multiply", {x1, x2}};
+    return BroadcastBinary(&MultiplyImpl, x1, x2);
+}
 
-Array Multiply(const Array& x1, Scalar x2) { return Binary(&MultiplyASImpl, x1, x2); }
+Array Multiply(const Array& x1, Scalar x2) {
+    ProfileRange profile_range{"routine", "multiply_scalar", {x1}};
+    return Binary(&MultiplyASImpl, x1, x2);
+}
+
+void Multiply(const Array& x1, const Array& x2, const Array& out) {
+    ProfileRange profile_range{"routine", "multiply", {x1, x2}};
+    BroadcastBinaryToOut(&MultiplyImpl, x1, x2, out);
+}
+
+void Multiply(const Array& x1, Scalar x2, const Array& out) {
+    ProfileRange profile_range{"routine", "multiply_scalar", {x1}};
+    BinaryToOut(&MultiplyASImpl, x1, x2, out);
+}
 
 Array Multiply(Scalar x1, const Array& x2) { return Multiply(x2, x1); }
 
@@ -307,15 +394,37 @@ void DivideASImpl(const Array& x1, Scalar x2, const Array& out) {
 
 namespace internal {
 
-void IDivide(const Array& x1, const Array& x2) { BroadcastBinaryInPlace(&DivideImpl, x1, x2); }
+void IDivide(const Array& x1, const Array& x2) {
+    ProfileRange profile_range{"routine", "divide", {x1, x2}};
+    BroadcastBinaryInPlace(&DivideImpl, x1, x2);
+}
 
-void IDivide(const Array& x1, Scalar x2) { BinaryInPlace(&DivideASImpl, x1, x2); }
+void IDivide(const Array& x1, Scalar x2) {
+    ProfileRange profile_range{"routine", "divide_scalar", {x1}};
+    BinaryInPlace(&DivideASImpl, x1, x2);
+}
 
 }  // namespace internal
 
-Array Divide(const Array& x1, const Array& x2) { return BroadcastBinary(&DivideImpl, x1, x2); }
+Array Divide(const Array& x1, const Array& x2) {
+    ProfileRange profile_range{"routine", "divide", {x1, x2}};
+    return BroadcastBinary(&DivideImpl, x1, x2);
+}
+
+Array Divide(const Array& x1, Scalar x2) {
+    ProfileRange profile_range{"routine", "divide_scalar", {x1}};
+    return Binary(&DivideASImpl, x1, x2);
+}
+
+void Divide(const Array& x1, const Array& x2, const Array& out) {
+    ProfileRange profile_range{"routine", "divide", {x1, x2}};
+    BroadcastBinaryToOut(&DivideImpl, x1, x2, out);
+}
 
-Array Divide(const Array& x1, Scalar x2) { return Binary(&DivideASImpl, x1, x2); }
+void Divide(const Array& x1, Scalar x2, const Array& out) {
+    ProfileRange profile_range{"routine", "divide_scalar", {x1}};
+    BinaryToOut(&DivideASImpl, x1, x2, out);
+}
 
 Array Divide(Scalar /*x1*/, const Array& /*x2*/) { throw NotImplementedError{"Scalar / Array division is not yet supported."}; }
 
@@ -324,24 +433,25 @@ Array Reciprocal(const Array& x) {
     return OnesLike(x, x.device()) / x;
 }
 
-Array Sum(const Array& a, const OptionalAxes& axis, bool keepdims) {
-    Axes sorted_axis = internal::GetSortedAxesOrAll(axis, a.ndim());
+namespace internal {
 
-    // Decide the output dtype for integral input dtype.
-    Dtype out_dtype{};
-    switch (GetKind(a.dtype())) {
+Dtype GetSumOutputDtype(Dtype dtype) {
+    switch (GetKind(dtype)) {
         case DtypeKind::kBool:
         case DtypeKind::kInt:  // fallthrough
-            out_dtype = Dtype::kInt64;
-            break;
+            return Dtype::kInt64;
         case DtypeKind::kUInt:
-            out_dtype = Dtype::kInt64;  // TODO(niboshi): This should be kUInt64
-            break;
+            return Dtype::kInt64;  // TODO(niboshi): This should be kUInt64
         default:
-            out_dtype = a.dtype();
+            return dtype;
     }
+}
+
+}  // namespace internal
+
+namespace {
 
-    Array out = internal::EmptyReduced(a.shape(), out_dtype, sorted_axis, keepdims, a.device());
+void SumImpl(const Array& a, const Axes& sorted_axis, bool keepdims, const Array& out) {
     {
         NoBackpropModeScope scope{};
         a.device().Sum(a, sorted_axis, out);
@@ -365,10 +475,28 @@ Array Sum(const Array& a, const OptionalAxes& axis, bool keepdims) {
         });
     }
     bb.Finalize();
+}
+
+}  // namespace
+
+Array Sum(const Array& a, const OptionalAxes& axis, bool keepdims) {
+    ProfileRange profile_range{"routine", "sum", {a}};
+    Axes sorted_axis = internal::GetSortedAxesOrAll(axis, a.ndim());
+    Array out = internal::EmptyReduced(a.shape(), internal::GetSumOutputDtype(a.dtype()), sorted_axis, keepdims, a.device());
+    SumImpl(a, sorted_axis, keepdims, out);
     return out;
 }
 
+void Sum(const Array& a, const OptionalAxes& axis, bool keepdims, const Array& out) {
+    ProfileRange profile_range{"routine", "sum", {a}};
+    Axes sorted_axis = internal::GetSortedAxesOrAll(axis, a.ndim());
+    internal::CheckOutput(out, internal::ReduceShape(a.shape(), sorted_axis, keepdims), internal::GetSumOutputDtype(a.dtype()), a.device());
+    internal::CheckNoUnsafeInplace(out, {a});
+    SumImpl(a, sorted_axis, keepdims, out);
+}
+
 Array AMax(const Array& a, const OptionalAxes& axis, bool keepdims) {
+    ProfileRange profile_range{"routine", "amax", {a}};
     Axes sorted_axis = internal::GetSortedAxesOrAll(axis, a.ndim());
     Array out = internal::EmptyReduced(a.shape(), a.dtype(), sorted_axis, keepdims, a.device());
 
@@ -418,6 +546,7 @@ namespace {
 // Calculates: x1 < x2 ? pos : neg
 // Can only differentiate with respect to neg.
 Array IfLessElse(const Array& x1, Scalar x2, Scalar pos, const Array& neg) {
+    ProfileRange profile_range{"routine", "if_less_else", {x1, neg}};
     Array out = EmptyLike(x1, x1.device());
 
     {
@@ -445,9 +574,9 @@ Array Maximum(const Array& x1, Scalar x2) {
 
 Array Maximum(Scalar x1, const Array& x2) { return Maximum(x2, x1); }
 
-Array Exp(const Array& x) {
-    Array out = EmptyLike(x, x.device());
+namespace {
 
+void ExpImpl(const Array& x, const Array& out) {
     {
         NoBackpropModeScope scope{};
         x.device().Exp(x, out);
@@ -461,13 +590,27 @@ Array Exp(const Array& x) {
         });
     }
     bb.Finalize();
+}
+
+}  // namespace
 
+Array Exp(const Array& x) {
+    ProfileRange profile_range{"routine", "exp", {x}};
+    Array out = EmptyLike(x, x.device());
+    ExpImpl(x, out);
     return out;
 }
 
-Array Log(const Array& x) {
-    Array out = EmptyLike(x, x.device());
+void Exp(const Array& x, const Array& out) {
+    ProfileRange profile_range{"routine", "exp", {x}};
+    internal::CheckOutput(out, x.shape(), x.dtype(), x.device());
+    internal::CheckNoUnsafeInplace(out, {x});
+    ExpImpl(x, out);
+}
 
+namespace {
+
+void LogImpl(const Array& x, const Array& out) {
     {
         NoBackpropModeScope scope{};
         x.device().Log(x, out);
@@ -481,10 +624,24 @@ Array Log(const Array& x) {
         });
     }
     bb.Finalize();
+}
+
+}  // namespace
 
+Array Log(const Array& x) {
+    ProfileRange profile_range{"routine", "log", {x}};
+    Array out = EmptyLike(x, x.device());
+    LogImpl(x, out);
     return out;
 }
 
+void Log(const Array& x, const Array& out) {
+    ProfileRange profile_range{"routine", "log", {x}};
+    internal::CheckOutput(out, x.shape(), x.dtype(), x.device());
+    internal::CheckNoUnsafeInplace(out, {x});
+    LogImpl(x, out);
+}
+
 Array LogSumExp(const Array& x, const OptionalAxes& axis, bool keepdims) {
     Axes sorted_axis = internal::GetSortedAxesOrAll(axis, x.ndim());
     Array xmax = AMax(x, sorted_axis, true);
@@ -495,6 +652,7 @@ Array LogSumExp(const Array& x, const OptionalAxes& axis, bool keepdims) {
 Array LogSoftmax(const Array& x, const OptionalAxes& axis) { return x - LogSumExp(x, axis.has_value() ? axis : OptionalAxes{1}, true); }
 
 Array Sqrt(const Array& x) {
+    ProfileRange profile_range{"routine", "sqrt", {x}};
     Array out = EmptyLike(x, x.device());
 
     {
@@ -516,6 +674,7 @@ Array Sqrt(const Array& x) {
 }
 
 Array Tanh(const Array& x) {
+    ProfileRange profile_range{"routine", "tanh", {x}};
     Array out = EmptyLike(x, x.device());
 
     {
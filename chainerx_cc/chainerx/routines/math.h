@@ -6,6 +6,7 @@
 
 #include "chainerx/array.h"
 #include "chainerx/axes.h"
+#include "chainerx/dtype.h"
 #include "chainerx/scalar.h"
 
 namespace chainerx {
@@ -23,6 +24,11 @@ Array Add(const Array& x1, const Array& x2);
 Array Add(const Array& x1, Scalar x2);
 Array Add(Scalar x1, const Array& x2);
 
+// Out-variants write the result to the given output array instead of allocating a new one. The output array must have the broadcasted
+// shape of the operands and the same dtype and device as x1. The same applies to other arithmetic routines.
+void Add(const Array& x1, const Array& x2, const Array& out);
+void Add(const Array& x1, Scalar x2, const Array& out);
+
 namespace internal {
 
 void ISubtract(const Array& x1, const Array& x2);
@@ -34,6 +40,9 @@ Array Subtract(const Array& x1, const Array& x2);
 Array Subtract(const Array& x1, Scalar x2);
 Array Subtract(Scalar x1, const Array& x2);
 
+void Subtract(const Array& x1, const Array& x2, const Array& out);
+void Subtract(const Array& x1, Scalar x2, const Array& out);
+
 namespace internal {
 
 void IMultiply(const Array& x1, const Array& x2);
@@ -45,6 +54,9 @@ Array Multiply(const Array& x1, const Array& x2);
 Array Multiply(const Array& x1, Scalar x2);
 Array Multiply(Scalar x1, const Array& x2);
 
+void Multiply(const Array& x1, const Array& x2, const Array& out);
+void Multiply(const Array& x1, Scalar x2, const Array& out);
+
 namespace internal {
 
 void IDivide(const Array& x1, const Array& x2);
@@ -56,9 +68,22 @@ Array Divide(const Array& x1, const Array& x2);
 Array Divide(const Array& x1, Scalar x2);
 Array Divide(Scalar x1, const Array& x2);
 
+void Divide(const Array& x1, const Array& x2, const Array& out);
+void Divide(const Array& x1, Scalar x2, const Array& out);
+
 Array Reciprocal(const Array& x);
 
+namespace internal {
+
+// Returns the output dtype of Sum, which is int64 for integral and boolean input dtypes.
+Dtype GetSumOutputDtype(Dtype dtype);
+
+}  // namespace internal
+
 Array Sum(const Array& a, const OptionalAxes& axis = nonstd::nullopt, bool keepdims = false);
+// Writes the result to the given output array, which must have the reduced shape and the dtype of the result.
+void Sum(const Array& a, const OptionalAxes& axis, bool keepdims, const Array& out);
+
 // TODO(niboshi): Move to statistics routines
 Array AMax(const Array& a, const OptionalAxes& axis = nonstd::nullopt, bool keepdims = false);
 
@@ -66,7 +91,10 @@ Array Maximum(const Array& x1, Scalar x2);
 Array Maximum(Scalar x1, const Array& x2);
 
 Array Exp(const Array& x);
+void Exp(const Array& x, const Array& out);
+
 Array Log(const Array& x);
+void Log(const Array& x, const Array& out);
 
 // Returns the LogSumExp (LSE) of x, reduced along the specified axes.
 // If no axes are specified, all axes will be reduced.
@@ -363,6 +363,53 @@ TEST_P(MathTest, AddInvalidBroadcast) {
     EXPECT_THROW(Add(a, b), ChainerxError);
 }
 
+TEST_P(MathTest, AddOut) {
+    Array a = testing::BuildArray({3, 2}).WithLinearData<float>().WithPadding(1);
+    Array b = testing::BuildArray({2}).WithData<float>({1, 2});
+    Array out = testing::BuildArray({3, 2}).WithLinearData<float>().WithPadding(2);
+    Array e = testing::BuildArray({3, 2}).WithData<float>({1, 3, 3, 5, 5, 7});
+    Add(a, b, out);
+    EXPECT_ARRAY_EQ(e, out);
+
+    // In-place.
+    Add(a, b, a);
+    EXPECT_ARRAY_EQ(e, a);
+
+    Add(b, Scalar{2.f}, b);
+    EXPECT_ARRAY_EQ(testing::BuildArray({2}).WithData<float>({3, 4}), b);
+}
+
+TEST_P(MathTest, AddOutInvalid) {
+    Array a = testing::BuildArray({3, 2}).WithLinearData<float>();
+    Array b = testing::BuildArray({2}).WithData<float>({1, 2});
+    EXPECT_THROW(Add(a, b, Empty({2}, Dtype::kFloat32)), DimensionError);
+    EXPECT_THROW(Add(a, b, Empty({3, 2}, Dtype::kInt32)), DtypeError);
+    EXPECT_THROW(Add(a, Scalar{1.f}, Empty({2, 3}, Dtype::kFloat32)), DimensionError);
+
+    // Output arrays requiring grad cannot be overwritten.
+    Array out = Empty({3, 2}, Dtype::kFloat32).RequireGrad();
+    EXPECT_THROW(Add(a, b, out), ChainerxError);
+}
+
+TEST_P(MathTest, AddOutBackward) {
+    using T = double;
+    Shape shape{2, 3};
+    Array a = (*testing::BuildArray(shape).WithLinearData<T>(-2).WithPadding(1)).RequireGrad();
+    Array b = (*testing::BuildArray(shape).WithData<T>({-6, -4, -2, 2, 4, 6}).WithPadding(2)).RequireGrad();
+    Array go = testing::BuildArray(shape).WithLinearData<T>(-0.1, 0.1).WithPadding(3);
+    Array eps = Full(shape, 1e-3);
+
+    CheckBackward(
+            [](const std::vector<Array>& xs) -> std::vector<Array> {
+                Array out = EmptyLike(xs[0], xs[0].device());
+                Add(xs[0], xs[1], out);
+                return {out};
+            },
+            {a, b},
+            {go},
+            {eps, eps});
+}
+
 TEST_THREAD_SAFE_P(MathTest, AddArrayScalar) {
     Array a = testing::BuildArray({3, 1}).WithData<float>({1, 2, 3});
     Scalar b{2.f};
@@ -977,6 +1024,28 @@ TEST_THREAD_SAFE_P(MathTest, Sum) {
     });
 }
 
+TEST_P(MathTest, SumOut) {
+    Array a = testing::BuildArray({2, 3}).WithLinearData<float>().WithPadding(1);
+    {
+        Array out = Empty({2}, Dtype::kFloat32);
+        Sum(a, Axes{1}, false, out);
+        EXPECT_ARRAY_EQ(testing::BuildArray({2}).WithData<float>({3, 12}), out);
+    }
+    {
+        Array out = testing::BuildArray({1, 3}).WithLinearData<float>().WithPadding(1);
+        Sum(a, Axes{0}, true, out);
+        EXPECT_ARRAY_EQ(testing::BuildArray({1, 3}).WithData<float>({3, 5, 7}), out);
+    }
+    {
+        Array b = testing::BuildArray({2, 3}).WithLinearData<int32_t>();
+        Array out = Empty({}, Dtype::kInt64);
+        Sum(b, nonstd::nullopt, false, out);
+        EXPECT_ARRAY_EQ(testing::BuildArray({}).WithData<int64_t>({15}), out);
+    }
+    EXPECT_THROW(Sum(a, Axes{1}, true, Empty({2}, Dtype::kFloat32)), DimensionError);
+    EXPECT_THROW(Sum(a, Axes{1}, false, Empty({2}, Dtype::kFloat64)), DtypeError);
+}
+
 TEST_THREAD_SAFE_P(MathTest, SumAllAxes) {
     using T = float;
 
@@ -1278,6 +1347,38 @@ TEST_THREAD_SAFE_P(MathTest, Exp) {
     Run([&]() { testing::CheckForward([](const std::vector<Array>& xs) { return std::vector<Array>{Exp(xs[0])}; }, {a}, {e}); });
 }
 
+TEST_P(MathTest, ExpOut) {
+    Array a = testing::BuildArray({3}).WithData<float>({0.f, 1.f, std::log(3.f)});
+    Array e = testing::BuildArray({3}).WithData<float>({1.f, std::exp(1.f), 3.f});
+    Array out = testing::BuildArray({3}).WithLinearData<float>().WithPadding(1);
+    Exp(a, out);
+    EXPECT_ARRAY_EQ(e, out);
+
+    // In-place.
+    Exp(a, a);
+    EXPECT_ARRAY_EQ(e, a);
+
+    EXPECT_THROW(Exp(a, Empty({3}, Dtype::kFloat64)), DtypeError);
+}
+
+TEST_P(MathTest, ExpOutBackward) {
+    using T = double;
+    Shape shape{2, 3};
+    Array a = (*testing::BuildArray(shape).WithLinearData<T>().WithPadding(1)).RequireGrad();
+    Array go = testing::BuildArray(shape).WithLinearData<T>(-0.1, 0.1).WithPadding(1);
+    Array eps = Full(shape, 1e-3);
+
+    CheckBackward(
+            [](const std::vector<Array>& xs) -> std::vector<Array> {
+                Array out = EmptyLike(xs[0], xs[0].device());
+                Exp(xs[0], out);
+                return {out};
+            },
+            {a},
+            {go},
+            {eps});
+}
+
 TEST_P(MathTest, ExpBackward) {
     using T = double;
     Shape shape{2, 3};
@@ -13,6 +13,7 @@
 #include "chainerx/device.h"
 #include "chainerx/error.h"
 #include "chainerx/graph.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/math.h"
 #include "chainerx/routines/routines_util.h"
 #include "chainerx/stack_vector.h"
@@ -48,6 +49,7 @@ Array MaxPool(
         const StackVector<int64_t, kMaxNdim>& stride,
         const StackVector<int64_t, kMaxNdim>& pad,
         bool cover_all) {
+    ProfileRange profile_range{"routine", "max_pooling", {x}};
     CheckPoolInputs(x, kernel_size, stride, pad);
     std::unique_ptr<MaxPoolForwardBackward> fb = x.device().GetMaxPoolForwardBackward(kernel_size, stride, pad, cover_all);
 
@@ -107,6 +109,7 @@ Array AveragePool(
         const StackVector<int64_t, kMaxNdim>& stride,
         const StackVector<int64_t, kMaxNdim>& pad,
         AveragePoolPadMode pad_mode) {
+    ProfileRange profile_range{"routine", "average_pool", {x}};
     if (GetKind(x.dtype()) != DtypeKind::kFloat) {
         throw DtypeError("cannot apply average pooling to ", x.dtype(), " array (floatXX array is expected)");
     }
@@ -4,7 +4,10 @@
 #include <initializer_list>
 
 #include "chainerx/array.h"
+#include "chainerx/device.h"
+#include "chainerx/dtype.h"
 #include "chainerx/error.h"
+#include "chainerx/shape.h"
 
 namespace chainerx {
 namespace internal {
@@ -36,6 +39,20 @@ inline void CheckNoUnsafeInplace(const Array& out, std::initializer_list<std::re
     }
 }
 
+// Checks that an output array given by the caller of a routine can hold the result of the routine.
+// Throws DimensionError, DtypeError or DeviceError if the shape, the dtype or the device of the output array does not match, respectively.
+inline void CheckOutput(const Array& out, const Shape& shape, Dtype dtype, const Device& device) {
+    if (out.shape() != shape) {
+        throw DimensionError{"Output array has an invalid shape ", out.shape(), ". Expected: ", shape, "."};
+    }
+    if (out.dtype() != dtype) {
+        throw DtypeError{"Output array has an invalid dtype ", GetDtypeName(out.dtype()), ". Expected: ", GetDtypeName(dtype), "."};
+    }
+    if (&out.device() != &device) {
+        throw DeviceError{"Output array is on an invalid device ", out.device().name(), ". Expected: ", device.name(), "."};
+    }
+}
+
 // Makes view of output arrays of ForwardBackward implementations to avoid cyclic references since ForwardBackward may internally capture
 // the output arrays.
 template <size_t N>
@@ -9,12 +9,14 @@
 #include "chainerx/backprop_mode.h"
 #include "chainerx/dtype.h"
 #include "chainerx/error.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/creation.h"
 #include "chainerx/shape.h"
 
 namespace chainerx {
 
 Array ArgMax(const Array& a, const OptionalAxes& axis) {
+    ProfileRange profile_range{"routine", "argmax", {a}};
     Axes sorted_axis{};
     Shape out_shape{};
     if (axis.has_value()) {
@@ -8,11 +8,13 @@
 #include "chainerx/backward_builder.h"
 #include "chainerx/backward_context.h"
 #include "chainerx/macro.h"
+#include "chainerx/profiler.h"
 #include "chainerx/routines/creation.h"
 
 namespace chainerx {
 
 Array Mean(const Array& a, const OptionalAxes& axis, bool keepdims) {
+    ProfileRange profile_range{"routine", "mean", {a}};
     Axes sorted_axis = internal::GetSortedAxesOrAll(axis, a.ndim());
     Array out = internal::EmptyReduced(a.shape(), a.dtype(), sorted_axis, keepdims, a.device());
     Scalar n = internal::CountItemsAlongAxes(a.shape(), sorted_axis);
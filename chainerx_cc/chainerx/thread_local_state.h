@@ -11,6 +11,7 @@ struct InternalThreadLocalState {
     Context* default_context;
     Device* default_device;
     internal::BackpropModeStack backprop_mode_stack;
+    bool inference_mode;
 };
 
 InternalThreadLocalState& GetInternalThreadLocalState();
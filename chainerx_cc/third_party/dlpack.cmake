@@ -0,0 +1,14 @@
+cmake_minimum_required(VERSION 2.8.2)
+project(dlpack-download NONE)
+
+include(ExternalProject)
+ExternalProject_Add(dlpack
+    GIT_REPOSITORY    https://github.com/dmlc/dlpack
+    GIT_TAG           v0.2
+    SOURCE_DIR        "${CMAKE_BINARY_DIR}/dlpack"
+    BINARY_DIR        ""
+    CONFIGURE_COMMAND ""
+    BUILD_COMMAND     ""
+    INSTALL_COMMAND   ""
+    TEST_COMMAND      ""
+    )
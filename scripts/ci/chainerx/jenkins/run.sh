@@ -69,6 +69,7 @@ case "${CHAINERX_JENKINS_TEST_TYPE}" in
         CHAINERX_NVCC_GENERATE_CODE=arch=compute_50,code=sm_50 MAKEFLAGS=-j16 run_step make
         run_step make_install
         run_step ctest
+        run_step ctest_native_async
         ;;
     'chainerx-py3')
         run_step setup_conda_environment
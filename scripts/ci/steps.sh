@@ -178,6 +178,14 @@ step_ctest() {
 }
 
 
+step_ctest_native_async() {
+    # Runs the C++ tests again with the native devices in the asynchronous mode.
+    pushd "$WORK_DIR"/build
+    CHAINERX_NATIVE_ASYNC=1 ctest -V
+    popd
+}
+
+
 step_python_build() {
     source activate testenv
 
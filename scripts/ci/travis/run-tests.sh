@@ -61,6 +61,10 @@ case "${CHAINER_TRAVIS_TEST}" in
                 python -Werror::DeprecationWarning -Wignore::DeprecationWarning:site -m compileall -f -q chainer chainermn examples tests docs
                 pushd tests
                 pytest -m "not slow and not gpu and not cudnn and not ideep" chainer_tests
+                if [[ $SKIP_CHAINERX != 1 ]]; then
+                    # Tests the Python binding of ChainerX built in the install phase.
+                    pytest -m "not cuda" -p no:doctest chainerx_tests;
+                fi
                 export OMP_NUM_THREADS=1
                 (for NP in 1 2; do mpiexec -n ${NP} pytest -s -v -m 'not gpu and not slow' chainermn_tests || exit $?; done)
                 popd
@@ -1,3 +1,4 @@
+import array
 from io import StringIO
 import math
 import sys
@@ -304,6 +305,61 @@ def test_asarray_from_numpy_array_with_copy():
     assert not numpy.array_equal(obj, chainerx.to_numpy(a))
 
 
+@pytest.mark.parametrize('obj,expected_dtype,expected_shape', [
+    (True, 'bool_', ()),
+    (3, 'int64', ()),
+    (2.5, 'float64', ()),
+    ([True, 2], 'int64', (2,)),
+    ([[1, 2.5], (True, 3)], 'float64', (2, 2)),
+    ([], 'float64', (0,)),
+    ([[], []], 'float64', (2, 0)),
+])
+def test_array_from_python_object_dtype_inference(
+        obj, expected_dtype, expected_shape):
+    a = chainerx.array(obj)
+    assert a.dtype == chainerx.dtype(expected_dtype)
+    assert a.shape == expected_shape
+    chainerx.testing.assert_array_equal_ex(a, numpy.array(obj))
+
+
+@pytest.mark.parametrize('typecode,dtype', [
+    ('b', 'int8'),
+    ('B', 'uint8'),
+    ('h', 'int16'),
+    ('i', 'int32'),
+    ('q', 'int64'),
+    ('f', 'float32'),
+    ('d', 'float64'),
+])
+def test_asarray_from_buffer_with_zero_copy(typecode, dtype):
+    obj = array.array(typecode, [1, 2, 3, 4])
+    a = chainerx.asarray(obj)
+    assert a.dtype == chainerx.dtype(dtype)
+    chainerx.testing.assert_array_equal_ex(
+        a, numpy.array([1, 2, 3, 4], dtype))
+
+    # test buffer is shared (zero copy)
+    a += a
+    assert obj.tolist() == [2, 4, 6, 8]
+
+    # test buffer can not be resized while shared
+    with pytest.raises(BufferError):
+        obj.append(5)
+    del a
+    obj.append(5)
+
+
+def test_array_from_buffer_with_copy():
+    obj = memoryview(bytearray([1, 2, 3]))
+    a = chainerx.array(obj)
+    b = chainerx.asarray(obj, dtype='float32')
+    a += a
+    b += b
+    assert obj.tolist() == [1, 2, 3]
+    chainerx.testing.assert_array_equal_ex(
+        b, numpy.array([2, 4, 6], 'float32'))
+
+
 @pytest.mark.parametrize('dtype', ['int32', 'float32'])
 def test_asarray_from_chainerx_array(dtype):
     obj = array_utils.create_dummy_ndarray(chainerx, (2, 3), 'int32')
@@ -29,6 +29,22 @@ def test_dot(is_module, xp, device, a_shape, b_shape, dtype):
         return a.dot(b)
 
 
+@chainerx.testing.numpy_chainerx_array_equal()
+@pytest.mark.parametrize('a_shape,b_shape', [
+    ((2, 3), (3, 4)),
+    ((2, 3), (3,)),
+    ((2, 3, 4), (4, 2)),
+])
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_dot_out(xp, device, a_shape, b_shape, float_dtype):
+    a = array_utils.create_dummy_ndarray(xp, a_shape, float_dtype)
+    b = array_utils.create_dummy_ndarray(xp, b_shape, float_dtype)
+    out = xp.empty(a_shape[:-1] + b_shape[1:], float_dtype)
+    ret = xp.dot(a, b, out=out)
+    assert ret is out
+    return out
+
+
 @chainerx.testing.numpy_chainerx_array_equal(
     accept_error=(chainerx.DimensionError, ValueError))
 @pytest.mark.parametrize('a_shape,b_shape', [
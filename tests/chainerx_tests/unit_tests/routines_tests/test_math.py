@@ -50,6 +50,27 @@ def test_iadd(xp, device, shape, dtype):
     return lhs
 
 
+@chainerx.testing.numpy_chainerx_array_equal()
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_add_out(xp, device, shape, dtype):
+    lhs = array_utils.create_dummy_ndarray(xp, shape, dtype, pattern=1)
+    rhs = array_utils.create_dummy_ndarray(xp, shape, dtype, pattern=2)
+    out = xp.empty(shape, dtype)
+    ret = xp.add(lhs, rhs, out=out)
+    assert ret is out
+    return out
+
+
+@chainerx.testing.numpy_chainerx_array_equal(
+    accept_error=(chainerx.DimensionError, ValueError))
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_add_out_invalid_shape(xp, device):
+    lhs = xp.ones((2, 3), 'float32')
+    rhs = xp.ones((3,), 'float32')
+    out = xp.empty((3,), 'float32')
+    xp.add(lhs, rhs, out=out)
+
+
 @pytest.mark.parametrize('scalar', [0, -1, 1, 2])
 @pytest.mark.parametrize_device(['native:0', 'cuda:0'])
 def test_add_scalar(scalar, device, shape, dtype):
@@ -322,6 +343,17 @@ def test_sum(is_module, xp, device, shape, axis, keepdims, dtype):
     return out
 
 
+@chainerx.testing.numpy_chainerx_array_equal()
+@pytest.mark.parametrize('keepdims', [False, True])
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_sum_out(xp, device, keepdims, float_dtype):
+    a = array_utils.create_dummy_ndarray(xp, (2, 3, 4), float_dtype)
+    out = xp.empty((2, 1, 4) if keepdims else (2, 4), float_dtype)
+    ret = xp.sum(a, axis=1, keepdims=keepdims, out=out)
+    assert ret is out
+    return out
+
+
 @chainerx.testing.numpy_chainerx_array_equal(
     accept_error=(chainerx.DimensionError, ValueError))
 @pytest.mark.parametrize('keepdims', [False, True])
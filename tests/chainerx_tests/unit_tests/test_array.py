@@ -1,3 +1,5 @@
+import io
+
 import numpy
 import pytest
 
@@ -93,6 +95,106 @@ def test_to_numpy_positive_offset(device, copy):
     _check_to_numpy(a_np, a_chx, device, copy)
 
 
+@pytest.mark.parametrize_device(['native:0', 'native:1', 'cuda:0'])
+def test_to_numpy_default_no_copy(device):
+    a_chx = chainerx.arange(6, dtype='float32').reshape(2, 3)[:, 1:]
+    a_np = chainerx.to_numpy(a_chx)
+    _check_to_numpy(a_np, a_chx, device, False)
+
+
+@pytest.mark.parametrize_device(['native:0', 'native:1', 'cuda:0'])
+def test_array_protocol(shape, dtype, device):
+    a_chx = array_utils.create_dummy_ndarray(chainerx, shape, dtype)
+    a_np = numpy.asarray(a_chx)
+    assert isinstance(a_np, numpy.ndarray)
+    _check_to_numpy(a_np, a_chx, device, False)
+
+
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_array_protocol_with_dtype(device):
+    a_chx = chainerx.arange(6, dtype='int32').reshape(2, 3)
+    a_np = numpy.asarray(a_chx, dtype='float64')
+    assert a_np.dtype == numpy.float64
+    numpy.testing.assert_array_equal(
+        a_np, numpy.arange(6, dtype='float64').reshape(2, 3))
+
+    a_np = numpy.array(a_chx)  # copy
+    _check_to_numpy(a_np, a_chx, device, True)
+
+
+@pytest.mark.parametrize_device(['native:0', 'native:1'])
+def test_array_interface(dtype, device):
+    a_np = numpy.arange(12).astype(dtype).reshape(3, 4)
+    a_chx = chainerx.array(a_np)[1:, ::2]
+    interface = a_chx.__array_interface__
+    assert interface['version'] == 3
+    assert interface['shape'] == (2, 2)
+    assert interface['strides'] == a_chx.strides
+    assert numpy.dtype(interface['typestr']) == numpy.dtype(dtype)
+    assert interface['data'] == (a_chx.data_ptr + a_chx.offset, False)
+
+    a_np = numpy.asarray(a_chx)
+    assert a_np.__array_interface__['data'][0] == interface['data'][0]
+
+    # The buffer is kept alive by the NumPy array.
+    expected = a_np.copy()
+    del a_chx
+    numpy.testing.assert_array_equal(a_np, expected)
+
+
+@pytest.mark.cuda()
+def test_array_interface_cuda():
+    a_chx = chainerx.arange(6, dtype='float32', device='cuda:0')
+    assert not hasattr(a_chx, '__array_interface__')
+
+
+@pytest.mark.parametrize_device(['native:0', 'native:1'])
+def test_buffer_protocol(shape, dtype, device):
+    a_chx = array_utils.create_dummy_ndarray(
+        chainerx, shape, dtype, padding=False)
+    view = memoryview(a_chx)
+    assert not view.readonly
+    assert view.shape == a_chx.shape
+    assert view.strides == a_chx.strides
+    assert view.itemsize == a_chx.itemsize
+    assert view.nbytes == a_chx.nbytes
+    assert numpy.dtype(view.format) == numpy.dtype(dtype)
+
+    a_np = numpy.frombuffer(view, dtype=dtype).reshape(shape)
+    numpy.testing.assert_array_equal(a_np, chainerx.to_numpy(a_chx))
+    assert bytes(a_chx) == a_np.tobytes()
+
+    # The buffer is shared.
+    if a_chx.size > 0:
+        a_np.fill(1)
+        chainerx.testing.assert_array_equal_ex(
+            a_chx, numpy.ones(shape, dtype))
+
+
+@pytest.mark.parametrize_device(['native:0'])
+def test_buffer_protocol_non_contiguous(device):
+    a_chx = chainerx.arange(24, dtype='float32').reshape(4, 6)[1:, ::-2]
+    view = memoryview(a_chx)
+    assert view.shape == a_chx.shape
+    assert view.strides == a_chx.strides
+    assert not view.c_contiguous
+    numpy.testing.assert_array_equal(
+        numpy.asarray(view), chainerx.to_numpy(a_chx))
+
+    assert bytes(a_chx) == chainerx.to_numpy(a_chx).tobytes()
+
+    # Consumers requiring contiguous buffers are refused.
+    with pytest.raises(BufferError):
+        io.BytesIO().write(a_chx)
+
+
+@pytest.mark.cuda()
+def test_buffer_protocol_cuda():
+    a_chx = chainerx.arange(6, dtype='float32', device='cuda:0')
+    with pytest.raises(BufferError):
+        memoryview(a_chx)
+
+
 def test_view(shape, dtype):
     array = array_utils.create_dummy_ndarray(chainerx, shape, dtype)
     view = array.view()
@@ -620,3 +722,66 @@ def test_asarray_to_numpy_identity(device, slice1, slice2):
     z = chainerx.to_numpy(y)
     chainerx.testing.assert_array_equal_ex(x, y)
     chainerx.testing.assert_array_equal_ex(x, z, strides_check=False)
+
+
+@pytest.mark.parametrize('op', [
+    lambda a, b: a + b,
+    lambda a, b: a - b,
+    lambda a, b: a * b,
+    lambda a, b: a / b,
+    lambda a, b: a == b,
+    lambda a, b: a != b,
+    lambda a, b: a > b,
+    lambda a, b: a >= b,
+    lambda a, b: a < b,
+    lambda a, b: a <= b,
+])
+@pytest.mark.parametrize('other', [
+    2, 2.5, True, -2 ** 63, chainerx.Scalar(2, 'float32'),
+    numpy.float32(2.5), numpy.float64(2.5), numpy.int32(2), numpy.bool_(True)])
+def test_binary_operator_with_scalar(op, other):
+    a_np = numpy.arange(1, 7, dtype=numpy.float32).reshape(2, 3)
+    a = chainerx.array(a_np)
+    if isinstance(other, chainerx.Scalar):
+        other_np = numpy.float32(float(other))
+    else:
+        other_np = numpy.float32(other)
+    chainerx.testing.assert_array_equal_ex(
+        op(a, other), op(a_np, other_np))
+
+
+@pytest.mark.parametrize('op', [
+    lambda a, b: a + b,
+    lambda a, b: b - a,
+    lambda a, b: a == b,
+])
+@pytest.mark.parametrize('other', [2 ** 63, -2 ** 63 - 1, 2 ** 70])
+def test_binary_operator_with_int_overflow(op, other):
+    a = chainerx.ones((3,), 'float32')
+    with pytest.raises(OverflowError):
+        op(a, other)
+
+
+@pytest.mark.parametrize('op', [
+    lambda a, b: a + b,
+    lambda a, b: b + a,
+    lambda a, b: a * b,
+    lambda a, b: a < b,
+])
+@pytest.mark.parametrize('other', ['a', None, [1, 2, 3], object()])
+def test_binary_operator_invalid_operand(op, other):
+    a = chainerx.ones((3,), 'float32')
+    with pytest.raises(TypeError):
+        op(a, other)
+
+
+def test_inplace_operator_identity():
+    a = chainerx.ones((2, 3), 'float32')
+    b = a
+    a += chainerx.ones((2, 3), 'float32')
+    a *= 2
+    a -= 1.5
+    a /= chainerx.full((2, 3), 2, 'float32')
+    assert a is b
+    chainerx.testing.assert_array_equal_ex(
+        a, numpy.full((2, 3), 1.25, numpy.float32))
@@ -0,0 +1,148 @@
+import numpy
+import pytest
+
+import chainerx
+import chainerx.testing
+
+
+def _arrays(*shapes, dtype='float32'):
+    return [
+        chainerx.array(numpy.random.uniform(-1, 1, shape).astype(dtype))
+        for shape in shapes]
+
+
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_execute_batch(device):
+    x, w, b = _arrays((2, 3), (4, 3), (4,))
+    outputs = chainerx.execute_batch(
+        [('linear', (0, 1, 2)),
+         ('relu', (3,)),
+         ('multiply', (4,), {'x2': 2.0}),
+         ('subtract', (5,), {'x1': 1.0}),
+         ('sum', (6,), {'axis': 1, 'keepdims': True}),
+         ('add', (6, 7))],
+        [x, w, b])
+    assert len(outputs) == 6
+
+    h = chainerx.linear(x, w, b)
+    y = 1.0 - chainerx.relu(h) * 2.0
+    expected = [h, chainerx.relu(h), chainerx.relu(h) * 2.0, y,
+                chainerx.sum(y, axis=1, keepdims=True),
+                y + chainerx.sum(y, axis=1, keepdims=True)]
+    for actual, expected_array in zip(outputs, expected):
+        chainerx.testing.assert_allclose_ex(actual, expected_array)
+
+
+def test_execute_batch_empty():
+    x, = _arrays((2,))
+    assert chainerx.execute_batch([], [x]) == []
+
+
+def test_execute_batch_attrs():
+    x, = _arrays((2, 3, 4))
+    outputs = chainerx.execute_batch(
+        [('reshape', (0,), {'newshape': (6, 4)}),
+         ('transpose', (1,)),
+         ('log_softmax', (0,), {'axis': (1, 2)}),
+         ('astype', (0,), {'dtype': 'float64'}),
+         ('broadcast_to', (0,), {'shape': (5, 2, 3, 4)})],
+        [x])
+    chainerx.testing.assert_array_equal_ex(outputs[0], x.reshape(6, 4))
+    chainerx.testing.assert_array_equal_ex(outputs[1], x.reshape(6, 4).T)
+    chainerx.testing.assert_allclose_ex(
+        outputs[2], chainerx.log_softmax(x, axis=(1, 2)))
+    assert outputs[3].dtype == chainerx.float64
+    assert outputs[4].shape == (5, 2, 3, 4)
+
+
+def test_execute_batch_multiple_outputs():
+    x, = _arrays((6, 2))
+    outputs = chainerx.execute_batch(
+        [('split', (0,), {'indices_or_sections': 3}),
+         ('concatenate', (3, 2, 1), {'axis': 0}),
+         ('split', (4,), {'indices_or_sections': [1, 5], 'axis': 0})],
+        [x])
+    assert len(outputs) == 7
+    for actual, expected in zip(outputs[:3], chainerx.split(x, 3)):
+        chainerx.testing.assert_array_equal_ex(actual, expected)
+    concatenated = chainerx.concatenate(chainerx.split(x, 3)[::-1])
+    chainerx.testing.assert_array_equal_ex(outputs[3], concatenated)
+    for actual, expected in zip(
+            outputs[4:], chainerx.split(concatenated, [1, 5])):
+        chainerx.testing.assert_array_equal_ex(actual, expected)
+
+
+@pytest.mark.parametrize('indices_or_sections', [0, -1])
+def test_execute_batch_split_invalid_sections(indices_or_sections):
+    x, = _arrays((6, 2))
+    with pytest.raises(chainerx.DimensionError):
+        chainerx.execute_batch(
+            [('split', (0,), {'indices_or_sections': indices_or_sections})],
+            [x])
+
+
+def test_execute_batch_inplace():
+    param, grad = _arrays((3,), (3,))
+    expected = param - grad * 0.1
+    outputs = chainerx.execute_batch(
+        [('multiply', (1,), {'x2': 0.1}),
+         ('isubtract', (0, 2))],
+        [param, grad])
+    assert outputs[1] is param
+    chainerx.testing.assert_allclose_ex(param, expected)
+
+
+def test_execute_batch_backward():
+    x, w = _arrays((2, 3), (4, 3), dtype='float64')
+    x_ref = x.copy().require_grad()
+    w_ref = w.copy().require_grad()
+    x.require_grad()
+    w.require_grad()
+
+    _, _, y = chainerx.execute_batch(
+        [('linear', (0, 1)), ('tanh', (2,)), ('sum', (3,))], [x, w])
+    y.backward()
+
+    chainerx.sum(chainerx.tanh(chainerx.linear(x_ref, w_ref))).backward()
+    chainerx.testing.assert_allclose_ex(x.grad, x_ref.grad)
+    chainerx.testing.assert_allclose_ex(w.grad, w_ref.grad)
+
+
+def test_execute_batch_unknown_routine():
+    x, = _arrays((2,))
+    with pytest.raises(ValueError):
+        chainerx.execute_batch([('unknown', (0,))], [x])
+
+
+@pytest.mark.parametrize('ops', [
+    [('exp', (-1,))],
+    [('exp', (1,))],  # its own output
+    [('exp', (0,)), ('exp', (2,))],
+])
+def test_execute_batch_undefined_handle(ops):
+    x, = _arrays((2,))
+    with pytest.raises(IndexError):
+        chainerx.execute_batch(ops, [x])
+
+
+@pytest.mark.parametrize('op', [
+    1,
+    ('exp', (0, 0)),
+    ('add', (0,)),
+    ('add', (0,), {'x1': 1, 'x2': 1}),
+    ('exp', (0,), {'axis': 1}),
+    ('reshape', (0,)),
+])
+def test_execute_batch_invalid_op(op):
+    x, = _arrays((2,))
+    with pytest.raises(TypeError):
+        chainerx.execute_batch([op], [x])
+
+
+def test_execute_batch_validated_before_execution():
+    x, = _arrays((2,))
+    expected = x.copy()
+    with pytest.raises(ValueError):
+        chainerx.execute_batch(
+            [('iadd', (0,), {'x2': 1}), ('unknown', (0,))], [x])
+    chainerx.testing.assert_array_equal_ex(x, expected)
@@ -0,0 +1,105 @@
+import numpy
+import pytest
+
+import chainerx
+import chainerx.testing
+
+from chainerx_tests import array_utils
+
+
+try:
+    import cupy
+except Exception:
+    cupy = None
+
+
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_dlpack_roundtrip(shape, numeric_dtype, device):
+    a = array_utils.create_dummy_ndarray(chainerx, shape, numeric_dtype)
+    b = chainerx.from_dlpack(chainerx.to_dlpack(a))
+
+    assert b.device is a.device
+    chainerx.testing.assert_array_equal_ex(a, b)
+
+    # The buffer is shared.
+    if a.size > 0:
+        a += 1
+        chainerx.testing.assert_array_equal_ex(a, b)
+
+
+@pytest.mark.parametrize_device(['native:0', 'cuda:0'])
+def test_dlpack_roundtrip_strided(device):
+    a = chainerx.arange(24, dtype='float32').reshape(4, 6)
+    views = [a.T, a[1:, ::2], a[::-1, 3:]]
+    for view in views:
+        b = chainerx.from_dlpack(chainerx.to_dlpack(view))
+        assert b.shape == view.shape
+        assert b.strides == view.strides
+        chainerx.testing.assert_array_equal_ex(view, b)
+
+    a[1, 2] = -1
+    for view in views:
+        chainerx.testing.assert_array_equal_ex(
+            view, chainerx.from_dlpack(chainerx.to_dlpack(view)))
+
+
+def test_dlpack_lifetime():
+    a = chainerx.arange(6, dtype='float32')
+    capsule = chainerx.to_dlpack(a)
+    del a
+    b = chainerx.from_dlpack(capsule)
+    del capsule
+    b += 1
+    chainerx.testing.assert_array_equal_ex(
+        b, numpy.arange(1, 7, dtype='float32'))
+
+
+def test_dlpack_unconsumed_capsule():
+    a = chainerx.arange(6, dtype='float32')
+    capsule = chainerx.to_dlpack(a)
+    del capsule
+    chainerx.testing.assert_array_equal_ex(
+        a, numpy.arange(6, dtype='float32'))
+
+
+def test_dlpack_consumed_twice():
+    capsule = chainerx.to_dlpack(chainerx.arange(6, dtype='float32'))
+    chainerx.from_dlpack(capsule)
+    with pytest.raises(ValueError):
+        chainerx.from_dlpack(capsule)
+
+
+def test_dlpack_graph_not_exported():
+    a = chainerx.arange(6, dtype='float32').require_grad()
+    b = chainerx.from_dlpack(chainerx.to_dlpack(a))
+    assert not b.is_backprop_required()
+
+
+def test_to_dlpack_bool():
+    a = chainerx.array([True, False], dtype='bool_')
+    with pytest.raises(chainerx.DtypeError):
+        chainerx.to_dlpack(a)
+
+
+@pytest.mark.cuda()
+def test_dlpack_cupy_to_chainerx():
+    a_cupy = cupy.arange(12, dtype=numpy.float32).reshape((2, 6))[:, ::2]
+    a_chx = chainerx.from_dlpack(a_cupy.toDlpack())
+
+    assert a_chx.device.name == 'cuda:0'
+    chainerx.testing.assert_array_equal_ex(a_chx, a_cupy.get())
+
+    a_cupy[0, 1] = -1
+    chainerx.testing.assert_array_equal_ex(a_chx, a_cupy.get())
+
+
+@pytest.mark.cuda()
+def test_dlpack_chainerx_to_cupy():
+    a_chx = chainerx.arange(12, dtype='float32', device='cuda:0')
+    a_chx = a_chx.reshape(2, 6)[:, 1:]
+    a_cupy = cupy.fromDlpack(chainerx.to_dlpack(a_chx))
+    del a_chx
+
+    a_cupy += 1
+    expected = numpy.arange(1, 13, dtype=numpy.float32).reshape(2, 6)[:, 1:]
+    chainerx.testing.assert_array_equal_ex(a_cupy.get(), expected)
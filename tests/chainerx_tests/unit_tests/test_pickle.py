@@ -0,0 +1,178 @@
+import copy
+import multiprocessing
+import pickle
+import sys
+
+import numpy
+import pytest
+
+import chainerx
+import chainerx.testing
+
+from chainerx_tests import array_utils
+
+
+@pytest.mark.parametrize_device(['native:0', 'native:1', 'cuda:0'])
+def test_pickle(shape, dtype, device):
+    a = array_utils.create_dummy_ndarray(chainerx, shape, dtype)
+    b = pickle.loads(pickle.dumps(a))
+
+    assert b.device is a.device
+    chainerx.testing.assert_array_equal_ex(a, b, strides_check=False)
+
+    # The buffer is not shared.
+    if a.size > 0:
+        a.fill(1)
+        assert not numpy.array_equal(
+            chainerx.to_numpy(a), chainerx.to_numpy(b))
+
+
+def test_pickle_non_contiguous():
+    a = chainerx.arange(24, dtype='float32').reshape(4, 6)[1:, ::-2]
+    b = pickle.loads(pickle.dumps(a))
+    chainerx.testing.assert_array_equal_ex(a, b, strides_check=False)
+
+
+def test_pickle_graph_not_pickled():
+    a = chainerx.arange(6, dtype='float32').require_grad()
+    b = pickle.loads(pickle.dumps(a))
+    assert not b.is_backprop_required()
+
+
+@pytest.mark.parametrize_device(['native:0', 'native:1'])
+def test_to_shared_memory(shape, dtype, device):
+    a = array_utils.create_dummy_ndarray(chainerx, shape, dtype)
+    b = chainerx.to_shared_memory(a)
+    assert b.device is a.device
+    assert b.is_contiguous
+    chainerx.testing.assert_array_equal_ex(a, b, strides_check=False)
+
+
+@pytest.mark.parametrize_device(['cuda:0'])
+def test_to_shared_memory_cuda(device):
+    with pytest.raises(chainerx.DeviceError):
+        chainerx.to_shared_memory(chainerx.arange(6))
+
+
+def test_pickle_shared_memory():
+    a = chainerx.to_shared_memory(chainerx.arange(24, dtype='float32'))
+    views = [a, a.reshape(4, 6)[1:, ::-2], a[5:6]]
+    for view in views:
+        b = pickle.loads(pickle.dumps(view))
+        assert b.shape == view.shape
+        assert b.strides == view.strides
+        chainerx.testing.assert_array_equal_ex(view, b)
+
+        # The buffer is shared.
+        b += 1
+        chainerx.testing.assert_array_equal_ex(view, b)
+
+    # The shared memory outlives the sender.
+    data = pickle.dumps(a)
+    expected = chainerx.to_numpy(a, copy=True)
+    del a, views
+    chainerx.testing.assert_array_equal_ex(pickle.loads(data), expected)
+
+
+def test_pickle_shared_memory_loaded_twice():
+    a = chainerx.to_shared_memory(chainerx.arange(6, dtype='float32'))
+    data = pickle.dumps(a)
+    b = pickle.loads(data)
+    c = pickle.loads(data)
+
+    # Each unpickled array holds its own reference.
+    del a, b
+    c += 1
+    chainerx.testing.assert_array_equal_ex(
+        c, numpy.arange(1, 7, dtype='float32'))
+
+    # The shared memory is released with the last array.
+    del c
+    with pytest.raises(chainerx.ChainerxError):
+        pickle.loads(data)
+
+
+@pytest.mark.skipif(
+    sys.version_info < (3, 8), reason='requires resource_tracker')
+def test_shared_memory_resource_tracker(monkeypatch):
+    from multiprocessing import resource_tracker
+
+    calls = []
+    monkeypatch.setattr(
+        resource_tracker, 'register',
+        lambda name, rtype: calls.append(('register', name, rtype)))
+    monkeypatch.setattr(
+        resource_tracker, 'unregister',
+        lambda name, rtype: calls.append(('unregister', name, rtype)))
+
+    a = chainerx.to_shared_memory(chainerx.arange(6, dtype='float32'))
+    assert len(calls) == 1
+    _, name, rtype = calls[0]
+    assert rtype == 'shared_memory'
+
+    # Unregistered when unlinked by the last array.
+    b = pickle.loads(pickle.dumps(a))
+    del a
+    assert len(calls) == 1
+    del b
+    assert calls[1:] == [('unregister', name, 'shared_memory')]
+
+
+@pytest.mark.parametrize('copy_func', [copy.copy, copy.deepcopy])
+@pytest.mark.parametrize('shared', [False, True])
+def test_copy(copy_func, shared):
+    a = chainerx.arange(6, dtype='float32').reshape(2, 3)
+    if shared:
+        a = chainerx.to_shared_memory(a)
+    b = copy_func(a)
+    assert b is not a
+    chainerx.testing.assert_array_equal_ex(a, b)
+
+    # The data is not shared.
+    b += 1
+    chainerx.testing.assert_array_equal_ex(
+        a, numpy.arange(6, dtype='float32').reshape(2, 3))
+
+
+@pytest.mark.parametrize('copy_func', [copy.copy, copy.deepcopy])
+def test_copy_graph_not_copied(copy_func):
+    a = chainerx.arange(6, dtype='float32').require_grad()
+    b = copy_func(a)
+    assert not b.is_backprop_required()
+
+
+def test_deepcopy_memo():
+    a = chainerx.arange(6, dtype='float32')
+    b, c = copy.deepcopy([a, a])
+    assert b is c
+    chainerx.testing.assert_array_equal_ex(a, b)
+
+
+def _increment(queue_in, queue_out):
+    a = queue_in.get()
+    a += 1
+    queue_out.put(a.sum())
+    queue_out.put(a)
+
+
+@pytest.mark.skipif(
+    not sys.platform.startswith('linux'), reason='requires fork')
+def test_pickle_shared_memory_between_processes():
+    context = multiprocessing.get_context('fork')
+    queue_in = context.Queue()
+    queue_out = context.Queue()
+    process = context.Process(target=_increment, args=(queue_in, queue_out))
+    process.start()
+
+    a = chainerx.to_shared_memory(chainerx.arange(6, dtype='float32'))
+    queue_in.put(a)
+    assert float(queue_out.get()) == 21
+    b = queue_out.get()
+    process.join()
+
+    # Both the child and the parent see the same buffer.
+    expected = numpy.arange(1, 7, dtype='float32')
+    chainerx.testing.assert_array_equal_ex(a, expected)
+    chainerx.testing.assert_array_equal_ex(b, expected)
+    b += 1
+    chainerx.testing.assert_array_equal_ex(a, expected + 1)
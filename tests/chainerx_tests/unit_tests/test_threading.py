@@ -0,0 +1,123 @@
+import sys
+import threading
+
+import numpy
+
+import chainerx
+import chainerx.testing
+
+
+def _run_in_threads(func, n_threads):
+    results = [None] * n_threads
+    errors = []
+
+    def target(i):
+        try:
+            results[i] = func(i)
+        except Exception as e:
+            errors.append(e)
+
+    threads = [
+        threading.Thread(target=target, args=(i,)) for i in range(n_threads)]
+    for thread in threads:
+        thread.start()
+    for thread in threads:
+        thread.join()
+    if errors:
+        raise errors[0]
+    return results
+
+
+# Integer dot is computed without BLAS, i.e. in the calling thread only.
+def _create_dot_operands(size):
+    a = numpy.arange(size * size, dtype=numpy.int32).reshape(size, size) % 7
+    b = numpy.arange(size * size, dtype=numpy.int32).reshape(size, size) % 5
+    return chainerx.array(a), chainerx.array(b)
+
+
+def test_compute_releases_gil():
+    a, b = _create_dot_operands(128)
+    main_thread_ran = threading.Event()
+    results = []
+
+    def worker():
+        for _ in range(100):
+            chainerx.dot(a, b)
+            if main_thread_ran.is_set():
+                results.append(True)
+                return
+        results.append(False)
+
+    # Threads are not switched periodically, so that the main thread can only
+    # run while the worker is blocked, i.e. while dot releases the GIL.
+    switch_interval = sys.getswitchinterval()
+    sys.setswitchinterval(1000)
+    try:
+        thread = threading.Thread(target=worker)
+        thread.start()
+        main_thread_ran.set()
+        thread.join()
+    finally:
+        sys.setswitchinterval(switch_interval)
+
+    assert results == [True]
+
+
+def test_concurrent_forward_backward():
+    x_np = numpy.random.uniform(-1, 1, (2, 3, 8, 8)).astype(numpy.float32)
+    w_np = numpy.random.uniform(-1, 1, (4, 3, 3, 3)).astype(numpy.float32)
+
+    def compute(i):
+        x = chainerx.array(x_np).require_grad()
+        w = chainerx.array(w_np).require_grad()
+        y = chainerx.conv(x, w, pad=1)
+        y = chainerx.max_pool(y, 2)
+        y = chainerx.linear(
+            y.reshape(2, 64), chainerx.ones((5, 64), 'float32'))
+        loss = chainerx.sum(y)
+        loss.backward()
+        return loss, x.grad, w.grad
+
+    expected = compute(0)
+    for results in _run_in_threads(compute, 8):
+        for actual, expected_array in zip(results, expected):
+            chainerx.testing.assert_allclose(actual, expected_array)
+
+
+def test_concurrent_inference_shared_parameters():
+    # Serving threads share the parameters of a model, which require grads
+    # for training but are only used for forward computation here.
+    w = chainerx.array(
+        numpy.random.uniform(-1, 1, (5, 4)).astype(numpy.float32))
+    b = chainerx.array(
+        numpy.random.uniform(-1, 1, (5,)).astype(numpy.float32))
+    w.require_grad()
+    b.require_grad()
+    w_expected = w.copy()
+    b_expected = b.copy()
+    xs = [
+        chainerx.array(
+            numpy.random.uniform(-1, 1, (3, 4)).astype(numpy.float32))
+        for _ in range(8)]
+
+    def forward(x):
+        return chainerx.log_softmax(
+            chainerx.maximum(0, chainerx.linear(x, w, b)), axis=1)
+
+    with chainerx.no_backprop_mode():
+        expected = [forward(x) for x in xs]
+
+    def serve(i):
+        with chainerx.no_backprop_mode():
+            ys = [forward(xs[i]) for _ in range(10)]
+        for y in ys:
+            assert not y.is_backprop_required()
+        return ys
+
+    for ys, expected_y in zip(_run_in_threads(serve, len(xs)), expected):
+        for y in ys:
+            chainerx.testing.assert_array_equal(y, expected_y)
+    chainerx.testing.assert_array_equal(w, w_expected)
+    chainerx.testing.assert_array_equal(b, b_expected)
+    assert w.grad is None
+    assert b.grad is None